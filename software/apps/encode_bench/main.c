@@ -0,0 +1,294 @@
+/*
+===============================================================================
+TMDS Encoder Benchmark
+===============================================================================
+Description:
+  Times every TMDS encoder in libdvi and the terminal's text encoders on one
+  scanline of each display mode width, with the core's cycle counter and
+  interrupts off, and prints a table over USB CDC every few seconds:
+
+    cycles     for a whole line, all 3 lanes (the best of BENCH_RUNS)
+    cyc/pix    that per active pixel and lane, as the budgets in
+               tmds_encode_font_2bpp.S are given (4.17 at 640x480)
+    budget     that as a share of the line time, taking the system clock
+               to be the bit clock as libdvi needs (10 cycles per pixel of
+               the total line width). Over 100% means one core can't keep up.
+
+  The same build runs on the Arm and RISC-V cores of RP2350 (PICO_PLATFORM
+  rp2350-arm-s or rp2350-riscv), and on RP2040. libdvi's data channel
+  encoders use the SIO TMDS encoder on RP2350 unless ENCODE_BENCH_SIO_TMDS is
+  turned off (see CMakeLists.txt), in which case they use the interpolator
+  loops as on RP2040.
+
+  Everything runs from SRAM (copy_to_ram) on core 0, so the counts are the
+  same at any clock. On core 1 the fullres and palette encoders use the
+  other scratch bank's copy, at the same speed.
+
+License: MIT
+Author: Donald R. Moran
+===============================================================================
+*/
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#if PICO_RP2040
+#include "hardware/structs/systick.h"
+#elif !PICO_RISCV
+#include "hardware/structs/m33.h"
+#endif
+#include "dvi.h"
+#include "tmds_encode.h"
+#include "tmds_encode_font_2bpp.h"
+#include "tmds_encode_font_2bpp_c.h"
+#include "font_rgb565.h"
+#include "Px437_IBM_VGA_8x16_scanline.h"
+
+#define BENCH_RUNS 8
+#define REPORT_INTERVAL_MS 5000
+#define MAX_WIDTH 1280
+#define FONT_CHAR_WIDTH 8
+#define FONT_N_CHARS 256
+
+// === Modes ===
+typedef struct {
+    const struct dvi_timing *timing;
+    const char *name;
+} bench_mode_t;
+
+static const bench_mode_t modes[] = {
+    {&dvi_timing_640x480p_60hz,         "640"},
+    {&dvi_timing_800x480p_60hz,         "800"},
+    {&dvi_timing_800x600p_reduced_60hz, "800r"},
+    {&dvi_timing_960x540p_60hz,         "960"},
+    {&dvi_timing_1280x720p_30hz,        "1280"},
+};
+#define N_MODES (sizeof(modes) / sizeof(modes[0]))
+
+// === Buffers ===
+// Big enough for a line of 16 bpp pixels at the widest mode, and for the
+// 3 lanes of TMDS symbols from any encoder, with the slack the text
+// encoders write past the end of a line
+#define PIXBUF_WORDS (MAX_WIDTH / 2)
+#define SYMBUF_WORDS (3 * MAX_WIDTH / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS)
+#define MAX_CHARS (MAX_WIDTH / FONT_CHAR_WIDTH)
+
+static uint32_t pixbuf[PIXBUF_WORDS];
+static uint32_t symbuf[SYMBUF_WORDS];
+static uint32_t tmds_palette[6 * 256];
+static uint8_t charbuf[MAX_CHARS + 8];
+static uint8_t attrbuf[MAX_CHARS + 8];
+static uint32_t colourbuf[4 * ((MAX_CHARS + 7) / 8)]; // 3 planes, then ext for the RGB565 paths
+#define COLOUR_PLANE_WORDS ((MAX_CHARS + 7) / 8)
+static const uint8_t *font_line = &px437_ibm_vga_8x16_scanline[8 * FONT_N_CHARS];
+
+bool blink_phase = true; // For tmds_encode_font_2bpp_c()
+
+// === Cycle Counter ===
+// As in the terminal: the M33's DWT, mcycle on RISC-V, or SysTick on RP2040,
+// which counts down and has only 24 bits (plenty for one line)
+#if PICO_RP2040
+#define CYCLE_COUNT_MASK 0xffffffu
+#else
+#define CYCLE_COUNT_MASK 0xffffffffu
+#endif
+
+static void start_cycle_counter(void) {
+#if PICO_RP2040
+    systick_hw->rvr = CYCLE_COUNT_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+#elif !PICO_RISCV
+    m33_hw->demcr |= M33_DEMCR_TRCENA_BITS;
+    m33_hw->dwt_cyccnt = 0;
+    m33_hw->dwt_ctrl |= M33_DWT_CTRL_CYCCNTENA_BITS;
+#endif
+}
+
+static inline uint32_t read_cycles(void) {
+#if PICO_RP2040
+    return -systick_hw->cvr;
+#elif PICO_RISCV
+    uint32_t cycles;
+    asm volatile ("csrr %0, mcycle" : "=r" (cycles));
+    return cycles;
+#else
+    return m33_hw->dwt_cyccnt;
+#endif
+}
+
+// === Encoders ===
+// Each encodes one whole line of width pixels, all 3 lanes, the way an app
+// calls it. The data channel encoders double pixels horizontally, as libdvi's
+// apps use them, so they read width / 2 pixels; the rest are full resolution.
+typedef void (*encode_line_t)(uint width);
+
+static void line_8bpp(uint width) {
+    uint lane_words = width / DVI_SYMBOLS_PER_WORD;
+    tmds_encode_data_channel_8bpp(pixbuf, symbuf, width / 2, DVI_8BPP_BLUE_MSB, DVI_8BPP_BLUE_LSB);
+    tmds_encode_data_channel_8bpp(pixbuf, symbuf + lane_words, width / 2, DVI_8BPP_GREEN_MSB, DVI_8BPP_GREEN_LSB);
+    tmds_encode_data_channel_8bpp(pixbuf, symbuf + 2 * lane_words, width / 2, DVI_8BPP_RED_MSB, DVI_8BPP_RED_LSB);
+}
+
+static void line_16bpp(uint width) {
+    uint lane_words = width / DVI_SYMBOLS_PER_WORD;
+    tmds_encode_data_channel_16bpp(pixbuf, symbuf, width / 2, DVI_16BPP_BLUE_MSB, DVI_16BPP_BLUE_LSB);
+    tmds_encode_data_channel_16bpp(pixbuf, symbuf + lane_words, width / 2, DVI_16BPP_GREEN_MSB, DVI_16BPP_GREEN_LSB);
+    tmds_encode_data_channel_16bpp(pixbuf, symbuf + 2 * lane_words, width / 2, DVI_16BPP_RED_MSB, DVI_16BPP_RED_LSB);
+}
+
+static void line_fullres_16bpp(uint width) {
+    uint lane_words = width / DVI_SYMBOLS_PER_WORD;
+    tmds_encode_data_channel_fullres_16bpp(pixbuf, symbuf, width, DVI_16BPP_BLUE_MSB, DVI_16BPP_BLUE_LSB);
+    tmds_encode_data_channel_fullres_16bpp(pixbuf, symbuf + lane_words, width, DVI_16BPP_GREEN_MSB, DVI_16BPP_GREEN_LSB);
+    tmds_encode_data_channel_fullres_16bpp(pixbuf, symbuf + 2 * lane_words, width, DVI_16BPP_RED_MSB, DVI_16BPP_RED_LSB);
+}
+
+static void line_palette_8bpp(uint width) {
+    tmds_encode_palette_data(pixbuf, tmds_palette, symbuf, width, 8);
+}
+
+// Monochrome: one lane, sent to all 3 (DVI_MONOCHROME_TMDS)
+static void line_1bpp(uint width) {
+    tmds_encode_1bpp(pixbuf, symbuf, width);
+}
+
+static void line_2bpp(uint width) {
+    tmds_encode_2bpp(pixbuf, symbuf, width);
+}
+
+// The terminal's text encoders, on a row of every glyph in mixed colours
+static void line_font_2bpp(uint width) {
+    uint lane_words = width / DVI_SYMBOLS_PER_WORD;
+    for (uint plane = 0; plane < 3; plane++) {
+        tmds_encode_font_2bpp(charbuf, colourbuf + plane * COLOUR_PLANE_WORDS,
+                              symbuf + plane * lane_words, width, font_line);
+    }
+}
+
+// Its n_pix is really a count of characters
+static void line_font_2bpp_c(uint width) {
+    uint lane_words = width / DVI_SYMBOLS_PER_WORD;
+    for (uint plane = 0; plane < 3; plane++) {
+        tmds_encode_font_2bpp_c(charbuf, colourbuf + plane * COLOUR_PLANE_WORDS, attrbuf,
+                                symbuf + plane * lane_words, width / FONT_CHAR_WIDTH, font_line, 8);
+    }
+}
+
+// Pixels for HSTX to encode, so this is all the software does there
+static void line_font_expand_rgb565(uint width) {
+    font_expand_rgb565(charbuf, colourbuf, COLOUR_PLANE_WORDS, colourbuf + 3 * COLOUR_PLANE_WORDS,
+                       symbuf, width / FONT_CHAR_WIDTH, font_line);
+}
+
+#if !PICO_RP2040
+static void line_font_sio(uint width) {
+    tmds_encode_font_sio(charbuf, colourbuf, COLOUR_PLANE_WORDS, colourbuf + 3 * COLOUR_PLANE_WORDS,
+                         symbuf, width / DVI_SYMBOLS_PER_WORD, width / FONT_CHAR_WIDTH, font_line);
+}
+#endif
+
+typedef struct {
+    const char *name;
+    encode_line_t encode;
+    uint lanes; // Of TMDS symbols it makes
+} encoder_t;
+
+static const encoder_t encoders[] = {
+#if DVI_USE_SIO_TMDS_ENCODER
+    {"data_channel_8bpp (sio)",       line_8bpp, 3},
+    {"data_channel_16bpp (sio)",      line_16bpp, 3},
+    {"fullres_16bpp (sio)",           line_fullres_16bpp, 3},
+#else
+    {"data_channel_8bpp (interp)",    line_8bpp, 3},
+    {"data_channel_16bpp (interp)",   line_16bpp, 3},
+    {"fullres_16bpp (interp)",        line_fullres_16bpp, 3},
+#endif
+    {"palette_data 8bpp",             line_palette_8bpp, 3},
+    {"1bpp (1 lane)",                 line_1bpp, 1},
+    {"2bpp (1 lane)",                 line_2bpp, 1},
+    {"font_2bpp",                     line_font_2bpp, 3},
+    {"font_2bpp_c",                   line_font_2bpp_c, 3},
+    {"font_expand_rgb565 (hstx)",     line_font_expand_rgb565, 3},
+#if !PICO_RP2040
+    {"font_sio",                      line_font_sio, 3},
+#endif
+};
+#define N_ENCODERS (sizeof(encoders) / sizeof(encoders[0]))
+
+// === Benchmark ===
+static void fill_inputs(void) {
+    for (uint i = 0; i < PIXBUF_WORDS; i++) {
+        pixbuf[i] = 0x9E3779B9u * (i + 1); // Busy pixels, so the DC balance works
+    }
+    for (uint i = 0; i < MAX_CHARS + 8; i++) {
+        charbuf[i] = i;
+        attrbuf[i] = 0;
+    }
+    for (uint i = 0; i < sizeof(colourbuf) / sizeof(colourbuf[0]); i++) {
+        colourbuf[i] = 0x7F4A7C15u * (i + 1);
+    }
+    static uint16_t palette[256];
+    for (uint i = 0; i < 256; i++) {
+        palette[i] = i * 0x0101u;
+        font_palette_rgb565[i] = palette[i] * 0x10001u;
+    }
+    tmds_setup_palette_symbols(palette, tmds_palette, 256);
+}
+
+// Fewest cycles any of BENCH_RUNS lines took
+static uint32_t time_encoder(const encoder_t *e, uint width) {
+    uint32_t best = ~0u;
+    uint32_t irq_state = save_and_disable_interrupts();
+    for (uint run = 0; run < BENCH_RUNS; run++) {
+        uint32_t start = read_cycles();
+        e->encode(width);
+        uint32_t cycles = (read_cycles() - start) & CYCLE_COUNT_MASK;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+    restore_interrupts(irq_state);
+    return best;
+}
+
+static void print_table(void) {
+#if PICO_RP2040
+    const char *core = "RP2040 M0+";
+#elif PICO_RISCV
+    const char *core = "RP2350 Hazard3";
+#else
+    const char *core = "RP2350 M33";
+#endif
+    printf("\nTMDS encoders on %s, cycles per line / per pixel and lane / share of the line time\n", core);
+    printf("%-28s", "encoder");
+    for (uint m = 0; m < N_MODES; m++) {
+        printf(" %20s", modes[m].name);
+    }
+    printf("\n");
+    for (uint e = 0; e < N_ENCODERS; e++) {
+        printf("%-28s", encoders[e].name);
+        for (uint m = 0; m < N_MODES; m++) {
+            const struct dvi_timing *t = modes[m].timing;
+            uint width = t->h_active_pixels;
+            uint h_total = t->h_front_porch + t->h_sync_width + t->h_back_porch + width;
+            uint32_t cycles = time_encoder(&encoders[e], width);
+            uint32_t hundredths = cycles * 100 / (width * encoders[e].lanes);
+            printf(" %7lu %3lu.%02lu %4lu%%", (unsigned long)cycles,
+                   (unsigned long)(hundredths / 100), (unsigned long)(hundredths % 100),
+                   (unsigned long)(cycles * 100 / (10 * h_total)));
+        }
+        printf("\n");
+    }
+}
+
+int main(void) {
+    stdio_init_all();
+    start_cycle_counter();
+    fill_inputs();
+
+    while (true) {
+        print_table();
+        sleep_ms(REPORT_INTERVAL_MS);
+    }
+}
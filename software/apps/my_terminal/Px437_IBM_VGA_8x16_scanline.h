@@ -0,0 +1,318 @@
+#ifndef PX437_IBM_VGA_8X16_SCANLINE_H
+#define PX437_IBM_VGA_8X16_SCANLINE_H
+
+// Generated by font_work/pack_scanline.py from Px437_IBM_VGA_8x16.h
+// Scanline major, leftmost pixel in bit 0, as tmds_encode_font_2bpp reads it
+
+static const uint8_t px437_ibm_vga_8x16_scanline[16 * 256] = {
+  /* line  0 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  1 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x08, 0x00, 0x06, 0x1C, 0x00, 0x08, 0x00, 0x06, 0x00, 0x18, 0x06, 0x63, 0x36,
+  0x0C, 0x00, 0x00, 0x08, 0x00, 0x06, 0x0C, 0x06, 0x00, 0x63, 0x63, 0x18, 0x1C, 0x00, 0x1F, 0x70,
+  0x18, 0x30, 0x18, 0x18, 0x00, 0x3B, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x1B, 0x0E, 0x00, 0x00,
+  /* line  2 */
+  0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x78, 0x3C, 0xFC, 0xFE, 0x00,
+  0x03, 0x60, 0x18, 0x66, 0xFE, 0x63, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x66, 0x00, 0x3E, 0x00, 0x1C, 0x0C, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0x18, 0x3E, 0x3E, 0x30, 0x7F, 0x1C, 0x7F, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x08, 0x3F, 0x3C, 0x1F, 0x7F, 0x7F, 0x3C, 0x63, 0x3C, 0x78, 0x67, 0x0F, 0x63, 0x63, 0x3E,
+  0x3F, 0x3E, 0x3F, 0x3E, 0x7E, 0x63, 0x63, 0x63, 0x63, 0x66, 0x7F, 0x3C, 0x00, 0x3C, 0x36, 0x00,
+  0x18, 0x00, 0x07, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x07, 0x18, 0x60, 0x07, 0x1C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x0E, 0x6E, 0x00,
+  0x3C, 0x33, 0x18, 0x1C, 0x33, 0x0C, 0x36, 0x00, 0x1C, 0x63, 0x0C, 0x66, 0x3C, 0x0C, 0x00, 0x1C,
+  0x06, 0x00, 0x7C, 0x1C, 0x63, 0x0C, 0x1E, 0x0C, 0x63, 0x00, 0x00, 0x18, 0x36, 0x66, 0x33, 0xD8,
+  0x0C, 0x18, 0x0C, 0x0C, 0x6E, 0x00, 0x36, 0x36, 0x0C, 0x00, 0x00, 0x03, 0x03, 0x18, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x78, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x00, 0x36, 0x00, 0x00, 0x30, 0x36, 0x1B, 0x00, 0x00,
+  /* line  3 */
+  0x00, 0x81, 0xFF, 0x00, 0x00, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x00, 0x70, 0x66, 0xCC, 0xC6, 0x18,
+  0x07, 0x70, 0x3C, 0x66, 0xDB, 0x06, 0x00, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0x66, 0x36, 0x63, 0x00, 0x36, 0x0C, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0x1C, 0x63, 0x63, 0x38, 0x03, 0x06, 0x63, 0x63, 0x63, 0x00, 0x00, 0x60, 0x00, 0x06, 0x63,
+  0x3E, 0x1C, 0x66, 0x66, 0x36, 0x66, 0x66, 0x66, 0x63, 0x18, 0x30, 0x66, 0x06, 0x77, 0x67, 0x63,
+  0x66, 0x63, 0x66, 0x63, 0x7E, 0x63, 0x63, 0x63, 0x63, 0x66, 0x63, 0x0C, 0x01, 0x30, 0x63, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x30, 0x00, 0x36, 0x00, 0x06, 0x18, 0x60, 0x06, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x3B, 0x00,
+  0x66, 0x00, 0x0C, 0x36, 0x00, 0x18, 0x1C, 0x00, 0x36, 0x00, 0x18, 0x00, 0x66, 0x18, 0x08, 0x00,
+  0x00, 0x00, 0x36, 0x36, 0x00, 0x18, 0x33, 0x18, 0x00, 0x3E, 0x63, 0x3C, 0x26, 0x66, 0x33, 0x18,
+  0x06, 0x0C, 0x06, 0x06, 0x3B, 0x63, 0x36, 0x36, 0x0C, 0x00, 0x00, 0x43, 0x43, 0x18, 0x00, 0x00,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x33, 0x63, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x1C, 0x36, 0x0C, 0x00, 0xC0, 0x0C, 0x3E,
+  0x00, 0x00, 0x0C, 0x30, 0xD8, 0x18, 0x00, 0x00, 0x36, 0x00, 0x00, 0x30, 0x36, 0x0C, 0x00, 0x00,
+  /* line  4 */
+  0x00, 0xA5, 0xDB, 0x36, 0x08, 0x3C, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0x58, 0x66, 0xFC, 0xFE, 0x18,
+  0x0F, 0x78, 0x7E, 0x66, 0xDB, 0x1C, 0x00, 0x7E, 0x7E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7F,
+  0x00, 0x3C, 0x24, 0x36, 0x43, 0x43, 0x36, 0x06, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x63, 0x1E, 0x60, 0x60, 0x3C, 0x03, 0x03, 0x60, 0x63, 0x63, 0x18, 0x18, 0x30, 0x00, 0x0C, 0x63,
+  0x63, 0x36, 0x66, 0x43, 0x66, 0x46, 0x46, 0x43, 0x63, 0x18, 0x30, 0x66, 0x06, 0x7F, 0x6F, 0x63,
+  0x66, 0x63, 0x66, 0x63, 0x5A, 0x63, 0x63, 0x63, 0x36, 0x66, 0x61, 0x0C, 0x03, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x30, 0x00, 0x26, 0x00, 0x06, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C,
+  0x7F, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x66, 0x06, 0x3C, 0x1F, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x7C, 0x1C, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x33, 0x63, 0x7F, 0x63, 0x00, 0x66, 0x6E, 0x18, 0x36, 0x63, 0x18, 0x00, 0x60, 0x06, 0x63,
+  0x7F, 0x18, 0x18, 0x18, 0xD8, 0x18, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x36, 0x06, 0x3E, 0x00,
+  /* line  5 */
+  0x00, 0x81, 0xFF, 0x7F, 0x1C, 0x3C, 0x7E, 0x00, 0xFF, 0x3C, 0x00, 0x4C, 0x66, 0x0C, 0xC6, 0xDB,
+  0x1F, 0x7C, 0x18, 0x66, 0xDB, 0x36, 0x00, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x00, 0x14, 0x1C, 0x7F,
+  0x00, 0x3C, 0x00, 0x7F, 0x03, 0x63, 0x1C, 0x00, 0x0C, 0x30, 0x66, 0x18, 0x00, 0x00, 0x00, 0x60,
+  0x63, 0x18, 0x30, 0x60, 0x36, 0x03, 0x03, 0x60, 0x63, 0x63, 0x18, 0x18, 0x18, 0x7E, 0x18, 0x30,
+  0x63, 0x63, 0x66, 0x03, 0x66, 0x16, 0x16, 0x03, 0x63, 0x18, 0x30, 0x36, 0x06, 0x7F, 0x7F, 0x63,
+  0x66, 0x63, 0x66, 0x06, 0x18, 0x63, 0x63, 0x63, 0x3E, 0x66, 0x30, 0x0C, 0x07, 0x30, 0x00, 0x00,
+  0x00, 0x1E, 0x1E, 0x3E, 0x3C, 0x3E, 0x06, 0x6E, 0x36, 0x1C, 0x70, 0x66, 0x18, 0x37, 0x3B, 0x3E,
+  0x3B, 0x6E, 0x3B, 0x3E, 0x3F, 0x33, 0x66, 0x63, 0x63, 0x63, 0x7F, 0x18, 0x18, 0x18, 0x00, 0x1C,
+  0x03, 0x33, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x66, 0x3E, 0x3E, 0x3E, 0x1C, 0x1C, 0x1C, 0x36, 0x36,
+  0x66, 0x33, 0x33, 0x3E, 0x3E, 0x3E, 0x33, 0x33, 0x63, 0x63, 0x63, 0x06, 0x0F, 0x18, 0x23, 0x18,
+  0x1E, 0x1C, 0x3E, 0x33, 0x3B, 0x6F, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x33, 0x33, 0x18, 0x6C, 0x1B,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x1F, 0x6C, 0x00, 0x1F, 0x6F, 0x6C, 0x7F, 0x6F, 0x6C, 0x1F, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xF8, 0x6C, 0xEC, 0xFC, 0xEF, 0xFF, 0xEC, 0xFF, 0xEF, 0xFF,
+  0x6C, 0xFF, 0x00, 0x6C, 0xF8, 0xF8, 0x00, 0x6C, 0xFF, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x6E, 0x33, 0x03, 0x36, 0x06, 0x7E, 0x66, 0x3B, 0x3C, 0x63, 0x63, 0x30, 0x7E, 0x7E, 0x06, 0x63,
+  0x00, 0x18, 0x30, 0x0C, 0x18, 0x18, 0x18, 0x6E, 0x00, 0x00, 0x00, 0x30, 0x36, 0x13, 0x3E, 0x00,
+  /* line  6 */
+  0x00, 0x81, 0xFF, 0x7F, 0x3E, 0xE7, 0xFF, 0x18, 0xE7, 0x66, 0x00, 0x1E, 0x66, 0x0C, 0xC6, 0x3C,
+  0x7F, 0x7F, 0x18, 0x66, 0xDE, 0x63, 0x00, 0x18, 0x18, 0x18, 0x30, 0x06, 0x03, 0x36, 0x1C, 0x3E,
+  0x00, 0x18, 0x00, 0x36, 0x3E, 0x30, 0x6E, 0x00, 0x0C, 0x30, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x30,
+  0x6B, 0x18, 0x18, 0x3C, 0x33, 0x3F, 0x3F, 0x30, 0x3E, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x18,
+  0x7B, 0x63, 0x3E, 0x03, 0x66, 0x1E, 0x1E, 0x03, 0x7F, 0x18, 0x30, 0x1E, 0x06, 0x6B, 0x7B, 0x63,
+  0x3E, 0x63, 0x3E, 0x1C, 0x18, 0x63, 0x63, 0x6B, 0x1C, 0x3C, 0x18, 0x0C, 0x0E, 0x30, 0x00, 0x00,
+  0x00, 0x30, 0x36, 0x63, 0x36, 0x63, 0x0F, 0x33, 0x6E, 0x18, 0x60, 0x36, 0x18, 0x7F, 0x66, 0x63,
+  0x66, 0x33, 0x6E, 0x63, 0x0C, 0x33, 0x66, 0x63, 0x36, 0x63, 0x33, 0x0E, 0x00, 0x70, 0x00, 0x36,
+  0x03, 0x33, 0x63, 0x30, 0x30, 0x30, 0x30, 0x06, 0x63, 0x63, 0x63, 0x18, 0x18, 0x18, 0x63, 0x63,
+  0x06, 0x6E, 0x7F, 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x63, 0x06, 0x06, 0x7E, 0x33, 0x7E,
+  0x30, 0x18, 0x63, 0x33, 0x66, 0x7F, 0x7E, 0x3E, 0x0C, 0x7F, 0x7F, 0x18, 0x18, 0x18, 0x36, 0x36,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x18, 0x60, 0x6C, 0x60, 0x60, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x3B, 0x1B, 0x03, 0x36, 0x0C, 0x1B, 0x66, 0x18, 0x66, 0x63, 0x63, 0x7C, 0xDB, 0xDB, 0x3E, 0x63,
+  0x00, 0x7E, 0x60, 0x06, 0x18, 0x18, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x30, 0x36, 0x1F, 0x3E, 0x00,
+  /* line  7 */
+  0x00, 0xBD, 0xC3, 0x7F, 0x7F, 0xE7, 0xFF, 0x3C, 0xC3, 0x42, 0x00, 0x33, 0x3C, 0x0C, 0xC6, 0xE7,
+  0x1F, 0x7C, 0x18, 0x66, 0xD8, 0x63, 0x00, 0x18, 0x18, 0x18, 0x7F, 0x7F, 0x03, 0x7F, 0x3E, 0x3E,
+  0x00, 0x18, 0x00, 0x36, 0x60, 0x18, 0x3B, 0x00, 0x0C, 0x30, 0xFF, 0x7E, 0x00, 0x7F, 0x00, 0x18,
+  0x6B, 0x18, 0x0C, 0x60, 0x7F, 0x60, 0x63, 0x18, 0x63, 0x60, 0x00, 0x00, 0x06, 0x00, 0x60, 0x18,
+  0x7B, 0x7F, 0x66, 0x03, 0x66, 0x16, 0x16, 0x7B, 0x63, 0x18, 0x30, 0x1E, 0x06, 0x63, 0x73, 0x63,
+  0x06, 0x63, 0x36, 0x30, 0x18, 0x63, 0x63, 0x6B, 0x1C, 0x18, 0x0C, 0x0C, 0x1C, 0x30, 0x00, 0x00,
+  0x00, 0x3E, 0x66, 0x03, 0x33, 0x7F, 0x06, 0x33, 0x66, 0x18, 0x60, 0x1E, 0x18, 0x6B, 0x66, 0x63,
+  0x66, 0x33, 0x66, 0x06, 0x0C, 0x33, 0x66, 0x6B, 0x1C, 0x63, 0x18, 0x18, 0x18, 0x18, 0x00, 0x63,
+  0x03, 0x33, 0x7F, 0x3E, 0x3E, 0x3E, 0x3E, 0x06, 0x7F, 0x7F, 0x7F, 0x18, 0x18, 0x18, 0x63, 0x63,
+  0x3E, 0x6C, 0x33, 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x63, 0x06, 0x06, 0x18, 0x7B, 0x18,
+  0x3E, 0x18, 0x63, 0x33, 0x66, 0x7B, 0x00, 0x00, 0x06, 0x03, 0x60, 0x0C, 0x0C, 0x18, 0x1B, 0x6C,
+  0x22, 0x55, 0xEE, 0x18, 0x1F, 0x1F, 0x6F, 0x7F, 0x1F, 0x6F, 0x6C, 0x6F, 0x7F, 0x7F, 0x1F, 0x1F,
+  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xEC, 0xFC, 0xEC, 0xFF, 0xEF, 0xEC, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x1B, 0x33, 0x03, 0x36, 0x18, 0x1B, 0x66, 0x18, 0x66, 0x7F, 0x36, 0x66, 0xDB, 0xDB, 0x06, 0x63,
+  0x7F, 0x18, 0x30, 0x0C, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x18, 0x00, 0x37, 0x00, 0x00, 0x3E, 0x00,
+  /* line  8 */
+  0x00, 0x99, 0xE7, 0x7F, 0x3E, 0xE7, 0x7E, 0x3C, 0xC3, 0x42, 0x00, 0x33, 0x18, 0x0C, 0xC6, 0x3C,
+  0x0F, 0x78, 0x7E, 0x66, 0xD8, 0x36, 0x7F, 0x7E, 0x18, 0x18, 0x30, 0x06, 0x03, 0x36, 0x3E, 0x1C,
+  0x00, 0x18, 0x00, 0x36, 0x60, 0x0C, 0x33, 0x00, 0x0C, 0x30, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x0C,
+  0x63, 0x18, 0x06, 0x60, 0x30, 0x60, 0x63, 0x0C, 0x63, 0x60, 0x00, 0x00, 0x0C, 0x7E, 0x30, 0x18,
+  0x7B, 0x63, 0x66, 0x03, 0x66, 0x06, 0x06, 0x63, 0x63, 0x18, 0x33, 0x36, 0x06, 0x63, 0x63, 0x63,
+  0x06, 0x63, 0x66, 0x60, 0x18, 0x63, 0x63, 0x6B, 0x3E, 0x18, 0x06, 0x0C, 0x38, 0x30, 0x00, 0x00,
+  0x00, 0x33, 0x66, 0x03, 0x33, 0x03, 0x06, 0x33, 0x66, 0x18, 0x60, 0x1E, 0x18, 0x6B, 0x66, 0x63,
+  0x66, 0x33, 0x06, 0x1C, 0x0C, 0x33, 0x66, 0x6B, 0x1C, 0x63, 0x0C, 0x18, 0x18, 0x18, 0x00, 0x63,
+  0x43, 0x33, 0x03, 0x33, 0x33, 0x33, 0x33, 0x66, 0x03, 0x03, 0x03, 0x18, 0x18, 0x18, 0x7F, 0x7F,
+  0x06, 0x7E, 0x33, 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x63, 0x66, 0x06, 0x7E, 0x33, 0x18,
+  0x33, 0x18, 0x63, 0x33, 0x66, 0x73, 0x00, 0x00, 0x03, 0x03, 0x60, 0x06, 0x66, 0x3C, 0x36, 0x36,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x1B, 0x63, 0x03, 0x36, 0x0C, 0x1B, 0x66, 0x18, 0x66, 0x63, 0x36, 0x66, 0xDB, 0xCF, 0x06, 0x63,
+  0x00, 0x18, 0x18, 0x18, 0x18, 0x1B, 0x00, 0x6E, 0x00, 0x18, 0x18, 0x36, 0x00, 0x00, 0x3E, 0x00,
+  /* line  9 */
+  0x00, 0x81, 0xFF, 0x3E, 0x1C, 0x18, 0x18, 0x18, 0xE7, 0x66, 0x00, 0x33, 0x7E, 0x0E, 0xE6, 0xDB,
+  0x07, 0x70, 0x3C, 0x00, 0xD8, 0x1C, 0x7F, 0x3C, 0x18, 0x7E, 0x18, 0x0C, 0x7F, 0x14, 0x7F, 0x1C,
+  0x00, 0x00, 0x00, 0x7F, 0x61, 0x06, 0x33, 0x00, 0x0C, 0x30, 0x66, 0x18, 0x18, 0x00, 0x00, 0x06,
+  0x63, 0x18, 0x03, 0x60, 0x30, 0x60, 0x63, 0x0C, 0x63, 0x60, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00,
+  0x3B, 0x63, 0x66, 0x43, 0x66, 0x46, 0x06, 0x63, 0x63, 0x18, 0x33, 0x66, 0x46, 0x63, 0x63, 0x63,
+  0x06, 0x6B, 0x66, 0x63, 0x18, 0x63, 0x36, 0x7F, 0x36, 0x18, 0x43, 0x0C, 0x70, 0x30, 0x00, 0x00,
+  0x00, 0x33, 0x66, 0x03, 0x33, 0x03, 0x06, 0x33, 0x66, 0x18, 0x60, 0x36, 0x18, 0x6B, 0x66, 0x63,
+  0x66, 0x33, 0x06, 0x30, 0x0C, 0x33, 0x66, 0x6B, 0x1C, 0x63, 0x06, 0x18, 0x18, 0x18, 0x00, 0x63,
+  0x66, 0x33, 0x03, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x03, 0x03, 0x03, 0x18, 0x18, 0x18, 0x63, 0x63,
+  0x06, 0x1B, 0x33, 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x63, 0x3C, 0x06, 0x18, 0x33, 0x18,
+  0x33, 0x18, 0x63, 0x33, 0x66, 0x63, 0x00, 0x00, 0x63, 0x03, 0x60, 0x3B, 0x73, 0x3C, 0x6C, 0x1B,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x1B, 0x63, 0x03, 0x36, 0x06, 0x1B, 0x3E, 0x18, 0x3C, 0x63, 0x36, 0x66, 0x7E, 0x7E, 0x06, 0x63,
+  0x00, 0x00, 0x0C, 0x30, 0x18, 0x1B, 0x18, 0x3B, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x3E, 0x00,
+  /* line 10 */
+  0x00, 0x81, 0xFF, 0x1C, 0x08, 0x18, 0x18, 0x00, 0xFF, 0x3C, 0x00, 0x33, 0x18, 0x0F, 0xE7, 0x18,
+  0x03, 0x60, 0x18, 0x66, 0xD8, 0x30, 0x7F, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x08,
+  0x00, 0x18, 0x00, 0x36, 0x63, 0x63, 0x33, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x00, 0x18, 0x03,
+  0x36, 0x18, 0x63, 0x63, 0x30, 0x63, 0x63, 0x0C, 0x63, 0x30, 0x18, 0x18, 0x30, 0x00, 0x0C, 0x18,
+  0x03, 0x63, 0x66, 0x66, 0x36, 0x66, 0x06, 0x66, 0x63, 0x18, 0x33, 0x66, 0x66, 0x63, 0x63, 0x63,
+  0x06, 0x7B, 0x66, 0x63, 0x18, 0x63, 0x1C, 0x77, 0x63, 0x18, 0x63, 0x0C, 0x60, 0x30, 0x00, 0x00,
+  0x00, 0x33, 0x66, 0x63, 0x33, 0x63, 0x06, 0x33, 0x66, 0x18, 0x60, 0x66, 0x18, 0x6B, 0x66, 0x63,
+  0x66, 0x33, 0x06, 0x63, 0x6C, 0x33, 0x3C, 0x7F, 0x36, 0x63, 0x63, 0x18, 0x18, 0x18, 0x00, 0x7F,
+  0x3C, 0x33, 0x63, 0x33, 0x33, 0x33, 0x33, 0x30, 0x63, 0x63, 0x63, 0x18, 0x18, 0x18, 0x63, 0x63,
+  0x66, 0x1B, 0x33, 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x63, 0x18, 0x67, 0x18, 0x33, 0x18,
+  0x33, 0x18, 0x63, 0x33, 0x66, 0x63, 0x00, 0x00, 0x63, 0x03, 0x60, 0x61, 0x79, 0x3C, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x3B, 0x63, 0x03, 0x36, 0x63, 0x1B, 0x06, 0x18, 0x18, 0x36, 0x36, 0x66, 0x00, 0x06, 0x0C, 0x63,
+  0x7F, 0x00, 0x00, 0x00, 0x18, 0x1B, 0x18, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00,
+  /* line 11 */
+  0x00, 0x7E, 0x7E, 0x08, 0x00, 0x3C, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x18, 0x07, 0x67, 0x18,
+  0x01, 0x40, 0x00, 0x66, 0xD8, 0x63, 0x7F, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x36, 0x3E, 0x61, 0x6E, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x18, 0x01,
+  0x1C, 0x7E, 0x7F, 0x3E, 0x78, 0x3E, 0x3E, 0x0C, 0x3E, 0x1E, 0x00, 0x0C, 0x60, 0x00, 0x06, 0x18,
+  0x3E, 0x63, 0x3F, 0x3C, 0x1F, 0x7F, 0x0F, 0x5C, 0x63, 0x3C, 0x1E, 0x67, 0x7F, 0x63, 0x63, 0x3E,
+  0x0F, 0x3E, 0x67, 0x3E, 0x3C, 0x3E, 0x08, 0x36, 0x63, 0x3C, 0x7F, 0x3C, 0x40, 0x3C, 0x00, 0x00,
+  0x00, 0x6E, 0x3E, 0x3E, 0x6E, 0x3E, 0x0F, 0x3E, 0x67, 0x3C, 0x60, 0x67, 0x3C, 0x63, 0x66, 0x3E,
+  0x3E, 0x3E, 0x0F, 0x3E, 0x38, 0x6E, 0x18, 0x36, 0x63, 0x7E, 0x7F, 0x70, 0x18, 0x0E, 0x00, 0x00,
+  0x30, 0x6E, 0x3E, 0x6E, 0x6E, 0x6E, 0x6E, 0x60, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x63, 0x63,
+  0x7F, 0x76, 0x73, 0x3E, 0x3E, 0x3E, 0x6E, 0x6E, 0x7E, 0x3E, 0x3E, 0x18, 0x3F, 0x18, 0x63, 0x18,
+  0x6E, 0x3C, 0x3E, 0x6E, 0x66, 0x63, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x30, 0x7C, 0x18, 0x00, 0x00,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x6E, 0x33, 0x03, 0x36, 0x7F, 0x0E, 0x06, 0x18, 0x7E, 0x1C, 0x77, 0x3C, 0x00, 0x03, 0x38, 0x63,
+  0x00, 0xFF, 0x7E, 0x7E, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  /* line 12 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 13 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x60, 0x00, 0x00, 0x00,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 14 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0xAA, 0xBB, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 15 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Bit n set: line n of the glyph is empty
+static const uint16_t px437_ibm_vga_8x16_blank_lines[256] = {
+  0xFFFF, 0xF003, 0xF003, 0xF00F, 0xF80F, 0xF007, 0xF007, 0xFC3F,
+  0x0000, 0xF81F, 0xFFFF, 0xF003, 0xF003, 0xF003, 0xE003, 0xF007,
+  0xF001, 0xF001, 0xF803, 0xF203, 0xF003, 0xE001, 0xF0FF, 0xF003,
+  0xF003, 0xF003, 0xFC1F, 0xFC1F, 0xFC3F, 0xFC1F, 0xF80F, 0xF80F,
+  0xFFFF, 0xF203, 0xFFE1, 0xF007, 0xC000, 0xF00F, 0xF003, 0xFFE1,
+  0xF003, 0xF003, 0xFC1F, 0xFC1F, 0xE1FF, 0xFF7F, 0xF3FF, 0xF00F,
+  0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003,
+  0xF003, 0xF003, 0xF9CF, 0xF1CF, 0xF007, 0xFEDF, 0xF007, 0xF203,
+  0xF007, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003,
+  0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003,
+  0xF003, 0xC003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003, 0xF003,
+  0xF003, 0xF003, 0xF003, 0xF003, 0xF007, 0xF003, 0xFFF0, 0xDFFF,
+  0xFFF8, 0xF01F, 0xF003, 0xF01F, 0xF003, 0xF01F, 0xF003, 0x801F,
+  0xF003, 0xF013, 0x8013, 0xF003, 0xF003, 0xF01F, 0xF01F, 0xF01F,
+  0x801F, 0x801F, 0xF01F, 0xF01F, 0xF003, 0xF01F, 0xF01F, 0xF01F,
+  0xF01F, 0x801F, 0xF01F, 0xF003, 0xF043, 0xF003, 0xFFF3, 0xF80F,
+  0xC003, 0xF01B, 0xF011, 0xF011, 0xF01B, 0xF011, 0xF011, 0xE00F,
+  0xF011, 0xF01B, 0xF011, 0xF01B, 0xF011, 0xF011, 0xF005, 0xF008,
+  0xF008, 0xF01F, 0xF003, 0xF011, 0xF01B, 0xF011, 0xF011, 0xF011,
+  0x801B, 0xF005, 0xF005, 0xF001, 0xF001, 0xF003, 0xF001, 0xC001,
+  0xF011, 0xF011, 0xF011, 0xF011, 0xF013, 0xF004, 0xFFA1, 0xFFA1,
+  0xF013, 0xF83F, 0xF83F, 0xC001, 0xC001, 0xF013, 0xFC1F, 0xFC1F,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007F,
+  0x001F, 0x0000, 0x0000, 0x001F, 0xFF00, 0xFF00, 0xFF00, 0x007F,
+  0xFF00, 0xFF00, 0x007F, 0x0000, 0xFF7F, 0x0000, 0x0000, 0x0000,
+  0xFF00, 0x001F, 0xFF40, 0x005F, 0x0000, 0xFF5F, 0x0040, 0xFF40,
+  0xFF00, 0x005F, 0x007F, 0xFF00, 0xFF00, 0x001F, 0x007F, 0x0000,
+  0x0000, 0xFF00, 0x007F, 0x0000, 0x007F, 0x0000, 0x0000, 0xFF80,
+  0xF01F, 0xF003, 0xF003, 0xF00F, 0xF007, 0xF01F, 0xE00F, 0xF00F,
+  0xF007, 0xF007, 0xF003, 0xF003, 0xFC1F, 0xF007, 0xF003, 0xF007,
+  0xFB6F, 0xF60F, 0xF407, 0xF407, 0x0003, 0xF000, 0xF94F, 0xFC9F,
+  0xFFE1, 0xFE7F, 0xFEFF, 0xF001, 0xFF81, 0xFF81, 0xF80F, 0xFFFF,
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "pico.h"
+#include "hardware/structs/sio.h"
+#include "font_rgb565.h"
+
+uint32_t font_palette_rgb565[256];
+
+// Which half words of a pair of pixels are foreground, for 2 font bits.
+// Read for every 2 pixels, so kept out of flash.
+static const uint32_t __not_in_flash("font_rgb565") pair_masks[4] = {0x00000000, 0x0000FFFF, 0xFFFF0000, 0xFFFFFFFF};
+
+// Walk a row 8 characters (one colour word per plane) at a time. For each
+// character the colour nibbles give its foreground and background colours,
+// and so pixel pairs bg2 and diff = fg2 ^ bg2, and the font bits select
+// between them 2 pixels at a time.
+#define FOR_EACH_CHAR(body) \
+    for (uint x = 0; x < n_chars; x += 8) { \
+        uint32_t c0 = colourbuf[x / 8]; \
+        uint32_t c1 = colourbuf[plane_stride + x / 8]; \
+        uint32_t c2 = colourbuf[2 * plane_stride + x / 8]; \
+        uint32_t c3 = extbuf ? extbuf[x / 8] : 0; \
+        for (uint i = 0; i < 8 && x + i < n_chars; i++) { \
+            uint32_t fg = (c0 & 0x3) | (c1 & 0x3) << 2 | (c2 & 0x3) << 4 | (c3 & 0x3) << 6; \
+            uint32_t bg = (c0 & 0xC) >> 2 | (c1 & 0xC) | (c2 & 0xC) << 2 | (c3 & 0xC) << 4; \
+            c0 >>= 4; \
+            c1 >>= 4; \
+            c2 >>= 4; \
+            c3 >>= 4; \
+            uint32_t bg2 = font_palette_rgb565[bg]; \
+            uint32_t diff = font_palette_rgb565[fg] ^ bg2; \
+            uint bits = font_line[charbuf[x + i]]; \
+            body \
+        } \
+    }
+
+#define PIXELS(n) (bg2 ^ (diff & pair_masks[(bits >> (2 * (n))) & 0x3]))
+
+void __not_in_flash_func(font_expand_rgb565)(const uint8_t *charbuf, const uint32_t *colourbuf,
+                                             uint plane_stride, const uint32_t *extbuf,
+                                             uint32_t *pixbuf, uint n_chars,
+                                             const uint8_t *font_line) {
+    FOR_EACH_CHAR(
+        pixbuf[0] = PIXELS(0);
+        pixbuf[1] = PIXELS(1);
+        pixbuf[2] = PIXELS(2);
+        pixbuf[3] = PIXELS(3);
+        pixbuf += 4;
+    )
+}
+
+#if !PICO_RP2040
+// Each lane takes its channel with the MSB rotated up to bit 7
+#define SIO_TMDS_LANE(n, msb, lsb) \
+    (((msb) - (lsb)) << SIO_TMDS_CTRL_L##n##_NBITS_LSB | \
+     (((msb) - 7u) & 0xfu) << SIO_TMDS_CTRL_L##n##_ROT_LSB)
+
+// A peek encodes (and updates that lane's DC balance) without moving on to
+// the next pixels, so lanes 0 and 1 are peeked and lane 2 popped. Each
+// double read is the 2 pixels of a word.
+#define SIO_TMDS_PUSH(pixels) \
+    sio_hw->tmds_wdata = (pixels); \
+    *l0++ = sio_hw->tmds_peek_double_l0; \
+    *l1++ = sio_hw->tmds_peek_double_l1; \
+    *l2++ = sio_hw->tmds_pop_double_l2;
+
+// All 3 lanes from 16 bit pixels: a pixel shift of 2^(5 - 1)
+#define SIO_TMDS_CTRL_RGB565 \
+    (SIO_TMDS_CTRL_CLEAR_BALANCE_BITS | \
+     SIO_TMDS_LANE(0, 4, 0) | SIO_TMDS_LANE(1, 10, 5) | SIO_TMDS_LANE(2, 15, 11) | \
+     5u << SIO_TMDS_CTRL_PIX_SHIFT_LSB)
+
+void __not_in_flash_func(tmds_encode_font_sio)(const uint8_t *charbuf, const uint32_t *colourbuf,
+                                               uint plane_stride, const uint32_t *extbuf,
+                                               uint32_t *tmdsbuf, uint lane_words, uint n_chars,
+                                               const uint8_t *font_line) {
+    sio_hw->tmds_ctrl = SIO_TMDS_CTRL_RGB565;
+    uint32_t *l0 = tmdsbuf;
+    uint32_t *l1 = tmdsbuf + lane_words;
+    uint32_t *l2 = tmdsbuf + 2 * lane_words;
+    FOR_EACH_CHAR(
+        SIO_TMDS_PUSH(PIXELS(0))
+        SIO_TMDS_PUSH(PIXELS(1))
+        SIO_TMDS_PUSH(PIXELS(2))
+        SIO_TMDS_PUSH(PIXELS(3))
+    )
+}
+
+void __not_in_flash_func(tmds_encode_rgb565_sio)(const uint32_t *pixbuf, uint32_t *tmdsbuf,
+                                                 uint lane_words, uint n_pix) {
+    sio_hw->tmds_ctrl = SIO_TMDS_CTRL_RGB565;
+    uint32_t *l0 = tmdsbuf;
+    uint32_t *l1 = tmdsbuf + lane_words;
+    uint32_t *l2 = tmdsbuf + 2 * lane_words;
+    for (uint i = 0; i < n_pix / 2; i++) {
+        SIO_TMDS_PUSH(pixbuf[i])
+    }
+}
+#endif
@@ -0,0 +1,39 @@
+#ifndef _FONT_RGB565_H
+#define _FONT_RGB565_H
+
+#include "pico/types.h"
+
+// Text rendering through RGB565 pixels rather than the palette LUT of
+// tmds_encode_font_2bpp, so cells can use any of 256 colours. A cell's
+// colour is the 6-bit RGB222 value from its 3 colour plane nibbles, plus 2
+// more bits from its nibble in extbuf (bits 1:0 foreground, 3:2 background,
+// as in the other planes) in bits 7:6. A NULL extbuf reads as all zero.
+//
+// The arguments are otherwise as for tmds_encode_font_2bpp, except that the
+// 3 colour planes of the row are read plane_stride words apart, and n_chars
+// need not be a multiple of 8 (nothing is written past the end).
+
+// The pixel for each colour, in both halves of the word. Filled in by the
+// caller before anything is encoded.
+extern uint32_t font_palette_rgb565[256];
+
+// One scanline as pixels, leftmost in the low half word, 4 words per
+// character. Used for HSTX, which TMDS encodes in hardware.
+void font_expand_rgb565(const uint8_t *charbuf, const uint32_t *colourbuf, uint plane_stride,
+	const uint32_t *extbuf, uint32_t *pixbuf, uint n_chars, const uint8_t *font_line);
+
+#if !PICO_RP2040
+// The same pixels, put through the core's SIO TMDS encoder as they are
+// made, so all 3 lanes are encoded in one pass. Lane n is written to
+// tmdsbuf + n * lane_words, 2 symbols per word. Uses this core's encoder,
+// so must not interrupt anything else using it.
+void tmds_encode_font_sio(const uint8_t *charbuf, const uint32_t *colourbuf, uint plane_stride,
+	const uint32_t *extbuf, uint32_t *tmdsbuf, uint lane_words, uint n_chars,
+	const uint8_t *font_line);
+
+// Encode n_pix RGB565 pixels (2 per word, as font_expand_rgb565() writes
+// them) into all 3 lanes the same way. n_pix must be even.
+void tmds_encode_rgb565_sio(const uint32_t *pixbuf, uint32_t *tmdsbuf, uint lane_words, uint n_pix);
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef PX437_IBM_BIOS_SCANLINE_H
+#define PX437_IBM_BIOS_SCANLINE_H
+
+// Generated by font_work/pack_scanline.py from Px437_IBM_BIOS.h
+// Scanline major, leftmost pixel in bit 0, as tmds_encode_font_2bpp reads it
+
+static const uint8_t px437_ibm_bios_scanline[8 * 256] = {
+  /* line  0 */
+  0x00, 0x7E, 0x7E, 0x36, 0x08, 0x1C, 0x08, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x3C, 0xFC, 0xFE, 0x99,
+  0x01, 0x40, 0x18, 0x66, 0xFE, 0x7C, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0x36, 0x36, 0x0C, 0x00, 0x1C, 0x06, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x3E, 0x0C, 0x1E, 0x1E, 0x38, 0x3F, 0x1C, 0x3F, 0x1E, 0x1E, 0x00, 0x00, 0x18, 0x00, 0x06, 0x1E,
+  0x3E, 0x0C, 0x3F, 0x3C, 0x1F, 0x7F, 0x7F, 0x3C, 0x33, 0x1E, 0x78, 0x67, 0x0F, 0x63, 0x63, 0x1C,
+  0x3F, 0x1E, 0x3F, 0x1E, 0x3F, 0x33, 0x33, 0x63, 0x63, 0x33, 0x7F, 0x1E, 0x03, 0x1E, 0x08, 0x00,
+  0x0C, 0x00, 0x07, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x07, 0x0C, 0x30, 0x07, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x07, 0x6E, 0x00,
+  0x1E, 0x00, 0x38, 0x7E, 0x33, 0x07, 0x0C, 0x00, 0x7E, 0x33, 0x07, 0x33, 0x3E, 0x07, 0x63, 0x0C,
+  0x38, 0x00, 0x7C, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xC3, 0x33, 0x18, 0x1C, 0x33, 0x1F, 0x70,
+  0x38, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x3C, 0x1C, 0x0C, 0x00, 0x00, 0xC3, 0xC3, 0x18, 0x00, 0x00,
+  0x44, 0xAA, 0xDB, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1C, 0x1C, 0x38, 0x00, 0x60, 0x1C, 0x1E,
+  0x00, 0x0C, 0x06, 0x18, 0x70, 0x18, 0x0C, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x1E, 0x0E, 0x00, 0x00,
+  /* line  1 */
+  0x00, 0x81, 0xFF, 0x7F, 0x1C, 0x3E, 0x08, 0x00, 0xFF, 0x3C, 0x00, 0xE0, 0x66, 0xCC, 0xC6, 0x5A,
+  0x07, 0x70, 0x3C, 0x66, 0xDB, 0xC6, 0x00, 0x3C, 0x3C, 0x18, 0x18, 0x0C, 0x00, 0x24, 0x18, 0xFF,
+  0x00, 0x1E, 0x36, 0x36, 0x3E, 0x63, 0x36, 0x06, 0x0C, 0x0C, 0x66, 0x0C, 0x00, 0x00, 0x00, 0x30,
+  0x63, 0x0E, 0x33, 0x33, 0x3C, 0x03, 0x06, 0x33, 0x33, 0x33, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 0x33,
+  0x63, 0x1E, 0x66, 0x66, 0x36, 0x46, 0x46, 0x66, 0x33, 0x0C, 0x30, 0x66, 0x06, 0x77, 0x67, 0x36,
+  0x66, 0x33, 0x66, 0x33, 0x2D, 0x33, 0x33, 0x63, 0x63, 0x33, 0x63, 0x06, 0x06, 0x18, 0x1C, 0x00,
+  0x0C, 0x00, 0x06, 0x00, 0x30, 0x00, 0x36, 0x00, 0x06, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x0C, 0x3B, 0x08,
+  0x33, 0x33, 0x00, 0xC3, 0x00, 0x00, 0x0C, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x63, 0x00, 0x1C, 0x0C,
+  0x00, 0x00, 0x36, 0x33, 0x33, 0x07, 0x33, 0x07, 0x33, 0x18, 0x00, 0x18, 0x36, 0x33, 0x33, 0xD8,
+  0x00, 0x00, 0x38, 0x38, 0x1F, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x63, 0x63, 0x18, 0xCC, 0x33,
+  0x11, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x18,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x1E, 0x3F, 0x7F, 0x33, 0x00, 0x66, 0x6E, 0x0C, 0x36, 0x36, 0x0C, 0x00, 0x30, 0x06, 0x33,
+  0x3F, 0x0C, 0x0C, 0x0C, 0xD8, 0x18, 0x0C, 0x6E, 0x36, 0x00, 0x00, 0x30, 0x36, 0x18, 0x00, 0x00,
+  /* line  2 */
+  0x00, 0xA5, 0xDB, 0x7F, 0x3E, 0x1C, 0x1C, 0x18, 0xE7, 0x66, 0x00, 0xF0, 0x66, 0xFC, 0xFE, 0x3C,
+  0x1F, 0x7C, 0x7E, 0x66, 0xDB, 0x1C, 0x00, 0x7E, 0x7E, 0x18, 0x30, 0x06, 0x03, 0x66, 0x3C, 0xFF,
+  0x00, 0x1E, 0x36, 0x7F, 0x03, 0x33, 0x1C, 0x03, 0x06, 0x18, 0x3C, 0x0C, 0x00, 0x00, 0x00, 0x18,
+  0x73, 0x0C, 0x30, 0x30, 0x36, 0x1F, 0x03, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x06, 0x3F, 0x18, 0x30,
+  0x7B, 0x33, 0x66, 0x03, 0x66, 0x16, 0x16, 0x03, 0x33, 0x0C, 0x30, 0x36, 0x06, 0x7F, 0x6F, 0x63,
+  0x66, 0x33, 0x66, 0x07, 0x0C, 0x33, 0x33, 0x63, 0x36, 0x33, 0x31, 0x06, 0x0C, 0x18, 0x36, 0x00,
+  0x18, 0x1E, 0x06, 0x1E, 0x30, 0x1E, 0x06, 0x6E, 0x36, 0x0E, 0x30, 0x66, 0x0C, 0x33, 0x1F, 0x1E,
+  0x3B, 0x6E, 0x3B, 0x3E, 0x3E, 0x33, 0x33, 0x63, 0x63, 0x33, 0x3F, 0x0C, 0x18, 0x0C, 0x00, 0x1C,
+  0x03, 0x00, 0x1E, 0x3C, 0x1E, 0x1E, 0x1E, 0x1E, 0x3C, 0x1E, 0x1E, 0x0E, 0x1C, 0x0E, 0x36, 0x00,
+  0x3F, 0xFE, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x33, 0x7E, 0x26, 0x1E, 0x33, 0x18,
+  0x1E, 0x0E, 0x00, 0x00, 0x00, 0x33, 0x36, 0x36, 0x0C, 0x00, 0x00, 0x33, 0x33, 0x00, 0x66, 0x66,
+  0x44, 0xAA, 0xDB, 0x18, 0x18, 0x1F, 0x6C, 0x00, 0x1F, 0x6F, 0x6C, 0x7F, 0x6F, 0x6C, 0x1F, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0xF8, 0x6C, 0xEC, 0xFC, 0xEF, 0xFF, 0xEC, 0xFF, 0xEF, 0xFF,
+  0x6C, 0xFF, 0x00, 0x6C, 0xF8, 0xF8, 0x00, 0x6C, 0xFF, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x6E, 0x33, 0x33, 0x36, 0x06, 0x7E, 0x66, 0x3B, 0x1E, 0x63, 0x63, 0x18, 0x7E, 0x7E, 0x03, 0x33,
+  0x00, 0x3F, 0x18, 0x06, 0xD8, 0x18, 0x00, 0x3B, 0x36, 0x00, 0x00, 0x30, 0x36, 0x0C, 0x3C, 0x00,
+  /* line  3 */
+  0x00, 0x81, 0xFF, 0x7F, 0x7F, 0x7F, 0x3E, 0x3C, 0xC3, 0x42, 0x00, 0xBE, 0x66, 0x0C, 0xC6, 0xE7,
+  0x7F, 0x7F, 0x18, 0x66, 0xDE, 0x36, 0x00, 0x18, 0x18, 0x18, 0x7F, 0x7F, 0x03, 0xFF, 0x7E, 0x7E,
+  0x00, 0x0C, 0x00, 0x36, 0x1E, 0x18, 0x6E, 0x00, 0x06, 0x18, 0xFF, 0x3F, 0x00, 0x3F, 0x00, 0x0C,
+  0x7B, 0x0C, 0x1C, 0x1C, 0x33, 0x30, 0x1F, 0x18, 0x1E, 0x3E, 0x00, 0x00, 0x03, 0x00, 0x30, 0x18,
+  0x7B, 0x33, 0x3E, 0x03, 0x66, 0x1E, 0x1E, 0x03, 0x3F, 0x0C, 0x30, 0x1E, 0x06, 0x7F, 0x7B, 0x63,
+  0x3E, 0x33, 0x3E, 0x0E, 0x0C, 0x33, 0x33, 0x6B, 0x1C, 0x1E, 0x18, 0x06, 0x18, 0x18, 0x63, 0x00,
+  0x00, 0x30, 0x3E, 0x33, 0x3E, 0x33, 0x0F, 0x33, 0x6E, 0x0C, 0x30, 0x36, 0x0C, 0x7F, 0x33, 0x33,
+  0x66, 0x33, 0x6E, 0x03, 0x0C, 0x33, 0x33, 0x6B, 0x36, 0x33, 0x19, 0x07, 0x00, 0x38, 0x00, 0x36,
+  0x33, 0x33, 0x33, 0x60, 0x30, 0x30, 0x30, 0x03, 0x66, 0x33, 0x33, 0x0C, 0x18, 0x0C, 0x63, 0x1E,
+  0x06, 0x30, 0x7F, 0x1E, 0x1E, 0x1E, 0x33, 0x33, 0x33, 0x66, 0x33, 0x03, 0x0F, 0x3F, 0x5F, 0x3C,
+  0x30, 0x0C, 0x1E, 0x33, 0x1F, 0x37, 0x7C, 0x1C, 0x06, 0x3F, 0x3F, 0x7B, 0xDB, 0x18, 0x33, 0xCC,
+  0x11, 0x55, 0x77, 0x18, 0x18, 0x18, 0x6C, 0x00, 0x18, 0x60, 0x6C, 0x60, 0x60, 0x6C, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  0x6C, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x00, 0x6C, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0xFF,
+  0x3B, 0x1F, 0x03, 0x36, 0x0C, 0x1B, 0x66, 0x18, 0x33, 0x7F, 0x63, 0x3E, 0xDB, 0xDB, 0x1F, 0x33,
+  0x3F, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x3F, 0x00, 0x1C, 0x18, 0x00, 0x30, 0x36, 0x06, 0x3C, 0x00,
+  /* line  4 */
+  0x00, 0xBD, 0xC3, 0x3E, 0x3E, 0x7F, 0x7F, 0x3C, 0xC3, 0x42, 0x00, 0x33, 0x3C, 0x0C, 0xC6, 0xE7,
+  0x1F, 0x7C, 0x18, 0x66, 0xD8, 0x36, 0x7E, 0x7E, 0x18, 0x7E, 0x30, 0x06, 0x03, 0x66, 0xFF, 0x3C,
+  0x00, 0x0C, 0x00, 0x7F, 0x30, 0x0C, 0x3B, 0x00, 0x06, 0x18, 0x3C, 0x0C, 0x00, 0x00, 0x00, 0x06,
+  0x6F, 0x0C, 0x06, 0x30, 0x7F, 0x30, 0x33, 0x0C, 0x33, 0x30, 0x00, 0x00, 0x06, 0x00, 0x18, 0x0C,
+  0x7B, 0x3F, 0x66, 0x03, 0x66, 0x16, 0x16, 0x73, 0x33, 0x0C, 0x33, 0x36, 0x46, 0x6B, 0x73, 0x63,
+  0x06, 0x3B, 0x36, 0x38, 0x0C, 0x33, 0x33, 0x7F, 0x1C, 0x0C, 0x4C, 0x06, 0x30, 0x18, 0x00, 0x00,
+  0x00, 0x3E, 0x66, 0x03, 0x33, 0x3F, 0x06, 0x33, 0x66, 0x0C, 0x30, 0x1E, 0x0C, 0x7F, 0x33, 0x33,
+  0x66, 0x33, 0x66, 0x1E, 0x0C, 0x33, 0x33, 0x7F, 0x1C, 0x33, 0x0C, 0x0C, 0x18, 0x0C, 0x00, 0x63,
+  0x1E, 0x33, 0x3F, 0x7C, 0x3E, 0x3E, 0x3E, 0x03, 0x7E, 0x3F, 0x3F, 0x0C, 0x18, 0x0C, 0x7F, 0x33,
+  0x1E, 0xFE, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x33, 0x03, 0x06, 0x0C, 0x63, 0x18,
+  0x3E, 0x0C, 0x33, 0x33, 0x33, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x30, 0xCC, 0xEC, 0x18, 0x66, 0x66,
+  0x44, 0xAA, 0xDB, 0x18, 0x1F, 0x1F, 0x6F, 0x7F, 0x1F, 0x6F, 0x6C, 0x6F, 0x7F, 0x7F, 0x1F, 0x1F,
+  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xEC, 0xFC, 0xEC, 0xFF, 0xEF, 0xEC, 0xFF, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x13, 0x33, 0x03, 0x36, 0x06, 0x1B, 0x66, 0x18, 0x33, 0x63, 0x36, 0x33, 0xDB, 0xDB, 0x03, 0x33,
+  0x00, 0x0C, 0x06, 0x18, 0x18, 0x18, 0x00, 0x6E, 0x00, 0x18, 0x18, 0x37, 0x36, 0x1E, 0x3C, 0x00,
+  /* line  5 */
+  0x00, 0x99, 0xE7, 0x1C, 0x1C, 0x3E, 0x3E, 0x18, 0xE7, 0x66, 0x00, 0x33, 0x18, 0x0E, 0xE6, 0x3C,
+  0x07, 0x70, 0x7E, 0x00, 0xD8, 0x1C, 0x7E, 0x3C, 0x18, 0x3C, 0x18, 0x0C, 0x7F, 0x24, 0xFF, 0x18,
+  0x00, 0x00, 0x00, 0x36, 0x1F, 0x66, 0x33, 0x00, 0x0C, 0x0C, 0x66, 0x0C, 0x0C, 0x00, 0x0C, 0x03,
+  0x67, 0x0C, 0x33, 0x33, 0x30, 0x33, 0x33, 0x0C, 0x33, 0x18, 0x0C, 0x0C, 0x0C, 0x3F, 0x0C, 0x00,
+  0x03, 0x33, 0x66, 0x66, 0x36, 0x46, 0x06, 0x66, 0x33, 0x0C, 0x33, 0x66, 0x66, 0x63, 0x63, 0x36,
+  0x06, 0x1E, 0x66, 0x33, 0x0C, 0x33, 0x1E, 0x77, 0x36, 0x0C, 0x66, 0x06, 0x60, 0x18, 0x00, 0x00,
+  0x00, 0x33, 0x66, 0x33, 0x33, 0x03, 0x06, 0x3E, 0x66, 0x0C, 0x33, 0x36, 0x0C, 0x6B, 0x33, 0x33,
+  0x3E, 0x3E, 0x06, 0x30, 0x2C, 0x33, 0x1E, 0x7F, 0x36, 0x3E, 0x26, 0x0C, 0x18, 0x0C, 0x00, 0x63,
+  0x18, 0x33, 0x03, 0x66, 0x33, 0x33, 0x33, 0x1E, 0x06, 0x03, 0x03, 0x0C, 0x18, 0x0C, 0x63, 0x3F,
+  0x06, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3C, 0x33, 0x7E, 0x67, 0x3F, 0xF3, 0x18,
+  0x33, 0x0C, 0x33, 0x33, 0x33, 0x3B, 0x7E, 0x3E, 0x33, 0x03, 0x30, 0x66, 0xF6, 0x18, 0xCC, 0x33,
+  0x11, 0x55, 0xEE, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x3B, 0x1F, 0x03, 0x36, 0x33, 0x1B, 0x3E, 0x18, 0x1E, 0x36, 0x36, 0x33, 0x7E, 0x7E, 0x06, 0x33,
+  0x3F, 0x00, 0x00, 0x00, 0x18, 0x1B, 0x0C, 0x3B, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x3C, 0x00,
+  /* line  6 */
+  0x00, 0x81, 0xFF, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0xFF, 0x3C, 0x00, 0x33, 0x7E, 0x0F, 0x67, 0x5A,
+  0x01, 0x40, 0x3C, 0x66, 0xD8, 0x33, 0x7E, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0x00, 0x36, 0x0C, 0x63, 0x6E, 0x00, 0x18, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x01,
+  0x3E, 0x3F, 0x3F, 0x1E, 0x78, 0x1E, 0x1E, 0x0C, 0x1E, 0x0E, 0x0C, 0x0C, 0x18, 0x00, 0x06, 0x0C,
+  0x1E, 0x33, 0x3F, 0x3C, 0x1F, 0x7F, 0x0F, 0x7C, 0x33, 0x1E, 0x1E, 0x67, 0x7F, 0x63, 0x63, 0x1C,
+  0x0F, 0x38, 0x67, 0x1E, 0x1E, 0x3F, 0x0C, 0x63, 0x63, 0x1E, 0x7F, 0x1E, 0x40, 0x1E, 0x00, 0x00,
+  0x00, 0x6E, 0x3B, 0x1E, 0x6E, 0x1E, 0x0F, 0x30, 0x67, 0x1E, 0x33, 0x67, 0x1E, 0x63, 0x33, 0x1E,
+  0x06, 0x30, 0x0F, 0x1F, 0x18, 0x6E, 0x0C, 0x36, 0x63, 0x30, 0x3F, 0x38, 0x18, 0x07, 0x00, 0x7F,
+  0x30, 0x7E, 0x1E, 0xFC, 0x7E, 0x7E, 0x7E, 0x30, 0x3C, 0x1E, 0x1E, 0x1E, 0x3C, 0x1E, 0x63, 0x33,
+  0x3F, 0xFE, 0x73, 0x1E, 0x1E, 0x1E, 0x7E, 0x7E, 0x30, 0x18, 0x1E, 0x18, 0x3F, 0x0C, 0x63, 0x1B,
+  0x7E, 0x1E, 0x1E, 0x7E, 0x33, 0x33, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x33, 0xF3, 0x18, 0x00, 0x00,
+  0x44, 0xAA, 0xDB, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x6E, 0x03, 0x03, 0x36, 0x3F, 0x0E, 0x06, 0x18, 0x0C, 0x1C, 0x77, 0x1E, 0x00, 0x06, 0x1C, 0x33,
+  0x00, 0x3F, 0x3F, 0x3F, 0x18, 0x1B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  /* line  7 */
+  0x00, 0x7E, 0x7E, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x18, 0x07, 0x03, 0x99,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x1E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x0C, 0xE3, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC0, 0x00, 0x00, 0x00,
+  0x11, 0x55, 0x77, 0x18, 0x18, 0x18, 0x6C, 0x6C, 0x18, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x6C, 0x00, 0x6C, 0x00,
+  0x00, 0x18, 0x6C, 0x00, 0x00, 0x18, 0x6C, 0x6C, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Bit n set: line n of the glyph is empty
+static const uint16_t px437_ibm_bios_blank_lines[256] = {
+  0x00FF, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000, 0x0000, 0x00C3,
+  0x0000, 0x0081, 0x00FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0080, 0x0080, 0x0000, 0x00A0, 0x0080, 0x0000, 0x008F, 0x0000,
+  0x0080, 0x0080, 0x00C1, 0x00C1, 0x00C3, 0x00C1, 0x00C1, 0x00C1,
+  0x00FF, 0x00A0, 0x00F8, 0x0080, 0x0080, 0x0081, 0x0080, 0x00F8,
+  0x0080, 0x0080, 0x00C1, 0x00C1, 0x001F, 0x00F7, 0x009F, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0099, 0x0019, 0x0080, 0x00DB, 0x0080, 0x00A0,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x00F0, 0x007F,
+  0x00F8, 0x0083, 0x0080, 0x0083, 0x0080, 0x0083, 0x0080, 0x0003,
+  0x0080, 0x0082, 0x0002, 0x0080, 0x0080, 0x0083, 0x0083, 0x0083,
+  0x0003, 0x0003, 0x0083, 0x0083, 0x0080, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0003, 0x0083, 0x0080, 0x0088, 0x0080, 0x00FC, 0x0081,
+  0x0000, 0x0085, 0x0082, 0x0080, 0x0082, 0x0082, 0x0080, 0x0003,
+  0x0080, 0x0082, 0x0082, 0x0082, 0x0080, 0x0082, 0x0080, 0x0084,
+  0x0082, 0x0083, 0x0080, 0x0084, 0x0085, 0x0085, 0x0084, 0x0085,
+  0x0005, 0x0080, 0x0082, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000,
+  0x0082, 0x0082, 0x0085, 0x0085, 0x0085, 0x0082, 0x00D0, 0x00D0,
+  0x0082, 0x00C7, 0x00C7, 0x0000, 0x0000, 0x0084, 0x00C1, 0x00C1,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000F,
+  0x0003, 0x0000, 0x0000, 0x0003, 0x00E0, 0x00E0, 0x00E0, 0x000F,
+  0x00E0, 0x00E0, 0x000F, 0x0000, 0x00EF, 0x0000, 0x0000, 0x0000,
+  0x00E0, 0x0003, 0x00E8, 0x000B, 0x0000, 0x00EB, 0x0008, 0x00E8,
+  0x00E0, 0x000B, 0x000F, 0x00E0, 0x00E0, 0x0003, 0x000F, 0x0000,
+  0x0000, 0x00E0, 0x000F, 0x0000, 0x000F, 0x0000, 0x0000, 0x00F0,
+  0x0083, 0x0001, 0x0081, 0x0081, 0x0080, 0x0083, 0x0001, 0x0081,
+  0x0000, 0x0080, 0x0080, 0x0080, 0x00C3, 0x0000, 0x0080, 0x0080,
+  0x00D5, 0x00A0, 0x00A0, 0x00A0, 0x0000, 0x0000, 0x0094, 0x00C9,
+  0x00F0, 0x00E7, 0x00EF, 0x0000, 0x00E0, 0x00E0, 0x00C3, 0x00FF,
+};
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef FONT_8X8_H
+#define FONT_8X8_H
+
+// Font: PxPlus IBM VGA 8x16
+// Total characters: 256
+
+static const uint8_t font_8x8[256][8] = {
+  /*   0 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 0: ''\x00''
+  /*   1 */ { 0x7E, 0x81, 0xA5, 0x81, 0xBD, 0x99, 0x81, 0x7E }, // Index 1: ''\x01''
+  /*   2 */ { 0x7E, 0xFF, 0xDB, 0xFF, 0xC3, 0xE7, 0xFF, 0x7E }, // Index 2: ''\x02''
+  /*   3 */ { 0x6C, 0xFE, 0xFE, 0xFE, 0x7C, 0x38, 0x10, 0x00 }, // Index 3: ''\x03''
+  /*   4 */ { 0x10, 0x38, 0x7C, 0xFE, 0x7C, 0x38, 0x10, 0x00 }, // Index 4: ''\x04''
+  /*   5 */ { 0x38, 0x7C, 0x38, 0xFE, 0xFE, 0x7C, 0x38, 0x7C }, // Index 5: ''\x05''
+  /*   6 */ { 0x10, 0x10, 0x38, 0x7C, 0xFE, 0x7C, 0x38, 0x7C }, // Index 6: ''\x06''
+  /*   7 */ { 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00 }, // Index 7: ''\x07''
+  /*   8 */ { 0xFF, 0xFF, 0xE7, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF }, // Index 8: ''\x08''
+  /*   9 */ { 0x00, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x00 }, // Index 9: ''\t''
+  /*  10 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 10: ''\n''
+  /*  11 */ { 0x0F, 0x07, 0x0F, 0x7D, 0xCC, 0xCC, 0xCC, 0x78 }, // Index 11: ''\x0b''
+  /*  12 */ { 0x3C, 0x66, 0x66, 0x66, 0x3C, 0x18, 0x7E, 0x18 }, // Index 12: ''\x0c''
+  /*  13 */ { 0x3F, 0x33, 0x3F, 0x30, 0x30, 0x70, 0xF0, 0xE0 }, // Index 13: ''\r''
+  /*  14 */ { 0x7F, 0x63, 0x7F, 0x63, 0x63, 0x67, 0xE6, 0xC0 }, // Index 14: ''\x0e''
+  /*  15 */ { 0x99, 0x5A, 0x3C, 0xE7, 0xE7, 0x3C, 0x5A, 0x99 }, // Index 15: ''\x0f''
+  /*  16 */ { 0x80, 0xE0, 0xF8, 0xFE, 0xF8, 0xE0, 0x80, 0x00 }, // Index 16: ''\x10''
+  /*  17 */ { 0x02, 0x0E, 0x3E, 0xFE, 0x3E, 0x0E, 0x02, 0x00 }, // Index 17: ''\x11''
+  /*  18 */ { 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x7E, 0x3C, 0x18 }, // Index 18: ''\x12''
+  /*  19 */ { 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x00 }, // Index 19: ''\x13''
+  /*  20 */ { 0x7F, 0xDB, 0xDB, 0x7B, 0x1B, 0x1B, 0x1B, 0x00 }, // Index 20: ''\x14''
+  /*  21 */ { 0x3E, 0x63, 0x38, 0x6C, 0x6C, 0x38, 0xCC, 0x78 }, // Index 21: ''\x15''
+  /*  22 */ { 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x00 }, // Index 22: ''\x16''
+  /*  23 */ { 0x18, 0x3C, 0x7E, 0x18, 0x7E, 0x3C, 0x18, 0xFF }, // Index 23: ''\x17''
+  /*  24 */ { 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x00 }, // Index 24: ''\x18''
+  /*  25 */ { 0x18, 0x18, 0x18, 0x18, 0x7E, 0x3C, 0x18, 0x00 }, // Index 25: ''\x19''
+  /*  26 */ { 0x00, 0x18, 0x0C, 0xFE, 0x0C, 0x18, 0x00, 0x00 }, // Index 26: ''\x1a''
+  /*  27 */ { 0x00, 0x30, 0x60, 0xFE, 0x60, 0x30, 0x00, 0x00 }, // Index 27: ''\x1b''
+  /*  28 */ { 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFE, 0x00, 0x00 }, // Index 28: ''\x1c''
+  /*  29 */ { 0x00, 0x24, 0x66, 0xFF, 0x66, 0x24, 0x00, 0x00 }, // Index 29: ''\x1d''
+  /*  30 */ { 0x00, 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x00, 0x00 }, // Index 30: ''\x1e''
+  /*  31 */ { 0x00, 0xFF, 0xFF, 0x7E, 0x3C, 0x18, 0x00, 0x00 }, // Index 31: ''\x1f''
+  /*  32 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 32: '' ''
+  /*  33 */ { 0x30, 0x78, 0x78, 0x30, 0x30, 0x00, 0x30, 0x00 }, // Index 33: ''!''
+  /*  34 */ { 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 34: ''"''
+  /*  35 */ { 0x6C, 0x6C, 0xFE, 0x6C, 0xFE, 0x6C, 0x6C, 0x00 }, // Index 35: ''#''
+  /*  36 */ { 0x30, 0x7C, 0xC0, 0x78, 0x0C, 0xF8, 0x30, 0x00 }, // Index 36: ''$''
+  /*  37 */ { 0x00, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0x00 }, // Index 37: ''%''
+  /*  38 */ { 0x38, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0x76, 0x00 }, // Index 38: ''&''
+  /*  39 */ { 0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 39: '"'"'
+  /*  40 */ { 0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00 }, // Index 40: ''(''
+  /*  41 */ { 0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00 }, // Index 41: '')''
+  /*  42 */ { 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00 }, // Index 42: ''*''
+  /*  43 */ { 0x00, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x00, 0x00 }, // Index 43: ''+''
+  /*  44 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x60 }, // Index 44: '',''
+  /*  45 */ { 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00 }, // Index 45: ''-''
+  /*  46 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00 }, // Index 46: ''.''
+  /*  47 */ { 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00 }, // Index 47: ''/''
+  /*  48 */ { 0x7C, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0x7C, 0x00 }, // Index 48: ''0''
+  /*  49 */ { 0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00 }, // Index 49: ''1''
+  /*  50 */ { 0x78, 0xCC, 0x0C, 0x38, 0x60, 0xCC, 0xFC, 0x00 }, // Index 50: ''2''
+  /*  51 */ { 0x78, 0xCC, 0x0C, 0x38, 0x0C, 0xCC, 0x78, 0x00 }, // Index 51: ''3''
+  /*  52 */ { 0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x1E, 0x00 }, // Index 52: ''4''
+  /*  53 */ { 0xFC, 0xC0, 0xF8, 0x0C, 0x0C, 0xCC, 0x78, 0x00 }, // Index 53: ''5''
+  /*  54 */ { 0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0x78, 0x00 }, // Index 54: ''6''
+  /*  55 */ { 0xFC, 0xCC, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00 }, // Index 55: ''7''
+  /*  56 */ { 0x78, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0x78, 0x00 }, // Index 56: ''8''
+  /*  57 */ { 0x78, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 0x00 }, // Index 57: ''9''
+  /*  58 */ { 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00 }, // Index 58: '':''
+  /*  59 */ { 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x60 }, // Index 59: '';''
+  /*  60 */ { 0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x00 }, // Index 60: ''<''
+  /*  61 */ { 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00 }, // Index 61: ''=''
+  /*  62 */ { 0x60, 0x30, 0x18, 0x0C, 0x18, 0x30, 0x60, 0x00 }, // Index 62: ''>''
+  /*  63 */ { 0x78, 0xCC, 0x0C, 0x18, 0x30, 0x00, 0x30, 0x00 }, // Index 63: ''?''
+  /*  64 */ { 0x7C, 0xC6, 0xDE, 0xDE, 0xDE, 0xC0, 0x78, 0x00 }, // Index 64: ''@''
+  /*  65 */ { 0x30, 0x78, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0x00 }, // Index 65: ''A''
+  /*  66 */ { 0xFC, 0x66, 0x66, 0x7C, 0x66, 0x66, 0xFC, 0x00 }, // Index 66: ''B''
+  /*  67 */ { 0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x3C, 0x00 }, // Index 67: ''C''
+  /*  68 */ { 0xF8, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00 }, // Index 68: ''D''
+  /*  69 */ { 0xFE, 0x62, 0x68, 0x78, 0x68, 0x62, 0xFE, 0x00 }, // Index 69: ''E''
+  /*  70 */ { 0xFE, 0x62, 0x68, 0x78, 0x68, 0x60, 0xF0, 0x00 }, // Index 70: ''F''
+  /*  71 */ { 0x3C, 0x66, 0xC0, 0xC0, 0xCE, 0x66, 0x3E, 0x00 }, // Index 71: ''G''
+  /*  72 */ { 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0x00 }, // Index 72: ''H''
+  /*  73 */ { 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 73: ''I''
+  /*  74 */ { 0x1E, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78, 0x00 }, // Index 74: ''J''
+  /*  75 */ { 0xE6, 0x66, 0x6C, 0x78, 0x6C, 0x66, 0xE6, 0x00 }, // Index 75: ''K''
+  /*  76 */ { 0xF0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE, 0x00 }, // Index 76: ''L''
+  /*  77 */ { 0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0x00 }, // Index 77: ''M''
+  /*  78 */ { 0xC6, 0xE6, 0xF6, 0xDE, 0xCE, 0xC6, 0xC6, 0x00 }, // Index 78: ''N''
+  /*  79 */ { 0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00 }, // Index 79: ''O''
+  /*  80 */ { 0xFC, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xF0, 0x00 }, // Index 80: ''P''
+  /*  81 */ { 0x78, 0xCC, 0xCC, 0xCC, 0xDC, 0x78, 0x1C, 0x00 }, // Index 81: ''Q''
+  /*  82 */ { 0xFC, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0xE6, 0x00 }, // Index 82: ''R''
+  /*  83 */ { 0x78, 0xCC, 0xE0, 0x70, 0x1C, 0xCC, 0x78, 0x00 }, // Index 83: ''S''
+  /*  84 */ { 0xFC, 0xB4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 84: ''T''
+  /*  85 */ { 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0x00 }, // Index 85: ''U''
+  /*  86 */ { 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00 }, // Index 86: ''V''
+  /*  87 */ { 0xC6, 0xC6, 0xC6, 0xD6, 0xFE, 0xEE, 0xC6, 0x00 }, // Index 87: ''W''
+  /*  88 */ { 0xC6, 0xC6, 0x6C, 0x38, 0x38, 0x6C, 0xC6, 0x00 }, // Index 88: ''X''
+  /*  89 */ { 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x78, 0x00 }, // Index 89: ''Y''
+  /*  90 */ { 0xFE, 0xC6, 0x8C, 0x18, 0x32, 0x66, 0xFE, 0x00 }, // Index 90: ''Z''
+  /*  91 */ { 0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x00 }, // Index 91: ''[''
+  /*  92 */ { 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00 }, // Index 92: ''\\''
+  /*  93 */ { 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00 }, // Index 93: '']''
+  /*  94 */ { 0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00 }, // Index 94: ''^''
+  /*  95 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF }, // Index 95: ''_''
+  /*  96 */ { 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 96: ''`''
+  /*  97 */ { 0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x76, 0x00 }, // Index 97: ''a''
+  /*  98 */ { 0xE0, 0x60, 0x60, 0x7C, 0x66, 0x66, 0xDC, 0x00 }, // Index 98: ''b''
+  /*  99 */ { 0x00, 0x00, 0x78, 0xCC, 0xC0, 0xCC, 0x78, 0x00 }, // Index 99: ''c''
+  /* 100 */ { 0x1C, 0x0C, 0x0C, 0x7C, 0xCC, 0xCC, 0x76, 0x00 }, // Index 100: ''d''
+  /* 101 */ { 0x00, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00 }, // Index 101: ''e''
+  /* 102 */ { 0x38, 0x6C, 0x60, 0xF0, 0x60, 0x60, 0xF0, 0x00 }, // Index 102: ''f''
+  /* 103 */ { 0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8 }, // Index 103: ''g''
+  /* 104 */ { 0xE0, 0x60, 0x6C, 0x76, 0x66, 0x66, 0xE6, 0x00 }, // Index 104: ''h''
+  /* 105 */ { 0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 105: ''i''
+  /* 106 */ { 0x0C, 0x00, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78 }, // Index 106: ''j''
+  /* 107 */ { 0xE0, 0x60, 0x66, 0x6C, 0x78, 0x6C, 0xE6, 0x00 }, // Index 107: ''k''
+  /* 108 */ { 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 108: ''l''
+  /* 109 */ { 0x00, 0x00, 0xCC, 0xFE, 0xFE, 0xD6, 0xC6, 0x00 }, // Index 109: ''m''
+  /* 110 */ { 0x00, 0x00, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0x00 }, // Index 110: ''n''
+  /* 111 */ { 0x00, 0x00, 0x78, 0xCC, 0xCC, 0xCC, 0x78, 0x00 }, // Index 111: ''o''
+  /* 112 */ { 0x00, 0x00, 0xDC, 0x66, 0x66, 0x7C, 0x60, 0xF0 }, // Index 112: ''p''
+  /* 113 */ { 0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0x1E }, // Index 113: ''q''
+  /* 114 */ { 0x00, 0x00, 0xDC, 0x76, 0x66, 0x60, 0xF0, 0x00 }, // Index 114: ''r''
+  /* 115 */ { 0x00, 0x00, 0x7C, 0xC0, 0x78, 0x0C, 0xF8, 0x00 }, // Index 115: ''s''
+  /* 116 */ { 0x10, 0x30, 0x7C, 0x30, 0x30, 0x34, 0x18, 0x00 }, // Index 116: ''t''
+  /* 117 */ { 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00 }, // Index 117: ''u''
+  /* 118 */ { 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00 }, // Index 118: ''v''
+  /* 119 */ { 0x00, 0x00, 0xC6, 0xD6, 0xFE, 0xFE, 0x6C, 0x00 }, // Index 119: ''w''
+  /* 120 */ { 0x00, 0x00, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0x00 }, // Index 120: ''x''
+  /* 121 */ { 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8 }, // Index 121: ''y''
+  /* 122 */ { 0x00, 0x00, 0xFC, 0x98, 0x30, 0x64, 0xFC, 0x00 }, // Index 122: ''z''
+  /* 123 */ { 0x1C, 0x30, 0x30, 0xE0, 0x30, 0x30, 0x1C, 0x00 }, // Index 123: ''{''
+  /* 124 */ { 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 }, // Index 124: ''|''
+  /* 125 */ { 0xE0, 0x30, 0x30, 0x1C, 0x30, 0x30, 0xE0, 0x00 }, // Index 125: ''}''
+  /* 126 */ { 0x76, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 126: ''~''
+  /* 127 */ { 0x00, 0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0x00 }, // Index 127: ''\x7f''
+  /* 128 */ { 0x78, 0xCC, 0xC0, 0xCC, 0x78, 0x18, 0x0C, 0x78 }, // Index 128: ''Ç''
+  /* 129 */ { 0x00, 0xCC, 0x00, 0xCC, 0xCC, 0xCC, 0x7E, 0x00 }, // Index 129: ''ü''
+  /* 130 */ { 0x1C, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00 }, // Index 130: ''é''
+  /* 131 */ { 0x7E, 0xC3, 0x3C, 0x06, 0x3E, 0x66, 0x3F, 0x00 }, // Index 131: ''â''
+  /* 132 */ { 0xCC, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x7E, 0x00 }, // Index 132: ''ä''
+  /* 133 */ { 0xE0, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x7E, 0x00 }, // Index 133: ''à''
+  /* 134 */ { 0x30, 0x30, 0x78, 0x0C, 0x7C, 0xCC, 0x7E, 0x00 }, // Index 134: ''å''
+  /* 135 */ { 0x00, 0x00, 0x78, 0xC0, 0xC0, 0x78, 0x0C, 0x38 }, // Index 135: ''ç''
+  /* 136 */ { 0x7E, 0xC3, 0x3C, 0x66, 0x7E, 0x60, 0x3C, 0x00 }, // Index 136: ''ê''
+  /* 137 */ { 0xCC, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00 }, // Index 137: ''ë''
+  /* 138 */ { 0xE0, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00 }, // Index 138: ''è''
+  /* 139 */ { 0xCC, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 139: ''ï''
+  /* 140 */ { 0x7C, 0xC6, 0x38, 0x18, 0x18, 0x18, 0x3C, 0x00 }, // Index 140: ''î''
+  /* 141 */ { 0xE0, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 141: ''ì''
+  /* 142 */ { 0xC6, 0x38, 0x6C, 0xC6, 0xFE, 0xC6, 0xC6, 0x00 }, // Index 142: ''Ä''
+  /* 143 */ { 0x30, 0x30, 0x00, 0x78, 0xCC, 0xFC, 0xCC, 0x00 }, // Index 143: ''Å''
+  /* 144 */ { 0x1C, 0x00, 0xFC, 0x60, 0x78, 0x60, 0xFC, 0x00 }, // Index 144: ''É''
+  /* 145 */ { 0x00, 0x00, 0x7F, 0x0C, 0x7F, 0xCC, 0x7F, 0x00 }, // Index 145: ''æ''
+  /* 146 */ { 0x3E, 0x6C, 0xCC, 0xFE, 0xCC, 0xCC, 0xCE, 0x00 }, // Index 146: ''Æ''
+  /* 147 */ { 0x78, 0xCC, 0x00, 0x78, 0xCC, 0xCC, 0x78, 0x00 }, // Index 147: ''ô''
+  /* 148 */ { 0x00, 0xCC, 0x00, 0x78, 0xCC, 0xCC, 0x78, 0x00 }, // Index 148: ''ö''
+  /* 149 */ { 0x00, 0xE0, 0x00, 0x78, 0xCC, 0xCC, 0x78, 0x00 }, // Index 149: ''ò''
+  /* 150 */ { 0x78, 0xCC, 0x00, 0xCC, 0xCC, 0xCC, 0x7E, 0x00 }, // Index 150: ''û''
+  /* 151 */ { 0x00, 0xE0, 0x00, 0xCC, 0xCC, 0xCC, 0x7E, 0x00 }, // Index 151: ''ù''
+  /* 152 */ { 0x00, 0xCC, 0x00, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8 }, // Index 152: ''ÿ''
+  /* 153 */ { 0xC3, 0x18, 0x3C, 0x66, 0x66, 0x3C, 0x18, 0x00 }, // Index 153: ''Ö''
+  /* 154 */ { 0xCC, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x00 }, // Index 154: ''Ü''
+  /* 155 */ { 0x18, 0x18, 0x7E, 0xC0, 0xC0, 0x7E, 0x18, 0x18 }, // Index 155: ''¢''
+  /* 156 */ { 0x38, 0x6C, 0x64, 0xF0, 0x60, 0xE6, 0xFC, 0x00 }, // Index 156: ''£''
+  /* 157 */ { 0xCC, 0xCC, 0x78, 0xFC, 0x30, 0xFC, 0x30, 0x30 }, // Index 157: ''¥''
+  /* 158 */ { 0xF8, 0xCC, 0xCC, 0xFA, 0xC6, 0xCF, 0xC6, 0xC7 }, // Index 158: ''₧''
+  /* 159 */ { 0x0E, 0x1B, 0x18, 0x3C, 0x18, 0x18, 0xD8, 0x70 }, // Index 159: ''ƒ''
+  /* 160 */ { 0x1C, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x7E, 0x00 }, // Index 160: ''á''
+  /* 161 */ { 0x38, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00 }, // Index 161: ''í''
+  /* 162 */ { 0x00, 0x1C, 0x00, 0x78, 0xCC, 0xCC, 0x78, 0x00 }, // Index 162: ''ó''
+  /* 163 */ { 0x00, 0x1C, 0x00, 0xCC, 0xCC, 0xCC, 0x7E, 0x00 }, // Index 163: ''ú''
+  /* 164 */ { 0x00, 0xF8, 0x00, 0xF8, 0xCC, 0xCC, 0xCC, 0x00 }, // Index 164: ''ñ''
+  /* 165 */ { 0xFC, 0x00, 0xCC, 0xEC, 0xFC, 0xDC, 0xCC, 0x00 }, // Index 165: ''Ñ''
+  /* 166 */ { 0x3C, 0x6C, 0x6C, 0x3E, 0x00, 0x7E, 0x00, 0x00 }, // Index 166: ''ª''
+  /* 167 */ { 0x38, 0x6C, 0x6C, 0x38, 0x00, 0x7C, 0x00, 0x00 }, // Index 167: ''º''
+  /* 168 */ { 0x30, 0x00, 0x30, 0x60, 0xC0, 0xCC, 0x78, 0x00 }, // Index 168: ''¿''
+  /* 169 */ { 0x00, 0x00, 0x00, 0xFC, 0xC0, 0xC0, 0x00, 0x00 }, // Index 169: ''⌐''
+  /* 170 */ { 0x00, 0x00, 0x00, 0xFC, 0x0C, 0x0C, 0x00, 0x00 }, // Index 170: ''¬''
+  /* 171 */ { 0xC3, 0xC6, 0xCC, 0xDE, 0x33, 0x66, 0xCC, 0x0F }, // Index 171: ''½''
+  /* 172 */ { 0xC3, 0xC6, 0xCC, 0xDB, 0x37, 0x6F, 0xCF, 0x03 }, // Index 172: ''¼''
+  /* 173 */ { 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00 }, // Index 173: ''¡''
+  /* 174 */ { 0x00, 0x33, 0x66, 0xCC, 0x66, 0x33, 0x00, 0x00 }, // Index 174: ''«''
+  /* 175 */ { 0x00, 0xCC, 0x66, 0x33, 0x66, 0xCC, 0x00, 0x00 }, // Index 175: ''»''
+  /* 176 */ { 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88 }, // Index 176: ''░''
+  /* 177 */ { 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA }, // Index 177: ''▒''
+  /* 178 */ { 0xDB, 0x77, 0xDB, 0xEE, 0xDB, 0x77, 0xDB, 0xEE }, // Index 178: ''▓''
+  /* 179 */ { 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 }, // Index 179: ''│''
+  /* 180 */ { 0x18, 0x18, 0x18, 0x18, 0xF8, 0x18, 0x18, 0x18 }, // Index 180: ''┤''
+  /* 181 */ { 0x18, 0x18, 0xF8, 0x18, 0xF8, 0x18, 0x18, 0x18 }, // Index 181: ''╡''
+  /* 182 */ { 0x36, 0x36, 0x36, 0x36, 0xF6, 0x36, 0x36, 0x36 }, // Index 182: ''╢''
+  /* 183 */ { 0x00, 0x00, 0x00, 0x00, 0xFE, 0x36, 0x36, 0x36 }, // Index 183: ''╖''
+  /* 184 */ { 0x00, 0x00, 0xF8, 0x18, 0xF8, 0x18, 0x18, 0x18 }, // Index 184: ''╕''
+  /* 185 */ { 0x36, 0x36, 0xF6, 0x06, 0xF6, 0x36, 0x36, 0x36 }, // Index 185: ''╣''
+  /* 186 */ { 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36 }, // Index 186: ''║''
+  /* 187 */ { 0x00, 0x00, 0xFE, 0x06, 0xF6, 0x36, 0x36, 0x36 }, // Index 187: ''╗''
+  /* 188 */ { 0x36, 0x36, 0xF6, 0x06, 0xFE, 0x00, 0x00, 0x00 }, // Index 188: ''╝''
+  /* 189 */ { 0x36, 0x36, 0x36, 0x36, 0xFE, 0x00, 0x00, 0x00 }, // Index 189: ''╜''
+  /* 190 */ { 0x18, 0x18, 0xF8, 0x18, 0xF8, 0x00, 0x00, 0x00 }, // Index 190: ''╛''
+  /* 191 */ { 0x00, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x18, 0x18 }, // Index 191: ''┐''
+  /* 192 */ { 0x18, 0x18, 0x18, 0x18, 0x1F, 0x00, 0x00, 0x00 }, // Index 192: ''└''
+  /* 193 */ { 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00 }, // Index 193: ''┴''
+  /* 194 */ { 0x00, 0x00, 0x00, 0x00, 0xFF, 0x18, 0x18, 0x18 }, // Index 194: ''┬''
+  /* 195 */ { 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x18, 0x18 }, // Index 195: ''├''
+  /* 196 */ { 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00 }, // Index 196: ''─''
+  /* 197 */ { 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18 }, // Index 197: ''┼''
+  /* 198 */ { 0x18, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x18, 0x18 }, // Index 198: ''╞''
+  /* 199 */ { 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36 }, // Index 199: ''╟''
+  /* 200 */ { 0x36, 0x36, 0x37, 0x30, 0x3F, 0x00, 0x00, 0x00 }, // Index 200: ''╚''
+  /* 201 */ { 0x00, 0x00, 0x3F, 0x30, 0x37, 0x36, 0x36, 0x36 }, // Index 201: ''╔''
+  /* 202 */ { 0x36, 0x36, 0xF7, 0x00, 0xFF, 0x00, 0x00, 0x00 }, // Index 202: ''╩''
+  /* 203 */ { 0x00, 0x00, 0xFF, 0x00, 0xF7, 0x36, 0x36, 0x36 }, // Index 203: ''╦''
+  /* 204 */ { 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36 }, // Index 204: ''╠''
+  /* 205 */ { 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00 }, // Index 205: ''═''
+  /* 206 */ { 0x36, 0x36, 0xF7, 0x00, 0xF7, 0x36, 0x36, 0x36 }, // Index 206: ''╬''
+  /* 207 */ { 0x18, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00 }, // Index 207: ''╧''
+  /* 208 */ { 0x36, 0x36, 0x36, 0x36, 0xFF, 0x00, 0x00, 0x00 }, // Index 208: ''╨''
+  /* 209 */ { 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x18, 0x18, 0x18 }, // Index 209: ''╤''
+  /* 210 */ { 0x00, 0x00, 0x00, 0x00, 0xFF, 0x36, 0x36, 0x36 }, // Index 210: ''╥''
+  /* 211 */ { 0x36, 0x36, 0x36, 0x36, 0x3F, 0x00, 0x00, 0x00 }, // Index 211: ''╙''
+  /* 212 */ { 0x18, 0x18, 0x1F, 0x18, 0x1F, 0x00, 0x00, 0x00 }, // Index 212: ''╘''
+  /* 213 */ { 0x00, 0x00, 0x1F, 0x18, 0x1F, 0x18, 0x18, 0x18 }, // Index 213: ''╒''
+  /* 214 */ { 0x00, 0x00, 0x00, 0x00, 0x3F, 0x36, 0x36, 0x36 }, // Index 214: ''╓''
+  /* 215 */ { 0x36, 0x36, 0x36, 0x36, 0xFF, 0x36, 0x36, 0x36 }, // Index 215: ''╫''
+  /* 216 */ { 0x18, 0x18, 0xFF, 0x18, 0xFF, 0x18, 0x18, 0x18 }, // Index 216: ''╪''
+  /* 217 */ { 0x18, 0x18, 0x18, 0x18, 0xF8, 0x00, 0x00, 0x00 }, // Index 217: ''┘''
+  /* 218 */ { 0x00, 0x00, 0x00, 0x00, 0x1F, 0x18, 0x18, 0x18 }, // Index 218: ''┌''
+  /* 219 */ { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, // Index 219: ''█''
+  /* 220 */ { 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF }, // Index 220: ''▄''
+  /* 221 */ { 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0 }, // Index 221: ''▌''
+  /* 222 */ { 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F }, // Index 222: ''▐''
+  /* 223 */ { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 }, // Index 223: ''▀''
+  /* 224 */ { 0x00, 0x00, 0x76, 0xDC, 0xC8, 0xDC, 0x76, 0x00 }, // Index 224: ''α''
+  /* 225 */ { 0x00, 0x78, 0xCC, 0xF8, 0xCC, 0xF8, 0xC0, 0xC0 }, // Index 225: ''ß''
+  /* 226 */ { 0x00, 0xFC, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0x00 }, // Index 226: ''Γ''
+  /* 227 */ { 0x00, 0xFE, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x00 }, // Index 227: ''π''
+  /* 228 */ { 0xFC, 0xCC, 0x60, 0x30, 0x60, 0xCC, 0xFC, 0x00 }, // Index 228: ''Σ''
+  /* 229 */ { 0x00, 0x00, 0x7E, 0xD8, 0xD8, 0xD8, 0x70, 0x00 }, // Index 229: ''σ''
+  /* 230 */ { 0x00, 0x66, 0x66, 0x66, 0x66, 0x7C, 0x60, 0xC0 }, // Index 230: ''µ''
+  /* 231 */ { 0x00, 0x76, 0xDC, 0x18, 0x18, 0x18, 0x18, 0x00 }, // Index 231: ''τ''
+  /* 232 */ { 0xFC, 0x30, 0x78, 0xCC, 0xCC, 0x78, 0x30, 0xFC }, // Index 232: ''Φ''
+  /* 233 */ { 0x38, 0x6C, 0xC6, 0xFE, 0xC6, 0x6C, 0x38, 0x00 }, // Index 233: ''Θ''
+  /* 234 */ { 0x38, 0x6C, 0xC6, 0xC6, 0x6C, 0x6C, 0xEE, 0x00 }, // Index 234: ''Ω''
+  /* 235 */ { 0x1C, 0x30, 0x18, 0x7C, 0xCC, 0xCC, 0x78, 0x00 }, // Index 235: ''δ''
+  /* 236 */ { 0x00, 0x00, 0x7E, 0xDB, 0xDB, 0x7E, 0x00, 0x00 }, // Index 236: ''∞''
+  /* 237 */ { 0x06, 0x0C, 0x7E, 0xDB, 0xDB, 0x7E, 0x60, 0xC0 }, // Index 237: ''φ''
+  /* 238 */ { 0x38, 0x60, 0xC0, 0xF8, 0xC0, 0x60, 0x38, 0x00 }, // Index 238: ''ε''
+  /* 239 */ { 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00 }, // Index 239: ''∩''
+  /* 240 */ { 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00 }, // Index 240: ''≡''
+  /* 241 */ { 0x30, 0x30, 0xFC, 0x30, 0x30, 0x00, 0xFC, 0x00 }, // Index 241: ''±''
+  /* 242 */ { 0x60, 0x30, 0x18, 0x30, 0x60, 0x00, 0xFC, 0x00 }, // Index 242: ''≥''
+  /* 243 */ { 0x18, 0x30, 0x60, 0x30, 0x18, 0x00, 0xFC, 0x00 }, // Index 243: ''≤''
+  /* 244 */ { 0x0E, 0x1B, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18 }, // Index 244: ''⌠''
+  /* 245 */ { 0x18, 0x18, 0x18, 0x18, 0x18, 0xD8, 0xD8, 0x70 }, // Index 245: ''⌡''
+  /* 246 */ { 0x30, 0x30, 0x00, 0xFC, 0x00, 0x30, 0x30, 0x00 }, // Index 246: ''÷''
+  /* 247 */ { 0x00, 0x76, 0xDC, 0x00, 0x76, 0xDC, 0x00, 0x00 }, // Index 247: ''≈''
+  /* 248 */ { 0x38, 0x6C, 0x6C, 0x38, 0x00, 0x00, 0x00, 0x00 }, // Index 248: ''°''
+  /* 249 */ { 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 }, // Index 249: ''∙''
+  /* 250 */ { 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00 }, // Index 250: ''·''
+  /* 251 */ { 0x0F, 0x0C, 0x0C, 0x0C, 0xEC, 0x6C, 0x3C, 0x1C }, // Index 251: ''√''
+  /* 252 */ { 0x78, 0x6C, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00 }, // Index 252: ''ⁿ''
+  /* 253 */ { 0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00 }, // Index 253: ''²''
+  /* 254 */ { 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00 }, // Index 254: ''■''
+  /* 255 */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Index 255: ''\xa0''
+};
+#endif
@@ -0,0 +1,318 @@
+#ifndef TAMZEN8X16B_SCANLINE_H
+#define TAMZEN8X16B_SCANLINE_H
+
+// Generated by font_work/pack_scanline.py from Tamzen8x16b.h
+// Scanline major, leftmost pixel in bit 0, as tmds_encode_font_2bpp reads it
+
+static const uint8_t tamzen8x16b_scanline[16 * 256] = {
+  /* line  0 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3C,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  1 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x6C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x66, 0x66,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4C, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  2 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x36, 0x00, 0x18, 0x00, 0x1C, 0x18, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x06, 0x3E, 0x18, 0x00,
+  0x18, 0x00, 0x06, 0x00, 0x60, 0x00, 0x78, 0x00, 0x06, 0x18, 0x30, 0x06, 0x1E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xCC, 0x00,
+  0x00, 0x66, 0x30, 0x3C, 0x66, 0x0C, 0x6C, 0x00, 0x3C, 0x66, 0x0C, 0x66, 0x3C, 0x0C, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0x3C, 0x66, 0x30, 0x3C, 0x0C, 0x66, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x30, 0x30, 0x30, 0x7E, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  3 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x3C, 0x36, 0x6C, 0x18, 0x1C, 0x36, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0x3C, 0x18, 0x3C, 0x7E, 0x60, 0x7E, 0x18, 0x7E, 0x3C, 0x3C, 0x00, 0x00, 0x60, 0x00, 0x06, 0x62,
+  0xC6, 0x18, 0x3E, 0x78, 0x1E, 0x7E, 0x7E, 0x78, 0x66, 0x7E, 0x60, 0xC6, 0x06, 0xC6, 0xC6, 0x3C,
+  0x3E, 0x3C, 0x3E, 0x7C, 0xFF, 0x66, 0x66, 0xC6, 0x66, 0x66, 0x7E, 0x0C, 0x06, 0x30, 0x3C, 0x00,
+  0x30, 0x00, 0x06, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x06, 0x18, 0x30, 0x06, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xDE, 0x00,
+  0x78, 0x66, 0x18, 0x66, 0x66, 0x18, 0x38, 0x00, 0x66, 0x66, 0x18, 0x66, 0x66, 0x18, 0x18, 0x3C,
+  0x7E, 0x00, 0xF8, 0x66, 0x66, 0x18, 0x66, 0x18, 0x66, 0x3C, 0x66, 0x18, 0x38, 0x66, 0x00, 0x00,
+  0x18, 0x18, 0x18, 0x18, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  4 */
+  0x7E, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00,
+  0x00, 0x3C, 0x36, 0x6C, 0x7C, 0xB6, 0x36, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60,
+  0x66, 0x1C, 0x66, 0x60, 0x70, 0x06, 0x0C, 0x60, 0x66, 0x66, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x60,
+  0xC6, 0x3C, 0x66, 0x0C, 0x36, 0x06, 0x06, 0x0C, 0x66, 0x18, 0x60, 0x66, 0x06, 0xEE, 0xCE, 0x66,
+  0x66, 0x66, 0x66, 0x06, 0x18, 0x66, 0x66, 0xC6, 0x66, 0x66, 0x30, 0x0C, 0x0C, 0x30, 0x66, 0x00,
+  0x60, 0x00, 0x06, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xF6, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x18,
+  0x06, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x3C, 0x6C, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  5 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x3C, 0x00, 0xFE, 0x06, 0x76, 0x36, 0x00, 0x0C, 0x30, 0x6C, 0x18, 0x00, 0x00, 0x00, 0x60,
+  0x76, 0x1E, 0x60, 0x30, 0x78, 0x06, 0x06, 0x30, 0x66, 0x66, 0x38, 0x38, 0x18, 0x00, 0x18, 0x60,
+  0xF6, 0x66, 0x66, 0x06, 0x66, 0x06, 0x06, 0x06, 0x66, 0x18, 0x60, 0x36, 0x06, 0xFE, 0xDE, 0x66,
+  0x66, 0x66, 0x66, 0x06, 0x18, 0x66, 0x66, 0xC6, 0x66, 0x66, 0x30, 0x0C, 0x0C, 0x30, 0x00, 0x00,
+  0x00, 0x3C, 0x3E, 0x7C, 0x7C, 0x3C, 0x7E, 0xFC, 0x3E, 0x1E, 0x3C, 0x66, 0x18, 0x7E, 0x3E, 0x3C,
+  0x3E, 0x7C, 0x76, 0x7C, 0x7E, 0x66, 0x66, 0xD6, 0x66, 0x66, 0x7E, 0x18, 0x18, 0x18, 0x66, 0x00,
+  0x06, 0x66, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C, 0x3C, 0x3C, 0x1E, 0x1E, 0x1E, 0x66, 0x3C,
+  0x06, 0x6E, 0x36, 0x3C, 0x3C, 0x3C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x0C, 0x3C, 0x00, 0x00,
+  0x3C, 0x1E, 0x3C, 0x66, 0x3E, 0xCE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  6 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x18, 0x00, 0x6C, 0x06, 0x3C, 0x1C, 0x00, 0x0C, 0x30, 0x38, 0x18, 0x00, 0x00, 0x00, 0x30,
+  0x76, 0x18, 0x60, 0x38, 0x6C, 0x3E, 0x3E, 0x30, 0x66, 0x66, 0x38, 0x38, 0x0C, 0x7E, 0x30, 0x30,
+  0xD6, 0x66, 0x66, 0x06, 0x66, 0x06, 0x06, 0x06, 0x66, 0x18, 0x60, 0x1E, 0x06, 0xD6, 0xF6, 0x66,
+  0x66, 0x66, 0x66, 0x0E, 0x18, 0x66, 0x66, 0xC6, 0x3C, 0x3C, 0x18, 0x0C, 0x18, 0x30, 0x00, 0x00,
+  0x00, 0x60, 0x66, 0x06, 0x66, 0x66, 0x0C, 0x66, 0x66, 0x18, 0x30, 0x36, 0x18, 0xD6, 0x66, 0x66,
+  0x66, 0x66, 0x0E, 0x06, 0x0C, 0x66, 0x66, 0xD6, 0x66, 0x66, 0x60, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x06, 0x66, 0x66, 0x60, 0x60, 0x60, 0x60, 0x06, 0x66, 0x66, 0x66, 0x18, 0x18, 0x18, 0x66, 0x66,
+  0x06, 0xD8, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x0C, 0x18, 0x00, 0x00,
+  0x60, 0x18, 0x66, 0x66, 0x66, 0xDE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  7 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x18, 0x00, 0x6C, 0x3C, 0x10, 0x9C, 0x00, 0x0C, 0x30, 0xFE, 0xFF, 0x00, 0x7E, 0x00, 0x30,
+  0x66, 0x18, 0x30, 0x60, 0x66, 0x60, 0x66, 0x18, 0x3C, 0x66, 0x00, 0x00, 0x06, 0x00, 0x60, 0x18,
+  0xD6, 0x66, 0x3E, 0x06, 0x66, 0x3E, 0x3E, 0x06, 0x7E, 0x18, 0x60, 0x0E, 0x06, 0xC6, 0xE6, 0x66,
+  0x3E, 0x66, 0x3E, 0x3C, 0x18, 0x66, 0x66, 0xC6, 0x18, 0x18, 0x18, 0x0C, 0x18, 0x30, 0x00, 0x00,
+  0x00, 0x60, 0x66, 0x06, 0x66, 0x66, 0x0C, 0x66, 0x66, 0x18, 0x30, 0x1E, 0x18, 0xD6, 0x66, 0x66,
+  0x66, 0x66, 0x06, 0x0E, 0x0C, 0x66, 0x66, 0xD6, 0x3C, 0x66, 0x30, 0x0F, 0x18, 0xF0, 0x00, 0x00,
+  0x06, 0x66, 0x66, 0x7C, 0x7C, 0x7C, 0x7C, 0x06, 0x66, 0x66, 0x66, 0x18, 0x18, 0x18, 0x66, 0x66,
+  0x3E, 0xDE, 0xF6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x3E, 0x7E, 0x00, 0x00,
+  0x7C, 0x18, 0x66, 0x66, 0x66, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  8 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x00, 0x00, 0x6C, 0x60, 0x78, 0xB6, 0x00, 0x0C, 0x30, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18,
+  0x6E, 0x18, 0x18, 0x60, 0xFE, 0x60, 0x66, 0x18, 0x66, 0x7C, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x00,
+  0xD6, 0x7E, 0x66, 0x06, 0x66, 0x06, 0x06, 0x66, 0x66, 0x18, 0x60, 0x1E, 0x06, 0xC6, 0xC6, 0x66,
+  0x06, 0x66, 0x36, 0x70, 0x18, 0x66, 0x66, 0xD6, 0x3C, 0x18, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00,
+  0x00, 0x7C, 0x66, 0x06, 0x66, 0x7E, 0x0C, 0x66, 0x66, 0x18, 0x30, 0x1E, 0x18, 0xD6, 0x66, 0x66,
+  0x66, 0x66, 0x06, 0x3C, 0x0C, 0x66, 0x66, 0xD6, 0x18, 0x66, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x06, 0x66, 0x7E, 0x66, 0x66, 0x66, 0x66, 0x06, 0x7E, 0x7E, 0x7E, 0x18, 0x18, 0x18, 0x7E, 0x7E,
+  0x06, 0xFB, 0x3E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x0C, 0x18, 0x00, 0x00,
+  0x66, 0x18, 0x66, 0x66, 0x66, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  9 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x00, 0x00, 0xFE, 0x60, 0xDC, 0x66, 0x00, 0x0C, 0x30, 0x6C, 0x18, 0x00, 0x00, 0x00, 0x18,
+  0x6E, 0x18, 0x0C, 0x60, 0x60, 0x60, 0x66, 0x0C, 0x66, 0x60, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x00,
+  0xF6, 0x66, 0x66, 0x06, 0x66, 0x06, 0x06, 0x66, 0x66, 0x18, 0x66, 0x36, 0x06, 0xC6, 0xC6, 0x66,
+  0x06, 0x66, 0x66, 0x60, 0x18, 0x66, 0x66, 0xFE, 0x66, 0x18, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00,
+  0x00, 0x66, 0x66, 0x06, 0x66, 0x06, 0x0C, 0x3C, 0x66, 0x18, 0x30, 0x36, 0x18, 0xD6, 0x66, 0x66,
+  0x66, 0x66, 0x06, 0x70, 0x0C, 0x66, 0x66, 0xD6, 0x3C, 0x66, 0x0C, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x06, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x18, 0x18, 0x18, 0x66, 0x66,
+  0x06, 0x1B, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x0C, 0x7E, 0x00, 0x00,
+  0x66, 0x18, 0x66, 0x66, 0x66, 0xC6, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0xD8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 10 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x18, 0x00, 0x6C, 0x3E, 0xDA, 0x66, 0x00, 0x0C, 0x30, 0x00, 0x18, 0x38, 0x00, 0x38, 0x0C,
+  0x66, 0x18, 0x06, 0x66, 0x60, 0x66, 0x66, 0x0C, 0x66, 0x30, 0x38, 0x38, 0x30, 0x00, 0x0C, 0x18,
+  0xF6, 0x66, 0x66, 0x0C, 0x36, 0x06, 0x06, 0x6C, 0x66, 0x18, 0x66, 0x66, 0x06, 0xC6, 0xC6, 0x66,
+  0x06, 0x66, 0x66, 0x60, 0x18, 0x66, 0x3C, 0xEE, 0x66, 0x18, 0x06, 0x0C, 0x60, 0x30, 0x00, 0x00,
+  0x00, 0x66, 0x66, 0x06, 0x66, 0x06, 0x0C, 0x06, 0x66, 0x18, 0x30, 0x66, 0x18, 0xD6, 0x66, 0x66,
+  0x66, 0x66, 0x06, 0x60, 0x0C, 0x66, 0x3C, 0xD6, 0x66, 0x66, 0x06, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x0C, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x18, 0x18, 0x18, 0x66, 0x66,
+  0x06, 0x1B, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x0C, 0x18, 0x00, 0x00,
+  0x66, 0x18, 0x66, 0x66, 0x66, 0xC6, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x6C, 0x6C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 11 */
+  0x7E, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x18, 0x00, 0x6C, 0x18, 0x70, 0xDC, 0x00, 0x18, 0x18, 0x00, 0x00, 0x38, 0x00, 0x38, 0x0C,
+  0x3C, 0x7E, 0x7E, 0x3C, 0x60, 0x3C, 0x3C, 0x0C, 0x3C, 0x18, 0x38, 0x38, 0x60, 0x00, 0x06, 0x18,
+  0x06, 0x66, 0x3E, 0x78, 0x1E, 0x7E, 0x06, 0x78, 0x66, 0x7E, 0x3C, 0xC6, 0x7E, 0xC6, 0xC6, 0x3C,
+  0x06, 0x3C, 0x66, 0x3E, 0x18, 0x3C, 0x18, 0xC6, 0x66, 0x18, 0x7E, 0x0C, 0x60, 0x30, 0x00, 0x00,
+  0x00, 0x7C, 0x3E, 0x7C, 0x7C, 0x7C, 0x0C, 0x7C, 0x66, 0x7E, 0x30, 0xC6, 0x70, 0xD6, 0x66, 0x3C,
+  0x3E, 0x7C, 0x06, 0x3E, 0x78, 0x7C, 0x18, 0x7E, 0x66, 0x7C, 0x7E, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x78, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x7E, 0x7E, 0x66, 0x66,
+  0x7E, 0xF6, 0x76, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7C, 0x3C, 0x3C, 0x18, 0x7E, 0x18, 0x00, 0x00,
+  0x7C, 0x7E, 0x3C, 0x7C, 0x66, 0xC6, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xD8, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 12 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 13 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC0, 0x3E, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x70, 0x18, 0x0E, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 14 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 15 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Bit n set: line n of the glyph is empty
+static const uint16_t tamzen8x16b_blank_lines[256] = {
+  0xF00F, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF07,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFF00, 0x007F, 0x007F, 0xFF00, 0x0000,
+  0xFFFF, 0xFFFF, 0xFF7F, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFF00,
+  0x007F, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF007, 0xFFFF,
+  0xFFFF, 0xF303, 0xFFE1, 0xF007, 0xE003, 0xF007, 0xF003, 0xFFE1,
+  0xC003, 0xC003, 0xFC1F, 0xF80F, 0x83FF, 0xFF7F, 0xF3FF, 0xC003,
+  0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF39F, 0x839F, 0xF007, 0xFDBF, 0xF007, 0xF303,
+  0xC003, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xE007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF007, 0xC003, 0xC003, 0xC003, 0xFFE3, 0xDFFF,
+  0xFFE1, 0xF01F, 0xF003, 0xF01F, 0xF003, 0xF01F, 0xF003, 0x801F,
+  0xF003, 0xF013, 0x8013, 0xF003, 0xF003, 0xF01F, 0xF01F, 0xF01F,
+  0x801F, 0x801F, 0xF01F, 0xF01F, 0xF007, 0xF01F, 0xF01F, 0xF01F,
+  0xF01F, 0x801F, 0xF01F, 0xC001, 0xC001, 0xC001, 0xFFC3, 0xFFFF,
+  0x8007, 0xF013, 0xF013, 0xF011, 0xF013, 0xF013, 0xF010, 0x801F,
+  0xF011, 0xF013, 0xF013, 0xF013, 0xF011, 0xF013, 0xF004, 0xF000,
+  0xF004, 0xF01F, 0xF007, 0xF011, 0xF013, 0xF013, 0xF011, 0xF013,
+  0x8013, 0xF004, 0xF004, 0xE003, 0xF007, 0xF007, 0xFFFF, 0xFFFF,
+  0xF013, 0xF013, 0xF013, 0xF013, 0xF011, 0xF008, 0xFFFF, 0xFFFF,
+  0x819F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x819F, 0xF07F, 0xF07F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xF007, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF94F, 0xFFFF,
+  0xFF07, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+#endif
@@ -0,0 +1,318 @@
+#ifndef TAMZEN8X16R_SCANLINE_H
+#define TAMZEN8X16R_SCANLINE_H
+
+// Generated by font_work/pack_scanline.py from Tamzen8x16r.h
+// Scanline major, leftmost pixel in bit 0, as tmds_encode_font_2bpp reads it
+
+static const uint8_t tamzen8x16r_scanline[16 * 256] = {
+  /* line  0 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  1 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x24, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x24,
+  0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4C, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  2 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x24, 0x00, 0x10, 0x00, 0x0C, 0x08, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x02, 0x1E, 0x08, 0x00,
+  0x08, 0x00, 0x02, 0x00, 0x40, 0x00, 0x70, 0x00, 0x02, 0x10, 0x20, 0x02, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x10, 0x8C, 0x00,
+  0x00, 0x24, 0x20, 0x24, 0x24, 0x04, 0x24, 0x00, 0x24, 0x24, 0x04, 0x24, 0x24, 0x08, 0x00, 0x24,
+  0x00, 0x00, 0x00, 0x24, 0x24, 0x08, 0x24, 0x04, 0x24, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x20, 0x20, 0x20, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  3 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x08, 0x24, 0x24, 0x10, 0x0C, 0x12, 0x08, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x3C, 0x10, 0x3C, 0x7E, 0x20, 0x7E, 0x38, 0x7E, 0x3C, 0x3C, 0x00, 0x00, 0x20, 0x00, 0x04, 0x42,
+  0x44, 0x18, 0x3E, 0x78, 0x1E, 0x7E, 0x7E, 0x78, 0x42, 0x7C, 0x40, 0x42, 0x02, 0x82, 0x42, 0x3C,
+  0x3E, 0x3C, 0x3E, 0x7C, 0xFE, 0x42, 0x42, 0x82, 0x82, 0x82, 0x7E, 0x08, 0x02, 0x10, 0x14, 0x00,
+  0x10, 0x00, 0x02, 0x00, 0x40, 0x00, 0x08, 0x00, 0x02, 0x10, 0x20, 0x02, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x10, 0x92, 0x00,
+  0x78, 0x24, 0x10, 0x00, 0x24, 0x08, 0x18, 0x00, 0x00, 0x24, 0x08, 0x24, 0x00, 0x10, 0x18, 0x18,
+  0x7E, 0x00, 0xF0, 0x00, 0x24, 0x10, 0x00, 0x08, 0x24, 0x38, 0x42, 0x10, 0x38, 0x82, 0x00, 0x00,
+  0x10, 0x10, 0x10, 0x10, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  4 */
+  0x7E, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+  0x00, 0x08, 0x24, 0x24, 0x78, 0x92, 0x12, 0x08, 0x10, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20,
+  0x42, 0x18, 0x42, 0x20, 0x30, 0x02, 0x04, 0x40, 0x42, 0x42, 0x00, 0x00, 0x10, 0x00, 0x08, 0x40,
+  0x82, 0x24, 0x42, 0x04, 0x22, 0x02, 0x02, 0x04, 0x42, 0x10, 0x40, 0x22, 0x02, 0xC6, 0x46, 0x42,
+  0x42, 0x42, 0x42, 0x02, 0x10, 0x42, 0x42, 0x82, 0x82, 0x82, 0x20, 0x08, 0x04, 0x10, 0x22, 0x00,
+  0x20, 0x00, 0x02, 0x00, 0x40, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x10, 0x62, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+  0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x42, 0x38, 0x44, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  5 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x08, 0x00, 0x7E, 0x04, 0x52, 0x12, 0x00, 0x08, 0x10, 0x24, 0x10, 0x00, 0x00, 0x00, 0x20,
+  0x62, 0x14, 0x40, 0x10, 0x28, 0x02, 0x02, 0x20, 0x42, 0x42, 0x18, 0x18, 0x08, 0x00, 0x10, 0x20,
+  0xF2, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x02, 0x42, 0x10, 0x40, 0x12, 0x02, 0xAA, 0x4A, 0x42,
+  0x42, 0x42, 0x42, 0x02, 0x10, 0x42, 0x42, 0x82, 0x44, 0x44, 0x10, 0x08, 0x04, 0x10, 0x00, 0x00,
+  0x00, 0x3C, 0x3A, 0x3C, 0x5C, 0x3C, 0x7E, 0x7C, 0x3A, 0x1C, 0x38, 0x22, 0x08, 0x6E, 0x3A, 0x3C,
+  0x3A, 0x5C, 0x3A, 0x7C, 0x7E, 0x42, 0x42, 0x82, 0x82, 0x42, 0x7E, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x02, 0x42, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1C, 0x1C, 0x1C, 0x24, 0x24,
+  0x02, 0x6C, 0x28, 0x3C, 0x3C, 0x3C, 0x42, 0x42, 0x42, 0x82, 0x42, 0x44, 0x04, 0x28, 0x00, 0x00,
+  0x3C, 0x1C, 0x3C, 0x42, 0x3E, 0x4A, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  6 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x08, 0x00, 0x24, 0x04, 0x2C, 0x0C, 0x00, 0x08, 0x10, 0x18, 0x10, 0x00, 0x00, 0x00, 0x10,
+  0x52, 0x10, 0x40, 0x38, 0x24, 0x3E, 0x02, 0x20, 0x42, 0x42, 0x18, 0x18, 0x04, 0x7E, 0x20, 0x10,
+  0x8A, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x02, 0x42, 0x10, 0x40, 0x0A, 0x02, 0x92, 0x52, 0x42,
+  0x42, 0x42, 0x42, 0x04, 0x10, 0x42, 0x42, 0x82, 0x28, 0x28, 0x10, 0x08, 0x08, 0x10, 0x00, 0x00,
+  0x00, 0x40, 0x46, 0x42, 0x62, 0x42, 0x08, 0x22, 0x46, 0x10, 0x20, 0x12, 0x08, 0x92, 0x46, 0x42,
+  0x46, 0x62, 0x46, 0x02, 0x08, 0x42, 0x42, 0x92, 0x44, 0x42, 0x20, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x02, 0x42, 0x42, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x42, 0x42, 0x10, 0x10, 0x10, 0x24, 0x24,
+  0x02, 0x90, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x82, 0x42, 0x02, 0x04, 0x10, 0x00, 0x00,
+  0x40, 0x10, 0x42, 0x42, 0x42, 0x52, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  7 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xF0, 0xF0, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x08, 0x00, 0x24, 0x38, 0x10, 0x8C, 0x00, 0x08, 0x10, 0x7E, 0xFE, 0x00, 0x7E, 0x00, 0x10,
+  0x4A, 0x10, 0x20, 0x40, 0x22, 0x40, 0x3E, 0x10, 0x3C, 0x7C, 0x00, 0x00, 0x02, 0x00, 0x40, 0x08,
+  0x8A, 0x42, 0x3E, 0x02, 0x42, 0x3E, 0x3E, 0x62, 0x7E, 0x10, 0x40, 0x06, 0x02, 0x92, 0x62, 0x42,
+  0x3E, 0x42, 0x3E, 0x18, 0x10, 0x42, 0x42, 0x92, 0x10, 0x10, 0x08, 0x08, 0x08, 0x10, 0x00, 0x00,
+  0x00, 0x40, 0x42, 0x02, 0x42, 0x42, 0x08, 0x22, 0x42, 0x10, 0x20, 0x0A, 0x08, 0x92, 0x42, 0x42,
+  0x42, 0x42, 0x02, 0x04, 0x08, 0x42, 0x42, 0x92, 0x28, 0x42, 0x10, 0x07, 0x10, 0xE0, 0x00, 0x00,
+  0x02, 0x42, 0x42, 0x40, 0x40, 0x40, 0x40, 0x02, 0x42, 0x42, 0x42, 0x10, 0x10, 0x10, 0x24, 0x24,
+  0x3E, 0x9C, 0xE4, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x82, 0x42, 0x02, 0x1F, 0x7C, 0x00, 0x00,
+  0x40, 0x10, 0x42, 0x42, 0x42, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  8 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x40, 0x68, 0x92, 0x00, 0x08, 0x10, 0x18, 0x10, 0x00, 0x00, 0x00, 0x08,
+  0x46, 0x10, 0x10, 0x40, 0x7E, 0x40, 0x42, 0x10, 0x42, 0x40, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00,
+  0x8A, 0x7E, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42, 0x42, 0x10, 0x40, 0x0A, 0x02, 0x82, 0x42, 0x42,
+  0x02, 0x42, 0x12, 0x20, 0x10, 0x42, 0x24, 0x92, 0x28, 0x10, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x00, 0x7C, 0x42, 0x02, 0x42, 0x7E, 0x08, 0x22, 0x42, 0x10, 0x20, 0x0E, 0x08, 0x92, 0x42, 0x42,
+  0x42, 0x42, 0x02, 0x18, 0x08, 0x42, 0x24, 0x92, 0x10, 0x42, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x02, 0x42, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x02, 0x7E, 0x7E, 0x7E, 0x10, 0x10, 0x10, 0x7E, 0x7E,
+  0x02, 0xF2, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x82, 0x42, 0x02, 0x04, 0x10, 0x00, 0x00,
+  0x7C, 0x10, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line  9 */
+  0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0x40, 0x94, 0x62, 0x00, 0x08, 0x10, 0x24, 0x10, 0x00, 0x00, 0x00, 0x08,
+  0x42, 0x10, 0x08, 0x40, 0x20, 0x40, 0x42, 0x08, 0x42, 0x40, 0x00, 0x00, 0x08, 0x7E, 0x10, 0x00,
+  0xCA, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42, 0x42, 0x10, 0x42, 0x12, 0x02, 0x82, 0x42, 0x42,
+  0x02, 0x42, 0x22, 0x40, 0x10, 0x42, 0x24, 0x92, 0x44, 0x10, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x00, 0x42, 0x42, 0x02, 0x42, 0x02, 0x08, 0x1C, 0x42, 0x10, 0x20, 0x12, 0x08, 0x92, 0x42, 0x42,
+  0x42, 0x42, 0x02, 0x20, 0x08, 0x42, 0x24, 0x92, 0x28, 0x42, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x02, 0x42, 0x02, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 0x10, 0x42, 0x42,
+  0x02, 0x12, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x82, 0x42, 0x44, 0x04, 0x7C, 0x00, 0x00,
+  0x42, 0x10, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x48,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 10 */
+  0x42, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00,
+  0x00, 0x08, 0x00, 0x24, 0x3C, 0x92, 0x62, 0x00, 0x08, 0x10, 0x00, 0x10, 0x18, 0x00, 0x18, 0x04,
+  0x42, 0x10, 0x04, 0x42, 0x20, 0x42, 0x42, 0x08, 0x42, 0x20, 0x18, 0x18, 0x10, 0x00, 0x08, 0x08,
+  0xB2, 0x42, 0x42, 0x04, 0x22, 0x02, 0x02, 0x44, 0x42, 0x10, 0x42, 0x22, 0x02, 0x82, 0x42, 0x42,
+  0x02, 0x42, 0x42, 0x40, 0x10, 0x42, 0x18, 0xAA, 0x82, 0x10, 0x04, 0x08, 0x20, 0x10, 0x00, 0x00,
+  0x00, 0x62, 0x46, 0x42, 0x62, 0x02, 0x08, 0x02, 0x42, 0x10, 0x20, 0x22, 0x08, 0x92, 0x42, 0x42,
+  0x46, 0x62, 0x02, 0x40, 0x08, 0x62, 0x18, 0x92, 0x44, 0x62, 0x02, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x04, 0x42, 0x02, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x02, 0x10, 0x10, 0x10, 0x42, 0x42,
+  0x02, 0x12, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x38, 0x4E, 0x10, 0x00, 0x00,
+  0x42, 0x10, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 11 */
+  0x7E, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+  0x00, 0x08, 0x00, 0x24, 0x10, 0x60, 0x9C, 0x00, 0x10, 0x08, 0x00, 0x00, 0x18, 0x00, 0x18, 0x04,
+  0x3C, 0x7C, 0x7E, 0x3C, 0x20, 0x3C, 0x3C, 0x08, 0x3C, 0x1C, 0x18, 0x18, 0x20, 0x00, 0x04, 0x08,
+  0x02, 0x42, 0x3E, 0x78, 0x1E, 0x7E, 0x02, 0x78, 0x42, 0x7C, 0x3C, 0x42, 0x7E, 0x82, 0x42, 0x3C,
+  0x02, 0x3C, 0x42, 0x3E, 0x10, 0x3C, 0x18, 0xC6, 0x82, 0x10, 0x7E, 0x08, 0x20, 0x10, 0x00, 0x00,
+  0x00, 0x5C, 0x3A, 0x3C, 0x5C, 0x7C, 0x08, 0x3C, 0x42, 0x7C, 0x20, 0x42, 0x70, 0x92, 0x42, 0x3C,
+  0x3A, 0x5C, 0x02, 0x3E, 0x70, 0x5C, 0x18, 0x6C, 0x82, 0x5C, 0x7E, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x78, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x42, 0x42,
+  0x7E, 0xEC, 0xE2, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7C, 0x38, 0x3C, 0x10, 0x31, 0x10, 0x00, 0x00,
+  0x7C, 0x7C, 0x3C, 0x7C, 0x42, 0x42, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 12 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x08, 0x10, 0x10, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 13 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x1E, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x10, 0x0E, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 14 */
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* line 15 */
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Bit n set: line n of the glyph is empty
+static const uint16_t tamzen8x16r_blank_lines[256] = {
+  0xF00F, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF07,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFF00, 0x007F, 0x007F, 0xFF00, 0x0000,
+  0xFFFF, 0xFFFF, 0xFF7F, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFF00,
+  0x007F, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF007, 0xFFFF,
+  0xFFFF, 0xF303, 0xFFE1, 0xF007, 0xE003, 0xF007, 0xF003, 0xFFE1,
+  0xC003, 0xC003, 0xFC1F, 0xF80F, 0x83FF, 0xFF7F, 0xF3FF, 0xC003,
+  0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF39F, 0x839F, 0xF007, 0xFDBF, 0xF007, 0xF303,
+  0xC003, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xE007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007, 0xF007,
+  0xF007, 0xF007, 0xF007, 0xC003, 0xC003, 0xC003, 0xFFE3, 0xDFFF,
+  0xFFE1, 0xF01F, 0xF003, 0xF01F, 0xF003, 0xF01F, 0xF003, 0x801F,
+  0xF003, 0xF013, 0x8013, 0xF003, 0xF003, 0xF01F, 0xF01F, 0xF01F,
+  0x801F, 0x801F, 0xF01F, 0xF01F, 0xF007, 0xF01F, 0xF01F, 0xF01F,
+  0xF01F, 0x801F, 0xF01F, 0xC001, 0xC001, 0xC001, 0xFFE3, 0xFFFF,
+  0x8007, 0xF013, 0xF013, 0xF019, 0xF013, 0xF013, 0xF010, 0x801F,
+  0xF019, 0xF013, 0xF013, 0xF013, 0xF019, 0xF013, 0xF004, 0xF000,
+  0xF004, 0xF01F, 0xF007, 0xF019, 0xF013, 0xF013, 0xF019, 0xF013,
+  0x8013, 0xF004, 0xF004, 0xE003, 0xF007, 0xF007, 0xFFFF, 0xFFFF,
+  0xF013, 0xF013, 0xF013, 0xF013, 0xF019, 0xF004, 0xFFFF, 0xFFFF,
+  0x819F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x819F, 0xF01F, 0xF01F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xF007, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF367, 0xFFFF,
+  0xFF07, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+#endif
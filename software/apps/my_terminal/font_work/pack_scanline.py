@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------
+#
+#    Packs a font header written by ttf2bmh.py into the layout the DVI
+#    terminal's encoder reads, so main() no longer has to build it at boot.
+#
+#    ttf2bmh.py writes font_8x16[256][16] (or font_8x8[256][8] with -H 8),
+#    one glyph after another with the leftmost pixel in bit 7. tmds_encode_font_2bpp wants the font scanline
+#    major (line 0 of all 256 glyphs, then line 1, ...) with the leftmost
+#    pixel in bit 0. Alongside it this writes, for each glyph, a mask of the
+#    font lines that are empty, which core1 uses to skip blank scanlines.
+#
+#    Usage:
+#        python pack_scanline.py <font_header.h> [-o <output.h>]
+#
+#    The output defaults to <font_header>_scanline.h and defines
+#    <name>_scanline[height * 256] and <name>_blank_lines[256], where <name>
+#    is the header's file name in lower case and height is the glyphs'.
+#
+#-------------------------------------------------------------------------
+
+import os
+import re
+import argparse
+
+N_CHARS = 256
+HEIGHTS = (8, 16)
+
+def read_glyphs(path):
+    """Return the 256 glyphs of a ttf2bmh header, each a list of 8 or 16 bytes."""
+    glyphs = []
+    with open(path) as f:
+        for line in f:
+            m = re.search(r"\{([^}]*)\}", line)
+            if not m or "/*" not in line:
+                continue
+            glyphs.append([int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", m.group(1))])
+    if len(glyphs) != N_CHARS or len(glyphs[0]) not in HEIGHTS or any(len(g) != len(glyphs[0]) for g in glyphs):
+        raise SystemExit(f"{path}: expected {N_CHARS} glyphs of 8 or 16 lines")
+    return glyphs
+
+def reverse_byte(b):
+    return int(f"{b:08b}"[::-1], 2)
+
+def write_header(glyphs, name, source, path):
+    height = len(glyphs[0])
+    guard = name.upper() + "_SCANLINE_H"
+    with open(path, "w") as f:
+        f.write(f"#ifndef {guard}\n")
+        f.write(f"#define {guard}\n\n")
+        f.write(f"// Generated by font_work/pack_scanline.py from {source}\n")
+        f.write(f"// Scanline major, leftmost pixel in bit 0, as tmds_encode_font_2bpp reads it\n\n")
+        f.write(f"static const uint8_t {name}_scanline[{height} * {N_CHARS}] = {{\n")
+        for y in range(height):
+            f.write(f"  /* line {y:2} */\n")
+            for base in range(0, N_CHARS, 16):
+                row = ", ".join(f"0x{reverse_byte(glyphs[c][y]):02X}" for c in range(base, base + 16))
+                f.write(f"  {row},\n")
+        f.write("};\n\n")
+        f.write(f"// Bit n set: line n of the glyph is empty\n")
+        f.write(f"static const uint16_t {name}_blank_lines[{N_CHARS}] = {{\n")
+        for base in range(0, N_CHARS, 8):
+            masks = []
+            for c in range(base, base + 8):
+                mask = sum(1 << y for y in range(height) if glyphs[c][y] == 0)
+                masks.append(f"0x{mask:04X}")
+            f.write(f"  {', '.join(masks)},\n")
+        f.write("};\n\n")
+        f.write("#endif\n")
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack a ttf2bmh font header for the DVI terminal.')
+    parser.add_argument('header', help='Font header written by ttf2bmh.py.')
+    parser.add_argument('-o', '--output', dest='output', help='Output header.')
+    args = parser.parse_args()
+
+    base, _ = os.path.splitext(os.path.basename(args.header))
+    name = base.lower()
+    output = args.output or f"{base}_scanline.h"
+
+    write_header(read_glyphs(args.header), name, os.path.basename(args.header), output)
+    print(f"{output} written")
+
+if (__name__ == '__main__'):
+    main()
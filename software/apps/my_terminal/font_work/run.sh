@@ -15,26 +15,40 @@ echo "Creating header for Px437_IBM_VGA_8x16"
 rm -fR Px437_IBM_VGA_8x16
 mkdir Px437_IBM_VGA_8x16
 python ttf2bmh.py -s 16 -f "packs/olschool/ttf - Px (pixel outline)/Px437_IBM_VGA_8x16.ttf"
+python pack_scanline.py Px437_IBM_VGA_8x16.h
 mv *.h *.png Px437_IBM_VGA_8x16/
 
 echo "Creating header for Px437_TridentEarly_8x16"
 rm -fR Px437_TridentEarly_8x16
 mkdir Px437_TridentEarly_8x16
 python ttf2bmh.py -s 16 -f "packs/olschool/ttf - Px (pixel outline)/Px437_TridentEarly_8x16.ttf"
+python pack_scanline.py Px437_TridentEarly_8x16.h
 mv *.h *.png Px437_TridentEarly_8x16/
 
 echo "Creating header for Tamzen8x16r"
 rm -fR Tamzen8x16r
 mkdir Tamzen8x16r
 python ttf2bmh.py -s 16 -f "packs/tamzen-font/ttf/Tamzen8x16r.ttf"
+python pack_scanline.py Tamzen8x16r.h
 mv *.h *.png Tamzen8x16r/
 
 echo "Creating header for Tamzen8x16b"
 rm -fR Tamzen8x16b
 mkdir Tamzen8x16b
 python ttf2bmh.py -s 16 -f "packs/tamzen-font/ttf/Tamzen8x16b.ttf"
+python pack_scanline.py Tamzen8x16b.h
 mv *.h *.png Tamzen8x16b/
 
+# The 8x8 fonts of the MY_TERMINAL_FONT_8X8 build
+for font in Px437_IBM_BIOS Px437_IBM_CGA Px437_IBM_EGA_8x8 Px437_TridentEarly_8x8; do
+    echo "Creating header for $font"
+    rm -fR $font
+    mkdir $font
+    python ttf2bmh.py -s 8 -H 8 -f "packs/olschool/ttf - Px (pixel outline)/$font.ttf"
+    python pack_scanline.py $font.h
+    mv *.h *.png $font/
+done
+
 
 
 
@@ -13,11 +13,13 @@
 #    It also generates a preview image of the font.
 #
 #    Usage:
-#        python ttf2bmh.py -f <font_file> -s <font_size> [--all-glyphs]
+#        python ttf2bmh.py -f <font_file> -s <font_size> [-H <height>] [--all-glyphs]
 #
 #    Arguments:
 #        -f, --font: Path to the TTF font file.
 #        -s, --size: Font size (default: 16).
+#        -H, --height: Glyph cell height, 8 or 16 (default: 16). Each glyph
+#                      is 8 pixels wide.
 #        --all-glyphs: Extract all glyphs from the font instead of just
 #                      code page 437.
 #     Note: --all-glyphs creates an array indexed from 0 to the number 
@@ -81,11 +83,11 @@ def render_char(char, font, size, yoffset=0):
 
 def write_header(chars, font, size, yoffset=0, header_file="font.h"):
     with open(header_file, "w") as f:
-        f.write("#ifndef FONT_8X16_H\n")
-        f.write("#define FONT_8X16_H\n\n")
+        f.write(f"#ifndef FONT_8X{size[1]}_H\n")
+        f.write(f"#define FONT_8X{size[1]}_H\n\n")
         f.write(f"// Font: PxPlus IBM VGA 8x16\n")
         f.write(f"// Total characters: {len(chars)}\n\n")
-        f.write(f"static const uint8_t font_8x16[256][16] = {{\n")
+        f.write(f"static const uint8_t font_8x{size[1]}[256][{size[1]}] = {{\n")
         for idx, char in enumerate(chars):
             image = render_char(char, font, size, yoffset)
             pixels = list(image.getdata())
@@ -155,6 +157,7 @@ def main():
     parser = argparse.ArgumentParser(description='TTF to C header converter.')
     parser.add_argument('-f', '--font', dest='font_path', required=True, help='Path to the TTF font file.')
     parser.add_argument('-s', '--size', dest='font_size', type=int, default=16, help='Font size.')
+    parser.add_argument('-H', '--height', dest='height', type=int, default=16, choices=[8, 16], help='Glyph cell height.')
     parser.add_argument('--all-glyphs', action='store_true', help='Extract all glyphs from the font. Default is to use code page 437.')
     args = parser.parse_args()
 
@@ -180,7 +183,7 @@ def main():
     print(f"Total characters found: {len(chars)}")
 
     PILfont = ImageFont.truetype(font_path, font_size)
-    size = (8, 16)
+    size = (8, args.height)
     yoffset = 0
 
     print("Writing header file...")
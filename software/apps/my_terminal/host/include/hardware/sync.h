@@ -0,0 +1,12 @@
+#ifndef _HARDWARE_SYNC_H
+#define _HARDWARE_SYNC_H
+
+// One thread, so there is never anyone to wake or wait for
+
+static inline void __sev(void) {}
+static inline void __wfe(void) {}
+static inline void __dmb(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef _PICO_H
+#define _PICO_H
+
+// Just enough of the SDK's pico.h for terminal.c on a PC
+
+#include "pico/types.h"
+
+#define __not_in_flash(group)
+#define __not_in_flash_func(func_name) func_name
+
+static inline void tight_loop_contents(void) {}
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#endif
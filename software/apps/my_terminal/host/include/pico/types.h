@@ -0,0 +1,13 @@
+#ifndef _PICO_TYPES_H
+#define _PICO_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+// Microseconds, as the SDK's absolute_time_t is when it isn't opaque
+typedef uint64_t absolute_time_t;
+
+#endif
@@ -0,0 +1,689 @@
+/*
+===============================================================================
+Host benchmark and screen check for the terminal engine
+===============================================================================
+  Runs terminal.c on a PC, fed the way process_input() feeds it on the
+  Pico: batches of up to UART_BATCH_MAX bytes, each applied holding the back
+  buffer, and a flip after each as core1 would do at the next VSYNC.
+
+  term_bench [options]            built-in workloads, bytes/s and ns per op
+  term_bench [options] file...    replay captured output, in order
+
+  --cols N, --rows N   screen size (default 80x30, as 640x480)
+  --repeat N           replay the files N times
+  --sessions N         split the screen into N panes, file i going to
+                       pane i % N, as with SESSIONS=N in main.c
+  --consoles N         the same with N virtual consoles (CONSOLES=N),
+                       dumping the console shown at the end (Ctrl+W)
+  --dump               print the screen's text after the replay
+  --expect file        compare the screen's text with file (as --dump
+                       prints it), exiting with 1 if they differ
+  --render             TMDS encode the screen at the end as core1 does,
+                       decode it again and check it against the cells,
+                       printing the encode time per frame
+  --image file         also write the decoded frame as a PPM image
+  --expect-image file  compare the decoded frame with an image written
+                       by --image, exiting with 1 if they differ
+  --lanes dir          write the frame's symbols to dir/lane0.csv to
+                       lane2.csv, for scripts/tmdsdump.py
+
+License: MIT
+Author: Donald R. Moran
+===============================================================================
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "terminal.h"
+#include "tmds_encode_font_2bpp_c.h"
+
+#define UART_BATCH_MAX 512 // As in main.c
+#define WORKLOAD_BYTES (4u << 20)
+
+// === Platform Hooks ===
+void platform_draw_mode_menu(void) {
+    static const char *const lines[] = {
+        "Display Mode Menu:",
+        "[1] host",
+        "Select mode (reboots): ",
+    };
+    draw_text_menu(lines, sizeof(lines) / sizeof(lines[0]));
+}
+
+bool platform_select_display_mode(uint m) {
+    return m == 0;
+}
+
+void platform_report_stats(uint session) {
+    (void)session;
+    printf("stats swaps=%lu swap_us=%lu/%lu\n", (unsigned long)stats.swaps,
+           (unsigned long)stats.swap_latency_us_last, (unsigned long)stats.swap_latency_us_worst);
+}
+
+// There is no host to answer, so replies are only counted, for the summary
+static size_t reply_bytes;
+
+void platform_reply(uint session, const char *s, size_t n) {
+    (void)session;
+    (void)s;
+    reply_bytes += n;
+}
+
+void platform_font_changed(void) {
+}
+
+void platform_capture_log(uint action) {
+    (void)action;
+}
+
+// === Replay ===
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void replay(const uint8_t *buf, size_t n, uint session) {
+    while (n) {
+        size_t batch = n < UART_BATCH_MAX ? n : UART_BATCH_MAX;
+        lock_back_buffer();
+        terminal_select_session(session);
+        begin_char_batch();
+        put_chars(buf, batch);
+        end_char_batch();
+        terminal_select_session(0);
+        unlock_back_buffer();
+        while (search_pending()) { // As the main loop would, between batches
+            lock_back_buffer();
+            search_step();
+            unlock_back_buffer();
+        }
+        if (swap_pending()) {
+            perform_swap();
+        }
+        buf += batch;
+        n -= batch;
+    }
+}
+
+// Back to a blank screen in the usual colours, between workloads
+static void reset_screen(void) {
+    replay((const uint8_t *)"\x1b[0m\x1b[r\x1b[2J", 11, 0);
+}
+
+// === Workloads ===
+// Each fills buf with repeats of one operation, returning how many it wrote
+typedef size_t (*workload_fill_t)(char *buf, size_t size);
+
+typedef struct {
+    const char *name;
+    const char *op; // What one repeat is
+    workload_fill_t fill;
+} workload_t;
+
+static size_t fill_text(char *buf, size_t size) {
+    static const char *const words[] = {"the", "quick", "brown", "fox", "jumps", "over",
+                                        "lazy", "dog", "10 PRINT", "READY."};
+    size_t n = 0, ops = 0;
+    while (n + 96 < size) {
+        uint col = 0;
+        for (uint i = ops; col < 70; i++) {
+            col += (uint)snprintf(&buf[n + col], 96 - col, "%s ", words[i % 10]);
+        }
+        n += col;
+        buf[n++] = '\r';
+        buf[n++] = '\n';
+        ops++;
+    }
+    return ops;
+}
+
+static size_t fill_scroll(char *buf, size_t size) {
+    memset(buf, '\n', size);
+    return size;
+}
+
+static size_t fill_sgr(char *buf, size_t size) {
+    size_t n = 0, ops = 0;
+    while (n + 48 < size) {
+        switch (ops % 4) {
+        case 0: n += sprintf(&buf[n], "\x1b[%um", 31 + (uint)(ops / 4) % 7); break;
+        case 1: n += sprintf(&buf[n], "\x1b[1;4;%um", 41 + (uint)(ops / 4) % 7); break;
+        case 2: n += sprintf(&buf[n], "\x1b[38;5;%um", (uint)ops % 256); break;
+        case 3: n += sprintf(&buf[n], "\x1b[38;2;%u;%u;%um", (uint)ops % 256, 128u, 255u); break;
+        }
+        buf[n++] = 'x';
+        ops++;
+    }
+    return ops;
+}
+
+static size_t fill_cursor(char *buf, size_t size) {
+    size_t n = 0, ops = 0;
+    while (n + 16 < size) {
+        if (ops % 5 == 0) {
+            n += sprintf(&buf[n], "\x1b[%u;%uH", 1 + (uint)ops % char_rows, 1 + (uint)ops % char_cols);
+        } else {
+            n += sprintf(&buf[n], "\x1b[%c", "ABCD"[ops % 5 - 1]);
+        }
+        ops++;
+    }
+    return ops;
+}
+
+static size_t fill_erase(char *buf, size_t size) {
+    size_t n = 0, ops = 0;
+    while (n + 16 < size) {
+        n += sprintf(&buf[n], ops % 32 ? "\x1b[%uH\x1b[K" : "\x1b[2J", 1 + (uint)ops % char_rows);
+        ops++;
+    }
+    return ops;
+}
+
+static size_t fill_region(char *buf, size_t size) {
+    size_t n = sprintf(buf, "\x1b[5;%ur", char_rows - 5);
+    size_t ops = 0;
+    while (n + 16 < size) {
+        n += sprintf(&buf[n], "%s", ops % 2 ? "\x1b[6H\x1b[L" : "\x1b[6H\x1b[M");
+        ops++;
+    }
+    return ops;
+}
+
+// A line editor's inserts and deletes at the cursor, at odd columns so the
+// colour planes move by part words
+static size_t fill_edit(char *buf, size_t size) {
+    size_t n = 0, ops = 0;
+    while (n + 24 < size) {
+        n += sprintf(&buf[n], "\x1b[%u;%uH\x1b[%u%c", 1 + (uint)ops % char_rows, 1 + (uint)(ops * 7) % char_cols,
+                     1 + (uint)ops % 5, "@PXb"[ops % 4]);
+        ops++;
+    }
+    return ops;
+}
+
+// Whole screens as bulk updates (terminal.c's BULK_UPDATE), characters and
+// the three colour planes, to set against the same thing sent as text
+static size_t fill_bulk(char *buf, size_t size) {
+    uint cells = char_cols * char_rows;
+    size_t n = 0, ops = 0;
+    while (n + 32 + cells * 5 / 2 < size) {
+        n += sprintf(&buf[n], "\x1bP?9002;1;1;%u;0b", cells);
+        for (uint i = 0; i < cells; i++) {
+            buf[n++] = 'A' + (i + ops) % 26;
+        }
+        // Never 0, so that the fill functions' strlen still finds the end
+        memset(&buf[n], 0x11 * (1 + ops % 3), (cells + 1) / 2 * 3);
+        n += (cells + 1) / 2 * 3;
+        n += sprintf(&buf[n], "\x1b\\");
+        ops++;
+    }
+    return ops;
+}
+
+// Bulk updates as BULK_DELTA frames, each flipping the low bit of four runs
+// of eight characters and skipping the rest, as a dashboard would send
+static size_t fill_delta(char *buf, size_t size) {
+    uint cells = char_cols * char_rows;
+    size_t n = 0, ops = 0;
+    while (n + 64 + cells / 32 < size) {
+        n += sprintf(&buf[n], "\x1bP?9002;1;1;%u;8b", cells);
+        // Characters: four runs at a different place each frame, spaced a
+        // quarter of the screen apart
+        uint at = 0, step = cells / 4;
+        for (uint r = 0; r < 4; r++) {
+            uint target = r * step + (uint)(ops * 9) % (step - 8);
+            for (uint skip = target - at; skip; ) {
+                uint k = skip < 128 ? skip : 128;
+                buf[n++] = (char)(0x7F + k);
+                skip -= k;
+            }
+            buf[n++] = 7; // Eight bytes to XOR
+            memset(&buf[n], 0x01, 8);
+            n += 8;
+            at = target + 8;
+        }
+        // The rest of the characters and all three planes stay as they are
+        for (uint part = 0; part < 4; part++) {
+            uint skip = part == 0 ? cells - at : (cells + 1) / 2;
+            for (; skip; ) {
+                uint k = skip < 128 ? skip : 128;
+                buf[n++] = (char)(0x7F + k);
+                skip -= k;
+            }
+        }
+        n += sprintf(&buf[n], "\x1b\\");
+        ops++;
+    }
+    return ops;
+}
+
+static const workload_t workloads[] = {
+    {"text",   "line",   fill_text},
+    {"scroll", "LF",     fill_scroll},
+    {"sgr",    "SGR",    fill_sgr},
+    {"cursor", "CUP/CUx", fill_cursor},
+    {"erase",  "EL/ED",  fill_erase},
+    {"region", "IL/DL",  fill_region},
+    {"edit",   "@/P/X/b", fill_edit},
+    {"bulk",   "screen", fill_bulk},
+    {"delta",  "frame",  fill_delta},
+};
+#define N_WORKLOADS (sizeof(workloads) / sizeof(workloads[0]))
+
+static void run_workloads(void) {
+    static char buf[WORKLOAD_BYTES];
+    printf("%-8s %10s %12s %10s\n", "workload", "MB/s", "ns/op", "op");
+    for (uint w = 0; w < N_WORKLOADS; w++) {
+        // The fill functions write whole operations and leave the length to strlen
+        memset(buf, 0, sizeof(buf));
+        size_t ops = workloads[w].fill(buf, sizeof(buf) - 1);
+        size_t n = strlen(buf);
+        reset_screen();
+        uint64_t start = now_ns();
+        replay((const uint8_t *)buf, n, 0);
+        uint64_t ns = now_ns() - start;
+        printf("%-8s %10.1f %12.1f %10s\n", workloads[w].name, n * 1e3 / ns,
+               (double)ns / ops, workloads[w].op);
+    }
+}
+
+// === Screen Text ===
+// Row y of the screen as the front buffer shows it, trailing spaces dropped
+static size_t screen_row(uint y, char *out) {
+    const char *row = &screen_front->charbuf[screen_front->row_map[y] * char_cols];
+    size_t len = char_cols;
+    while (len && row[len - 1] == ' ') {
+        len--;
+    }
+    memcpy(out, row, len);
+    out[len] = '\0';
+    return len;
+}
+
+static void dump_screen(FILE *f) {
+    char row[MAX_CHAR_COLS + 1];
+    for (uint y = 0; y < char_rows; y++) {
+        screen_row(y, row);
+        fprintf(f, "%s\n", row);
+    }
+}
+
+// Compare with a file written by --dump, reporting the first row that differs
+static bool expect_screen(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char row[MAX_CHAR_COLS + 1];
+    char line[MAX_CHAR_COLS + 3];
+    bool same = true;
+    for (uint y = 0; y < char_rows && same; y++) {
+        screen_row(y, row);
+        if (!fgets(line, sizeof(line), f)) {
+            line[0] = '\0';
+        }
+        line[strcspn(line, "\n")] = '\0';
+        if (strcmp(row, line) != 0) {
+            fprintf(stderr, "%s: row %u differs\n  expected: %s\n  got:      %s\n", path, y + 1,
+                    line, row);
+            same = false;
+        }
+    }
+    fclose(f);
+    return same;
+}
+
+// === TMDS Render ===
+// The front screen's text as core1's palette path sends it: the three colour
+// planes of each scanline through the C reference of tmds_encode_font_2bpp
+// (tmds_encode_font_2bpp_c.c, with the table the .S uses), and the symbols
+// decoded again as scripts/tmdsdump.py decodes a capture. The decoded frame
+// is checked against the pixels worked out straight from the cells, so a
+// change to the encoder, its table, the font packing or the colour planes
+// that puts a wrong pixel on the wire shows up here. What core1 draws over
+// the text (the cursor, SGR attributes, double size rows, sixel strips, the
+// overlay and the menu) isn't modelled.
+#define LANE_WORDS_MAX ((MAX_CHAR_COLS + 8) * FONT_CHAR_WIDTH / 2)
+
+bool blink_phase = true; // Read by tmds_encode_font_2bpp_c()
+
+// Core1 resolves SGR attributes into the characters before it encodes
+static const uint8_t no_attrs[MAX_CHAR_COLS + CHARBUF_PAD];
+
+static uint32_t lanes[3][LANE_WORDS_MAX]; // Blue, green, red: the planes' order
+static uint8_t frame[MAX_FRAME_HEIGHT][MAX_FRAME_WIDTH][3];
+
+static const uint16_t ctrl_syms[4] = {0x354, 0x0ab, 0x154, 0x2ab};
+
+// As decode_data_sym() in tmdsdump.py
+static uint8_t decode_data_sym(uint32_t x) {
+    if (x & 0x200) {
+        x ^= 0x2ff;
+    }
+    uint8_t trans = (x ^ x << 1) & 0xff;
+    return x & 0x100 ? trans : ~trans;
+}
+
+// Blanking: sync bits on the blue lane, nothing on the others
+static void write_ctrl(FILE *const lane_files[3], size_t n, uint sync) {
+    fprintf(lane_files[0], "%zu,0x%03x\n", n, ctrl_syms[0]);
+    fprintf(lane_files[1], "%zu,0x%03x\n", n, ctrl_syms[0]);
+    fprintf(lane_files[2], "%zu,0x%03x\n", n, ctrl_syms[sync]);
+}
+
+// The row in the display's colours, as palette_row() in main.c makes it
+static void encode_scanline(uint y) {
+    static uint32_t colours[3][MAX_COLOUR_ROW_WORDS];
+    uint r = screen_front->row_map[y / FONT_CHAR_HEIGHT];
+    uint font_y = y % FONT_CHAR_HEIGHT;
+    const uint8_t *chars = (const uint8_t *)&screen_front->charbuf[r * char_cols];
+    const uint32_t *row = &screen_front->colourbuf[r * colour_row_words];
+    for (uint x = 0; x < colour_row_words; x++) {
+        uint32_t w[4];
+        for (uint plane = 0; plane < 4; plane++) {
+            uint p = plane < 3 ? plane : EXT_PLANE;
+            w[plane] = row[p * colour_plane_words + x];
+        }
+        palette_map_word(&screen_front->palette, w);
+        for (uint plane = 0; plane < 3; plane++) {
+            colours[plane][x] = w[plane];
+        }
+    }
+    for (uint plane = 0; plane < 3; plane++) {
+        // Whole words of 8 characters, as the .S reads and writes them
+        tmds_encode_font_2bpp_c(chars, colours[plane], no_attrs, lanes[plane], colour_row_words * 8,
+                                &font_scanline[font_y * FONT_N_CHARS], font_y);
+    }
+}
+
+// Encode every scanline, decoding each into frame and, if lane_files is
+// given, writing its symbols out in the form tmdsdump.py reads: a CSV per
+// lane, red first, and a control symbol after each line and at VSYNC
+// (carried by the blue lane). Returns the ns spent encoding.
+static uint64_t render_frame(FILE *const lane_files[3]) {
+    uint width = char_cols * FONT_CHAR_WIDTH;
+    uint64_t ns = 0;
+    size_t n = 0;
+    for (uint y = 0; y < char_rows * FONT_CHAR_HEIGHT; y++) {
+        uint64_t start = now_ns();
+        encode_scanline(y);
+        ns += now_ns() - start;
+        for (uint x = 0; x < width; x++) {
+            for (uint lane = 0; lane < 3; lane++) {
+                uint32_t sym = lanes[lane][x / 2] >> (x % 2 * 10) & 0x3ff;
+                frame[y][x][2 - lane] = decode_data_sym(sym);
+                if (lane_files) {
+                    fprintf(lane_files[2 - lane], "%zu,0x%03x\n", n, (unsigned)sym);
+                }
+            }
+            n++;
+        }
+        if (lane_files) {
+            write_ctrl(lane_files, n++, 1); // HSYNC
+        }
+    }
+    if (lane_files) {
+        write_ctrl(lane_files, n, 2); // VSYNC
+    }
+    return ns;
+}
+
+// The colour of the cell at physical row r, column col as it is shown:
+// its foreground or background, through the display's palette
+static uint8_t shown_colour(uint r, uint col, bool fg) {
+    const palette_info_t *pal = &screen_front->palette;
+    uint8_t c[2] = {0, 0}; // Foreground, background
+    for (int p = EXT_PLANE; p >= 0; p--) {
+        if (p == ATTR_PLANE) continue;
+        uint32_t word = screen_front->colourbuf[p * colour_plane_words + r * colour_row_words + col / 8];
+        uint nibble = word >> (col % 8 * 4) & 0xf;
+        c[0] = c[0] << 2 | (nibble & 3);
+        c[1] = c[1] << 2 | nibble >> 2;
+    }
+    uint8_t colour = c[fg != pal->reverse ? 0 : 1];
+    return colour & COLOUR_EXT_BITS ? colour : palette_colour(pal, colour);
+}
+
+// Compare the decoded frame with the cells: each lane must be at the RGB222
+// level of the cell's foreground or background, which the encoder sends as
+// a DC balanced pair of values either side of it. Returns the pixels that
+// differ, reporting the first.
+static uint check_frame(void) {
+    uint bad = 0;
+    for (uint y = 0; y < char_rows * FONT_CHAR_HEIGHT; y++) {
+        uint r = screen_front->row_map[y / FONT_CHAR_HEIGHT];
+        const uint8_t *font_line = &font_scanline[y % FONT_CHAR_HEIGHT * FONT_N_CHARS];
+        for (uint x = 0; x < char_cols * FONT_CHAR_WIDTH; x++) {
+            uint col = x / FONT_CHAR_WIDTH;
+            uint8_t c = screen_front->charbuf[r * char_cols + col];
+            bool on = font_line[c] >> (x % FONT_CHAR_WIDTH) & 1;
+            uint8_t colour = shown_colour(r, col, on);
+            for (uint plane = 0; plane < 3; plane++) {
+                uint want = colour >> (2 * plane) & 3;
+                uint got = (frame[y][x][2 - plane] + 0x2a) / 0x55;
+                if (got != want) {
+                    if (!bad) {
+                        fprintf(stderr, "render: pixel %u,%u (cell %u,%u) lane %u is level %u, not %u\n",
+                                x, y, col, y / FONT_CHAR_HEIGHT, plane, got, want);
+                    }
+                    bad++;
+                    break;
+                }
+            }
+        }
+    }
+    return bad;
+}
+
+static bool write_image(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    uint width = char_cols * FONT_CHAR_WIDTH, height = char_rows * FONT_CHAR_HEIGHT;
+    fprintf(f, "P6\n%u %u\n255\n", width, height);
+    for (uint y = 0; y < height; y++) {
+        fwrite(frame[y], 3, width, f);
+    }
+    fclose(f);
+    return true;
+}
+
+// Compare with an image written by --image, reporting the first pixel that
+// differs and how many do
+static bool expect_image(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    uint width = char_cols * FONT_CHAR_WIDTH, height = char_rows * FONT_CHAR_HEIGHT;
+    uint w, h, max;
+    if (fscanf(f, "P6 %u %u %u", &w, &h, &max) != 3 || fgetc(f) == EOF || max != 255) {
+        fprintf(stderr, "%s: not a PPM image as --image writes\n", path);
+        fclose(f);
+        return false;
+    }
+    if (w != width || h != height) {
+        fprintf(stderr, "%s: is %ux%u, the frame %ux%u\n", path, w, h, width, height);
+        fclose(f);
+        return false;
+    }
+    uint8_t row[MAX_FRAME_WIDTH][3];
+    uint bad = 0;
+    for (uint y = 0; y < height; y++) {
+        if (fread(row, 3, width, f) != width) {
+            memset(row, 0, sizeof(row));
+        }
+        for (uint x = 0; x < width; x++) {
+            if (memcmp(row[x], frame[y][x], 3) != 0) {
+                if (!bad) {
+                    fprintf(stderr, "%s: pixel %u,%u is %02x%02x%02x, expected %02x%02x%02x\n", path, x, y,
+                            frame[y][x][0], frame[y][x][1], frame[y][x][2], row[x][0], row[x][1], row[x][2]);
+                }
+                bad++;
+            }
+        }
+    }
+    fclose(f);
+    if (bad) {
+        fprintf(stderr, "%s: %u pixels differ\n", path, bad);
+    }
+    return bad == 0;
+}
+
+// Encode the front screen, timing it over a few frames, then check the
+// decoded frame and write out what was asked for. False if anything differs.
+#define RENDER_TIMED_FRAMES 16
+static bool render(const char *image, const char *expect, const char *lane_dir) {
+    uint64_t ns = 0;
+    for (uint n = 0; n < RENDER_TIMED_FRAMES; n++) {
+        ns += render_frame(NULL);
+    }
+    uint lines = char_rows * FONT_CHAR_HEIGHT;
+    fprintf(stderr, "render %ux%u: %.1f us/frame, %.1f ns/line\n", char_cols * FONT_CHAR_WIDTH, lines,
+            ns / 1e3 / RENDER_TIMED_FRAMES, (double)ns / RENDER_TIMED_FRAMES / lines);
+
+    bool ok = true;
+    if (lane_dir) {
+        FILE *files[3];
+        char path[4096];
+        for (uint lane = 0; lane < 3; lane++) {
+            snprintf(path, sizeof(path), "%s/lane%u.csv", lane_dir, lane);
+            files[lane] = fopen(path, "w");
+            if (!files[lane]) {
+                perror(path);
+                exit(2);
+            }
+        }
+        render_frame(files);
+        for (uint lane = 0; lane < 3; lane++) {
+            fclose(files[lane]);
+        }
+    }
+    uint bad = check_frame();
+    if (bad) {
+        fprintf(stderr, "render: %u pixels don't match the screen\n", bad);
+        ok = false;
+    }
+    if (image && !write_image(image)) {
+        ok = false;
+    }
+    if (expect && !expect_image(expect)) {
+        ok = false;
+    }
+    return ok;
+}
+
+// === Main ===
+static uint8_t *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        exit(2);
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(size > 0 ? size : 1);
+    *len = fread(buf, 1, size, f);
+    fclose(f);
+    return buf;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: term_bench [--cols N] [--rows N] [--repeat N] [--sessions N] [--consoles N] [--dump] "
+                    "[--expect file]\n"
+                    "                  [--render] [--image file] [--expect-image file] [--lanes dir] [file...]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    uint cols = 80, rows = 30, repeat = 1, n_sessions = 1;
+    bool consoles = false;
+    bool dump = false;
+    const char *expect = NULL;
+    bool render_screen = false;
+    const char *image = NULL, *expect_img = NULL, *lane_dir = NULL;
+    int first_file = argc;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--cols") == 0 && i + 1 < argc) {
+            cols = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--rows") == 0 && i + 1 < argc) {
+            rows = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--sessions") == 0 && i + 1 < argc) {
+            n_sessions = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--consoles") == 0 && i + 1 < argc) {
+            n_sessions = atoi(argv[++i]);
+            consoles = true;
+        } else if (strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        } else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+            expect = argv[++i];
+        } else if (strcmp(argv[i], "--render") == 0) {
+            render_screen = true;
+        } else if (strcmp(argv[i], "--image") == 0 && i + 1 < argc) {
+            image = argv[++i];
+            render_screen = true;
+        } else if (strcmp(argv[i], "--expect-image") == 0 && i + 1 < argc) {
+            expect_img = argv[++i];
+            render_screen = true;
+        } else if (strcmp(argv[i], "--lanes") == 0 && i + 1 < argc) {
+            lane_dir = argv[++i];
+            render_screen = true;
+        } else if (argv[i][0] == '-') {
+            usage();
+        } else {
+            first_file = i;
+            break;
+        }
+    }
+    if (cols == 0 || rows == 0 || cols > MAX_CHAR_COLS || rows > MAX_CHAR_ROWS) {
+        fprintf(stderr, "screen can be at most %ux%u\n", MAX_CHAR_COLS, MAX_CHAR_ROWS);
+        return 2;
+    }
+
+    terminal_set_geometry(cols, rows);
+    terminal_init();
+    if (n_sessions > 1 && consoles) {
+        terminal_set_consoles(n_sessions);
+    } else if (n_sessions > 1) {
+        terminal_set_sessions(n_sessions);
+    }
+
+    if (first_file == argc) {
+        run_workloads();
+        reset_screen();
+    } else {
+        size_t total = 0;
+        uint64_t ns = 0;
+        for (uint r = 0; r < repeat; r++) {
+            for (int i = first_file; i < argc; i++) {
+                size_t len;
+                uint8_t *buf = read_file(argv[i], &len);
+                uint64_t start = now_ns();
+                replay(buf, len, (i - first_file) % n_sessions);
+                ns += now_ns() - start;
+                total += len;
+                free(buf);
+            }
+        }
+        fprintf(stderr, "%zu bytes in %.3f ms, %.1f MB/s, %lu swaps, %zu reply bytes\n", total,
+                ns / 1e6, ns ? total * 1e3 / ns : 0.0, (unsigned long)stats.swaps, reply_bytes);
+    }
+
+    if (dump) {
+        dump_screen(stdout);
+    }
+    bool same = !expect || expect_screen(expect);
+    if (render_screen && !render(image, expect_img, lane_dir)) {
+        same = false;
+    }
+    return same ? 0 : 1;
+}
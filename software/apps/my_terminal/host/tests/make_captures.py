@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+# Writes the captures the golden-screen tests replay, each <name>.vt here.
+# What each should leave on a 40x12 screen is in <name>.txt (term_bench
+# --dump) and, for those with colour worth checking, <name>.ppm (--image),
+# both written by term_bench and checked by eye before going in. Change a
+# capture here, run this, and write its expected files again.
+import os
+import struct
+
+COLS, ROWS = 40, 12
+ESC = b"\x1b"
+
+def cup(row, col):
+    return ESC + b"[%d;%dH" % (row, col)
+
+def clear():
+    return ESC + b"[2J"
+
+# vttest's first screen, more or less: a frame of * drawn by CUP and one of +
+# inside it by CUD and CUF, some text with DECSC/DECRC, and CUP past the
+# corner. The frame stops short of the last row, where writing the last
+# column would scroll the screen.
+def cursor():
+    bottom = ROWS - 1
+    d = clear()
+    for c in range(1, COLS + 1):
+        d += cup(1, c) + b"*" + cup(bottom, c) + b"*"
+    for r in range(2, bottom):
+        d += cup(r, 1) + b"*" + cup(r, COLS) + b"*"
+    d += cup(2, 2) + b"+" * (COLS - 2)
+    for r in range(3, bottom - 1):
+        d += cup(r - 1, 2) + ESC + b"[B+" + ESC + b"[%dC+" % (COLS - 4)
+    d += cup(bottom - 1, 2) + b"+" * (COLS - 2)
+    d += cup(5, 10) + b"The screen should be" + cup(6, 10) + b"cleared, with a frame"
+    d += ESC + b"7" + cup(7, 10) + b"of * and +" + ESC + b"8" + ESC + b"[A" + ESC + b"[D!"
+    d += cup(999, 999) + ESC + b"[D" + ESC + b"[D#"
+    return d
+
+def sgr():
+    d = clear() + cup(1, 1)
+    d += ESC + b"[31mred" + ESC + b"[32m green" + ESC + b"[34m blue" + ESC + b"[0m plain\r\n"
+    d += ESC + b"[1mbold" + ESC + b"[0m " + ESC + b"[4munder" + ESC + b"[0m " + ESC + b"[7mreverse" + ESC + b"[0m\r\n"
+    d += ESC + b"[37;41mwhite on red" + ESC + b"[0m " + ESC + b"[30;47mblack on white" + ESC + b"[m\r\n"
+    d += ESC + b"[38;5;208m256 orange" + ESC + b"[38;2;0;128;255m rgb" + ESC + b"[m\r\n"
+    d += ESC + b"[93;104mbright" + ESC + b"[m end"
+    return d
+
+# DECSTBM: LF at the foot of the region and RI at its head scroll only it
+def scroll():
+    d = clear()
+    for r in range(1, ROWS + 1):
+        d += cup(r, 1) + b"row %d" % r
+    d += ESC + b"[3;6r" + cup(6, 1)
+    for i in range(3):
+        d += b"\nnew %d" % i
+    d += cup(3, 1) + ESC + b"Mreversed in"
+    d += ESC + b"[r" + cup(ROWS, 30) + b"end"
+    return d
+
+# IL and DL, on the whole screen and inside a region
+def lines():
+    d = clear()
+    for r in range(1, ROWS + 1):
+        d += cup(r, 1) + b"line %d" % r
+    d += cup(3, 5) + ESC + b"[2Linserted"
+    d += cup(8, 1) + ESC + b"[M"
+    d += ESC + b"[4;9r" + cup(5, 1) + ESC + b"[3M" + cup(4, 1) + ESC + b"[Lin region" + ESC + b"[r"
+    return d
+
+# ICH, DCH, ECH, EL and REP
+def chars():
+    d = clear()
+    d += cup(1, 1) + b"abcdefghij" + cup(1, 4) + ESC + b"[3@XYZ"
+    d += cup(2, 1) + b"abcdefghij" + cup(2, 3) + ESC + b"[4P"
+    d += cup(3, 1) + b"abcdefghij" + cup(3, 2) + ESC + b"[5X"
+    d += cup(4, 1) + b"abcdefghij" + cup(4, 6) + ESC + b"[K"
+    d += cup(5, 1) + b"the end of the row is pushed off it here" + cup(5, 1) + ESC + b"[6@START"
+    d += cup(6, 1) + b"x" + ESC + b"[10b|"
+    return d
+
+# UTF-8 into CP437, bad sequences, and back to single bytes
+def utf8():
+    d = clear() + cup(1, 1) + ESC + b"%G"
+    d += "┌──────┐\r\n│ café │\r\n└──────┘\r\n".encode()
+    d += "½ ° ± π Σ µ ░▒▓█\r\n".encode()
+    d += b"bad \xff\xc3 ok\r\n"
+    d += ESC + b"%@\xc9\xcd\xbb"
+    return d
+
+# DCS ?9002 b (see bulk_begin() in terminal.c)
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = (crc << 1 ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+# The blue, green and red planes, every cell the same
+def planes(n, nibble):
+    return [bytes([nibble | nibble << 4]) * ((n + 1) // 2)] * 3
+
+def block(row, col, count, flags, payload, crc=None):
+    d = ESC + b"P?9002;%d;%d;%d;%db" % (row, col, count, flags) + payload
+    if flags & 1:
+        d += struct.pack(">H", crc16(payload) if crc is None else crc)
+    return d + ESC + b"\\"
+
+def delta(new, old):
+    x = bytes(a ^ b for a, b in zip(new, old))
+    d = b""
+    i = 0
+    while i < len(x):
+        j = i
+        same = x[i] == 0
+        while j < len(x) and (x[j] == 0) == same and j - i < 0x80:
+            j += 1
+        d += bytes([0x7F + j - i]) if same else bytes([j - i - 1]) + x[i:j]
+        i = j
+    return d
+
+def bulk():
+    white = 0x3 # Foreground 3, background 0, in every plane
+    d = clear() + cup(1, 1) + b"text before the blocks"
+    text = b"plain block across the end of a row and on"
+    d += block(2, 1, len(text), 0, text + b"".join(planes(len(text), white)))
+    text = b"checked block"
+    d += block(4, 5, len(text), 1, text + b"".join(planes(len(text), white)))
+    text = b"this one fails its CRC"
+    payload = text + b"".join(planes(len(text), white))
+    d += block(5, 5, len(text), 1, payload, crc16(payload) ^ 1)
+    old = b"dashboard v1 cpu 10%"
+    new = b"dashboard v2 cpu 97%"
+    old_planes = planes(len(old), white)
+    d += block(7, 1, len(old), 0, old + b"".join(old_planes))
+    # The figure goes red: its cells lose the blue and green foreground
+    new_planes = [p[:8] + b"\x00\x00" for p in old_planes[:2]] + [old_planes[2]]
+    d += block(7, 1, len(new), 8, delta(new, old) + b"".join(delta(n, o) for n, o in zip(new_planes, old_planes)))
+    text = b"this is far too long to fit"
+    d += block(ROWS, 30, len(text), 0, text + b"".join(planes(len(text), white)))
+    d += cup(9, 1) + b"after the refused block"
+    return d
+
+# Cursor moves on double width and height lines stop at the last cell shown,
+# the middle of the row: CUF along one, CUU and CUD onto them, and ESC#6
+# under the cursor
+def double():
+    d = clear()
+    d += cup(1, 1) + ESC + b"#6" + ESC + b"[30CX"
+    d += cup(3, 1) + ESC + b"#3" + cup(4, 1) + ESC + b"#4"
+    d += cup(5, 35) + ESC + b"[2AT" + cup(2, 35) + ESC + b"[2BB"
+    d += cup(6, 30) + ESC + b"#6W"
+    d += cup(8, 1) + b"end"
+    return d
+
+# Refused blocks whose payloads are full of CAN, SUB and ESC, which must be
+# taken as payload and not break out of the DCS: plain, with a CRC, and as
+# a delta, each with text after it
+def refused():
+    nasty = bytes([0x18, 0x1A, 0x1B, 0x30]) * 256
+    d = clear() + cup(1, 1) + b"before"
+    n = COLS * ROWS
+    d += block(2, 1, n, 0, nasty[:n] + nasty[:(n + 1) // 2] * 3) + cup(2, 1) + b"after a plain one"
+    n = COLS * ROWS + 1
+    d += block(1, 1, n, 1, nasty[:n] + nasty[:(n + 1) // 2] * 3) + cup(3, 1) + b"after a checked one"
+    n = 512
+    run = bytes([0x7F]) + nasty[:0x80] # XOR 0x80 bytes
+    skip = bytes([0xFF])               # Skip 0x80
+    d += block(ROWS, 1, n, 8, run * 4 + run * 2 + skip * 2 + run + skip) + cup(4, 1) + b"after a delta"
+    return d
+
+here = os.path.dirname(os.path.abspath(__file__))
+for make in (cursor, sgr, scroll, lines, chars, utf8, bulk, refused, double):
+    with open(os.path.join(here, make.__name__ + ".vt"), "wb") as f:
+        f.write(make())
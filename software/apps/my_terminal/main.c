@@ -4,25 +4,34 @@ DVI Terminal Emulator for Raspberry Pi Pico RP2350
 ===============================================================================
 Description:
   Terminal emulator for Raspberry Pi Pico RP2350 with DVI output, featuring:
-  - 80x30 character display (640x480 resolution)
-  - ANSI escape sequence support
-  - UART interface for input
+  - 80x30 character display (640x480), or 100x30, 100x37, 120x33 and 160x45 on the wider display modes
+  - ANSI escape sequence support, including scrolling regions
+  - UART interface for input, and USB CDC as a second, faster one
   - Multiple cursor styles and color themes
-  - Double-buffered rendering to prevent tearing
+  - Page-flipped double buffering to prevent tearing
   - Interactive color selection menus for both foreground (Ctrl+F) and background (Ctrl+B) colors, allowing users to pick any of the 64 6-bit RGB colors by entering a two-digit code.
 
 Hardware Requirements:
   - Raspberry Pi Pico RP2350
   - DVI output board (e.g., Adafruit HDMI sock)
-  - UART connection for keyboard input (RX: GPIO1)
+  - UART connection for keyboard input (RX: GPIO1), received by DMA, with flow control by
+    RTS (GPIO3, CTS on GPIO2) and XON/XOFF (TX: GPIO0)
+  - Optionally a USB keyboard on the native port (MY_TERMINAL_USB_KEYBOARD), powered from
+    VBUS, for a terminal with nothing else attached
 
 Key Features:
   - Support for Microsoft BASIC input via UART
   - Configurable cursor styles (IBM retro, underline, bar, Apple I)
-  - 6-bit RGB color support (64 colors) with 2 bits per component (RRGGBB)
-  - VSYNC-synchronized rendering
+  - 6-bit RGB color support (64 colors) with 2 bits per component (RRGGBB), and 256 colours
+    per cell for 256-colour and truecolour SGR on RP2350
+  - VSYNC-synchronized rendering, with the cursor and blinking text timed by the display itself
   - Terminal state preservation during menu operations
   - Interactive color selection menus for both foreground and background colors (Ctrl+F, Ctrl+B)
+  - Display mode menu (Ctrl+V): 640x480, 800x480, 800x600, 960x540 or 1280x720 (30 Hz),
+    applied by rebooting
+  - Font switching without a reboot (Ctrl+Y for the next font, or ESC]50;tamzen BEL)
+  - Scrollback (Ctrl+P pages back, Ctrl+O forward): 1100 to 2350 lines kept in SRAM, shown
+    by core1 straight from the store while new output carries on underneath
 
 Color System:
   The terminal uses 6-bit RGB colors (2 bits per component) for a total of 64 colors.
@@ -46,7 +55,7 @@ Color System:
     Y: Bright Yellow (0x3C) M: Bright Magenta (0x33) C: Bright Cyan (0x0F)
 
 
-  Theme Presets (Ctrl+T then number):
+  Theme Presets (Ctrl+T then number, recolouring text already on screen in the default colours):
     0: Green on Black      (VT100/Apple IIe)
     1: Amber on Black      (Wyse/VT220)
     2: White on Blue       (DOS/PC BIOS)
@@ -69,17 +78,160 @@ Recent Changes:
   - Fixed printf format (%u to %lu for cursor_blink_counter) for debug
   - Ensured cursor background always matches screen background (current_bg)
   - Updated color mappings for accurate 6-bit RGB values
+  - Per-row dirty tracking of the back buffer.
+  - True page flipping: core1 swaps the front/back buffer pointers at VSYNC and core0 re-syncs
+    only the rows that were dirty into the new back buffer, instead of memcpying every frame.
+  - UART reception moved from a per-byte interrupt to a DMA ring buffer with the FIFO enabled.
+  - Input is applied in batches (handle_chars()): one cursor update and one swap per batch.
+  - Fast path for runs of printable characters that bypasses the escape/menu state machine.
+  - set_colour_span(): word-at-a-time colour fills for clears, scrolls and erase-to-end-of-line.
+  - Row-mapped buffers: scrolling rotates a per-buffer row map used by core1's row lookup and
+    clears one row, instead of memmoving the whole screen.
+  - Scrolling regions (ESC[top;bottomr), insert/delete line (ESC[L, ESC[M) and reverse index
+    (ESC M), all done by remapping rows.
+  - Optional dual-core render (DUAL_CORE_RENDER): core0 encodes odd scanlines from its SIO FIFO
+    interrupt, core1 the even ones, and core1 queues each pair in order.
+  - Cursor drawn by core1 as it encodes, blinking on core1's frame count: core0 only publishes its
+    position and style with each buffer, so blinking costs no writes, copies or swaps.
+  - SGR bold, underline, blink and reverse (ESC[1m, 4m, 5m, 7m, cleared by 22/24/25/27): a
+    fourth nibble plane of attributes, applied by core1 per scanline. Rows without attributes
+    still go straight to the assembly encoder; blink is timed by core1's frame count.
+  - Runtime display modes: buffers are sized for the largest mode and indexed with the geometry
+    of the one in use. The Ctrl+V menu shows the measured worst-case encode time per line.
+  - Solid scanline cache: lines that are background only (blank rows, the gaps above and below
+    glyphs) are served from a few pre-encoded TMDS buffers instead of being encoded every frame.
+  - Scrollback: lines leaving the top of the screen go into a history ring of characters, with
+    their colours shared through a pool of distinct colour rows. Core1's row lookup reads a
+    scrolled back view directly from the ring, and the view stays put as new lines arrive.
+  - The font is packed for the encoder at build time (font_work/pack_scanline.py) instead of
+    being transposed and bit-reversed at boot.
+  - Four fonts (IBM VGA, Trident, Tamzen, Tamzen bold), switched between on the next frame with
+    Ctrl+Y or OSC 50 (ESC]50;name BEL), by flipping the font table core1 uses.
+  - Monochrome glyph cache: rows in the colours in use are built by copying pre-encoded TMDS
+    words per glyph line instead of running the palette encoder. Added 1280x720 at 30 Hz.
+  - Optional DMA gather render (DMA_GATHER_RENDER): those rows are assembled by a chained pair
+    of DMA channels from a list of glyph fragments, so core1 writes 3 words per character.
+  - Input front-end and parser split by a lock-free ring (input_ring): the front-end empties the
+    UART DMA ring from a 1 ms timer interrupt too, so input is taken in during long operations.
+  - Optional HSTX output (DVI_HSTX): libdvi drives the display from the RP2350's HSTX, which
+    does the TMDS encode in hardware, and core1 only expands the font to RGB222 pixels.
+  - SIO TMDS text encoder on RP2350: the font is expanded to RGB222 pixels, which go through
+    the core's TMDS encoder for all 3 lanes at once. It is timed against the palette LUT encoder
+    at boot and used if faster; the Ctrl+V menu shows both times.
+  - 256 colours per cell: a fifth plane of extension bits gives red and green 8 levels each.
+    SGR 38/48 (5;n and 2;r;g;b) is mapped to the nearest colour, and 39/49 and the bright
+    90-97/100-107 are handled. Rows using them go through the SIO TMDS encoder. The SIO and HSTX
+    paths now work in RGB565, so the RGB222 levels come out as bright as from the LUT.
+  - Escape sequences are parsed by a table-driven VT500 state machine (vt_advance()): numeric
+    parameters are accumulated as they arrive (no atoi), up to 16 of 16 bits each, private
+    markers and intermediates are tracked, and anything unimplemented (ESC[?1049h, DCS, APC...)
+    is consumed to its end in constant time per byte. Adds ESC[?25h/l, ESC 7 and ESC 8.
+  - UART flow control (UART_RTS_CTS, UART_XON_XOFF): the host is stopped by RTS and XOFF when
+    the input rings are three quarters full and started again at a quarter, instead of bytes
+    being lost once the DMA ring laps.
+  - USB CDC input, multiplexed with the UART into input_ring and read a block at a time, with
+    the bytes from each source shown in the Ctrl+V menu.
+  - Always-on render statistics: cycles per encode_line() (min/avg/max over the last frame,
+    from the DWT cycle counter), late scanlines counted by libdvi, frames, swaps and swap
+    latency, ingest rate and UART overflows, printed over USB CDC on ESC[?9000n.
+  - The terminal engine (buffers and swap, parser, scrolling, scrollback, fonts, menus) moved
+    to terminal.c, which uses no hardware, with the board behind the platform_*() hooks. It
+    also builds on a PC (host/term_bench): byte streams are replayed through it at full speed
+    for bytes/s and ns per operation, and the screen can be dumped or checked against a file.
+  - Scratch font line (SCRATCH_FONT_LINE): each core copies the font line it is encoding into
+    its own scratch bank (X for core1, Y for core0), so the encoder's font reads don't contend
+    with core0 in main SRAM. The memory map is described above scratch_lines_t.
+  - Sprite overlay (libsprite): up to 4 16x16 images (a pointer and status icons) placed in
+    pixels by ESC[?9001;slot;image;x;y n and flipped with the buffers. Only the 64-pixel
+    groups under them are expanded to RGB565, drawn on with sprite_sprite16() and encoded
+    again with the SIO encoder (straight onto the line with HSTX). Not drawn on RP2040.
+  - Sixel graphics (DCS q): decoded byte by byte straight into strips of 2bpp grey pixels, one
+    text row high, from a 32 KB pool. Rows showing a strip are encoded by tmds_encode_2bpp()
+    instead of the text encoder, and the image scrolls and clears with its rows.
+  - Bulk screen updates (ESC P ?9002;row;col;count;flags b): a block of characters and their
+    colour nibbles, in colourbuf's own layout, as raw bytes with an optional CRC-16, copied a
+    run at a time straight into the back buffer without going through the parser.
+  - Bulk update deltas (flag 8): each part sent as a run-length coded XOR against the back buffer
+    and decoded in place, so a frame changing a few dozen cells is a hundred bytes or so.
+  - A batch that changes neither the text nor the cursor no longer requests a swap just because
+    the cursor is visible; core1 draws it from cursor_info whatever the buffers hold.
+  - Menus are a window core1 draws over the rows it covers, from a copy of each row made at its
+    first scanline, instead of saving, overwriting and restoring the cells under them.
+  - The main loop sleeps in WFE between inputs instead of spinning, woken at once by the falling
+    edge of a start bit. Optional flips at any row below the beam (SWAP_BELOW_BEAM) and a scope
+    test of key to photon latency on GPIO22 (LATENCY_TEST).
+  - Idle mode: after IDLE_AFTER_S seconds without input core0 stops its 1 ms input poll and
+    sleeps until the next start bit, waking every 250 ms for the watchdog.
+  - Split screen (SESSIONS=2 or 3): panes one above the other, each with its own parser, cursor,
+    colours and scrolling region, fed from uart1 RX on GPIO5 and a PIO UART RX on GPIO6. The
+    panes share the screen buffers, so core1 draws them as it draws one screen.
+  - The screen buffers are screen_t instances, and core1 renders whichever screen_front points
+    at. With CONSOLES=SESSIONS the sessions are virtual consoles, each parsed into a screen of
+    its own in the background, and Ctrl+W shows the next by pointing core1 at its screen at
+    the next flip.
+  - The buffer lock is a pair of single-writer flags, one per core, and core1 never waits on
+    core0 mid-frame: a flip below the beam that finds core0 writing is tried again at the next
+    row. At VSYNC core1 holds core0 off new writes while it waits out the current one, and
+    counts the flips it had to put off a frame (flips_deferred in ESC[?9000n).
+  - libdvi's TMDS buffers come from a static pool, as many as the build options need plus
+    MY_TERMINAL_EXTRA_TMDS_BUFFERS, and a scanline that misses its slot repeats the one before
+    instead of flashing red. ESC[?9000n reports late lines in the last frame, the worst frame
+    and the number of frames with any.
+  - Double width and double height lines (ESC#6, ESC#3 and ESC#4, back to single with ESC#5),
+    drawn by core1 from the first half of the row's cells, and a big text build
+    (MY_TERMINAL_BIG_TEXT) with every scanline and pixel doubled, 40x15 at 640x480, in which
+    every row is drawn in 256 colours, RP2040 included.
+  - 8x8 fonts (MY_TERMINAL_FONT_8X8), packed by font_work/pack_scanline.py like the 8x16 ones:
+    IBM BIOS, CGA and EGA and Trident, for 80x60 at 640x480 up to 160x90 at 1280x720.
+  - UTF-8 input (MY_TERMINAL_UTF8, ESC%G/ESC%@), decoded a byte at a time in the parser and drawn
+    as CP437 glyphs, so htop and tmux borders and bars come out as box drawing. ASCII runs
+    still take the fast path untouched.
+  - Replies to the host: CPR, DSR, DA and the ESC[?9000n stats go out on UART_TX_PIN (and uart1 for
+    session 1) from a TX ring that DMA empties, so the parser never waits on the wire.
+  - Capture log (MY_TERMINAL_CAPTURE_LOG): what arrives is staged in SRAM and written to a 1 MB
+    ring of flash pages in quiet moments, to replay (ESC[?9003;1n) or dump over USB (ESC[?9003;2n)
+    after a reset. That build runs from SRAM, so flash writes never disturb the display.
+  - Faster cold boot: the first screen is built while the regulator settles, the display starts
+    as soon as the clock is up, and USB, the UARTs and the capture log come up after core1.
+  - Themes and reverse video (ESC[?5h) recolour the whole screen at the next flip: cells keep the
+    default white and black, and core1 shows them in the theme's pair as it fetches each row.
+  - In-row editing: ICH, DCH, ECH and REP (ESC[@, ESC[P, ESC[X, ESC[b) are span moves within the
+    row, a memmove of the characters and a word-at-a-time nibble shift of each colour plane.
+  - History search (Ctrl+R, Enter for the next match): each line gets a 64-bit set of the
+    character pairs in it as it scrolls off, and the scan checks those before any text, a slice
+    per time round the main loop so input keeps flowing.
+  - USB keyboard (MY_TERMINAL_USB_KEYBOARD): TinyUSB host on the native port in place of USB
+    CDC. Each report's new keys go straight into the UART TX ring, from the main loop as soon
+    as the USB interrupt has queued the report, and with MY_TERMINAL_LOCAL_ECHO into the input
+    ring too.
+  - Dual head (MY_TERMINAL_DUAL_HEAD): a second DVI output on pio1 mirrors the first from the
+    same TMDS buffers, so it adds DMA traffic but no encoding. libdvi's dvi_init_mirror() gives
+    it a serialiser and DMA channels of its own, and its IRQ simply sends whatever buffer the
+    first output has just set up.
+  - One cell store for the screens and the scrollback, laid out for the display mode at boot:
+    each screen takes only the rows and columns it has, and the history everything left, so
+    every mode below 1280x720 keeps more lines, in less SRAM than before.
 
 How UART Reception Works
 
-   1. Interrupt Setup: The code configures an interrupt to trigger whenever the UART hardware's receive buffer is not empty. It
-      registers the function on_uart_rx to run when this interrupt occurs.
-   2. ISR (Interrupt Service Routine): When data arrives on the UART bus, the on_uart_rx function is automatically
-      executed. This function reads the byte from the UART hardware and stores it in a circular software buffer called
-      uart_buffer.
-   3. Main Loop Processing: The main while(1) loop of the program continuously calls the process_uart_buffer() function.
-      This function checks if there is any unread data in the uart_buffer (by comparing its head and tail pointers). If
-      there is, it processes the character.
+   1. DMA Setup: The UART FIFO is enabled and a DMA channel, paced by the UART RX DREQ, copies every received byte
+      into uart_buffer. The channel's write address wraps using the DMA ring feature, so uart_buffer is a circular
+      buffer that the hardware fills on its own, with no interrupt per byte.
+   2. Write Pointer: The head of the ring is simply where the DMA channel will write next, read back from the
+      channel's write address register (uart_rx_head()).
+   3. Front-end: poll_input() moves what the DMA has written since its tail pointer into input_ring, a lock-free
+      single producer, single consumer ring. It runs from a 1 ms timer interrupt as well as from the main loop, so
+      input keeps being taken in while the parser is busy with a long operation.
+   4. Main Loop Processing: The main while(1) loop of the program continuously calls the process_input() function.
+      This function compares the ring's head with its own tail and processes every character in between. It also
+      drives the activity LED, once per batch rather than once per byte.
+   5. Flow Control: each time it runs, the front-end compares the bytes waiting in both rings with FLOW_HIGH_WATER
+      and FLOW_LOW_WATER, and stops or starts the host by raising or lowering RTS and sending XOFF or XON. The
+      input ring is drained by the parser, so a host that honours either can send at any rate without loss.
+   6. USB: from the main loop, poll_usb_input() reads whatever the USB CDC interface has received straight into
+      input_ring, in blocks, up to FLOW_HIGH_WATER so the rest is kept for the UART. USB has flow control of its
+      own: the host is held off while TinyUSB's receive FIFO is full. Bytes from each source are counted for the
+      Ctrl+V menu.
 
 License: MIT
 Author: Donald R. Moran
@@ -96,951 +248,2440 @@ Author: Donald R. Moran
 #include "hardware/vreg.h" 
 #include "hardware/watchdog.h" 
 #include "hardware/structs/bus_ctrl.h" 
+#if PICO_RP2040
+#include "hardware/structs/systick.h"
+#elif !PICO_RISCV
+#include "hardware/structs/m33.h"
+#endif
 #include "hardware/dma.h" 
+#include "hardware/irq.h"
 #include "hardware/uart.h"
+#include "hardware/flash.h"
+#include "hardware/pio.h"
+#if LIB_PICO_STDIO_USB || USB_KEYBOARD
+#include "tusb.h"
+#endif
 #include "dvi.h" 
 #include "dvi_serialiser.h" 
+#include "tmds_encode.h"
 #ifndef DVI_DEFAULT_SERIAL_CONFIG
 #define DVI_DEFAULT_SERIAL_CONFIG adafruit_hdmi_sock_cfg
 #endif
 #include "common_dvi_pin_configs.h" 
 #include "tmds_encode_font_2bpp.h" 
-//#include "font_8x16.h" 
-#include "Px437_IBM_VGA_8x16.h" 
+#include "font_rgb565.h"
+#include "sprite.h"
+#include "terminal.h"
+#include "uart_rx.pio.h"
 
 // === Configuration ===
-#define FONT_CHAR_WIDTH 8
-#define FONT_CHAR_HEIGHT 16
-#define FONT_N_CHARS 256
+// The display mode is picked at boot from display_modes[] (Ctrl+V). The
+// character geometry and the buffers are in terminal.h.
+#ifndef DEFAULT_DISPLAY_MODE
+#define DEFAULT_DISPLAY_MODE 0
+#endif
+#define BLINK_HALF_PERIOD_FRAMES 30 // About 1 Hz at 60 Hz
+
+// Input buffering. The DMA ring must be a power of two and aligned to its size.
+#define UART_RING_BITS 12
+#define UART_BUFFER_SIZE (1u << UART_RING_BITS)
+#define UART_BATCH_MAX 512 // Most bytes applied under one hold of the buffer lock
+
+// Everything received goes through input_ring, from the I/O front-end
+// (poll_input()) to the parser (process_input()). The front-end also runs
+// from a timer interrupt every INPUT_POLL_US, so input keeps being taken in
+// while the parser is busy.
+#define INPUT_RING_BITS 14
+#define INPUT_RING_SIZE (1u << INPUT_RING_BITS)
+#define INPUT_POLL_US 1000
+
+// Replies to the host (CPR, DA, DSR and the ESC[?9000n stats) go out through
+// a ring per UART that DMA empties (see platform_reply()). Big enough for the
+// stats; a power of two, aligned to its size.
+#define UART_TX_RING_BITS 10
+#define UART_TX_RING_SIZE (1u << UART_TX_RING_BITS)
+
+// Flow control towards the host (see update_flow_control()): the host is
+// stopped once the input buffers hold FLOW_HIGH_WATER bytes and started again
+// at FLOW_LOW_WATER, by RTS (UART_RTS_CTS) and by XOFF/XON (UART_XON_XOFF).
+// The margin above the high watermark covers what a USB serial adapter still
+// sends after being told to stop.
+#ifndef UART_RTS_CTS
+#define UART_RTS_CTS 1
+#endif
+#ifndef UART_XON_XOFF
+#define UART_XON_XOFF 1
+#endif
+#define FLOW_HIGH_WATER (INPUT_RING_SIZE - INPUT_RING_SIZE / 4)
+#define FLOW_LOW_WATER (INPUT_RING_SIZE / 4)
 
-#define FRAME_WIDTH 640
-#define FRAME_HEIGHT 480
-#define VREG_VSEL VREG_VOLTAGE_1_20
-#define DVI_TIMING dvi_timing_640x480p_60hz
+// With DUAL_CORE_RENDER=1 (see CMakeLists.txt) core0 encodes every other
+// scanline from its SIO FIFO interrupt while core1 encodes the rest
+#ifndef DUAL_CORE_RENDER
+#define DUAL_CORE_RENDER 0
+#endif
 
-#define CHAR_COLS (FRAME_WIDTH / FONT_CHAR_WIDTH)
-#define CHAR_ROWS (FRAME_HEIGHT / FONT_CHAR_HEIGHT)
-#define COLOUR_PLANE_SIZE_WORDS (CHAR_ROWS * CHAR_COLS * 4 / 32)
-#define COLOUR_PAD_WORDS 8
+// With DMA_GATHER_RENDER=1 core1 doesn't copy the glyphs of rows in the
+// monochrome glyph cache either: it lists where each character's TMDS words
+// are and a pair of DMA channels gathers them into the line, while core1
+// moves on to the next one
+#ifndef DMA_GATHER_RENDER
+#define DMA_GATHER_RENDER 0
+#endif
+#if DMA_GATHER_RENDER && DUAL_CORE_RENDER
+#error "DMA_GATHER_RENDER and DUAL_CORE_RENDER can't be used together"
+#endif
 
-// Input buffering
-#define UART_BUFFER_SIZE 512
+// With DVI_HSTX=1 (MY_TERMINAL_HSTX in CMakeLists.txt) libdvi drives the
+// display from HSTX, which TMDS encodes in hardware. Lines are then one
+// RGB565 pixel per half word, expanded from the font by font_expand_rgb565(),
+// and there is no TMDS to cache or gather.
+#if DVI_HSTX && DMA_GATHER_RENDER
+#error "DMA_GATHER_RENDER has nothing to gather with DVI_HSTX"
+#endif
+
+// With SCRATCH_FONT_LINE=1 each core copies the font line it is encoding into
+// its own scratch bank first (see encode_line())
+#ifndef SCRATCH_FONT_LINE
+#define SCRATCH_FONT_LINE 1
+#endif
+
+// With BIG_TEXT=1 (MY_TERMINAL_BIG_TEXT, which also sets DVI_VERTICAL_REPEAT
+// to 2) every scanline is sent twice and every pixel twice, so 640x480 is
+// 40x15. Core1 has half the lines to make and a line time and a half to
+// spare on each, which goes on colour: every row is expanded to RGB565, in
+// any of the 256 colours, even on RP2040 (see double_pixels()).
+#ifndef BIG_TEXT
+#define BIG_TEXT 0
+#endif
+#define TEXT_SCALE (BIG_TEXT ? 2 : 1)
+#if BIG_TEXT && DVI_VERTICAL_REPEAT != 2
+#error "BIG_TEXT needs DVI_VERTICAL_REPEAT=2"
+#endif
+
+// Overlay sprites (ESC[?9001...n) are drawn in RGB565 pixels, and the text
+// under them TMDS encoded again with the SIO encoder, so not on RP2040, nor
+// over the doubled pixels of BIG_TEXT
+#define OVERLAY_RENDER (!PICO_RP2040 && !BIG_TEXT)
 
-// Cursor blink configuration
-#define CURSOR_BLINK_MS 500 // Blink interval in milliseconds
 #define MAIN_LOOP_MIN_MS 10 // Minimum loop frequency to ensure responsiveness
 
+// After IDLE_AFTER_S seconds with no input and nothing left to flip, core0
+// stops the input poll timer and wakes only every IDLE_LOOP_MS (for the
+// watchdog) or on the start bit of the next byte, which puts it back to work.
+// Core1 has to keep sending frames, but already sleeps whenever it is ahead
+// of the serialisers, and blank lines and rows in the cached colours come
+// pre-encoded from the solid line and glyph caches. Keeping encoded rows for
+// more than that doesn't fit: a row of 640x480 is 60 KB of TMDS.
+#ifndef IDLE_AFTER_S
+#define IDLE_AFTER_S 10
+#endif
+#define IDLE_LOOP_MS 250
+
+// How long the regulator is given to reach a display mode's voltage before
+// the clock goes up. main() builds the first screen in the meantime.
+#define VREG_SETTLE_MS 10
+
+// With CAPTURE_LOG=1 (MY_TERMINAL_CAPTURE_LOG) everything parsed from the
+// main input is also kept in the last CAPTURE_LOG_BYTES of flash, so what a
+// target printed before it died overnight is still there after a reset.
+// Bytes are staged in SRAM and written once input has been quiet for
+// CAPTURE_QUIET_MS, or sooner if the staging is filling up. The build then
+// runs from SRAM (copy_to_ram), so neither core nor any interrupt touches
+// flash while it is being written and the display carries on through it.
+// ESC[?9003;1n replays the log on screen and ESC[?9003;2n dumps it over USB.
+#ifndef CAPTURE_LOG
+#define CAPTURE_LOG 0
+#endif
+#define CAPTURE_LOG_BYTES (1u << 20)
+#define CAPTURE_STAGE_PAGES 16 // A sector of 256 byte pages
+#define CAPTURE_QUIET_MS 250
+
+// How long core1 may wait at VSYNC for core0 to finish a write before the
+// flip is put off to the next frame. Well inside the vertical blanking
+// interval, which core1 reaches with the first lines of the frame still to
+// encode (see perform_swap_within()).
+#define FLIP_WAIT_US 500
+
+// With SWAP_BELOW_BEAM=1 core1 also flips at the start of any text row, not
+// only at VSYNC, so a change to a row the beam has yet to reach is shown in
+// the frame being sent. Rows above the beam catch up a frame later, so a
+// change spanning the beam shows torn for that one frame.
+#ifndef SWAP_BELOW_BEAM
+#define SWAP_BELOW_BEAM 0
+#endif
+
+// With LATENCY_TEST=1 LATENCY_TEST_PIN goes high at the start bit of a byte
+// received while core0 is idle, and low once core1 has queued the first
+// scanline of a row changed by the flip after it, a few lines before that
+// line is on the wire. Across RX on a scope, that is key to photon.
+#ifndef LATENCY_TEST
+#define LATENCY_TEST 0
+#endif
+#define LATENCY_TEST_PIN 22
+
+// With SESSIONS=2 or 3 (MY_TERMINAL_SESSIONS) the screen is split into that
+// many panes, one above the other, each a terminal of its own with its own
+// input: the first is UART_ID and USB as ever, the second uart1 on
+// UART1_RX_PIN and the third a receive-only PIO UART on PIO_UART_RX_PIN, all
+// at BAUD_RATE. The extra inputs have no flow control. With CONSOLES set to
+// SESSIONS as well (MY_TERMINAL_CONSOLES) they are virtual consoles instead,
+// each a whole screen, shown one at a time and switched with Ctrl+W.
+#ifndef SESSIONS
+#define SESSIONS 1
+#endif
+#if SESSIONS < 1 || SESSIONS > MAX_SESSIONS
+#error "SESSIONS must be from 1 to MAX_SESSIONS"
+#endif
+#if CONSOLES > 1 && CONSOLES != SESSIONS
+#error "CONSOLES is SESSIONS, for a console per session, or 1"
+#endif
+#if FONT_8X8 && CONSOLES > 1
+#error "FONT_8X8 screens are twice the size, and only two fit in SRAM beside the history"
+#endif
+
+// With USB_KEYBOARD (MY_TERMINAL_USB_KEYBOARD) the native USB port is a host
+// for a keyboard instead of USB CDC, and what is typed goes to the host on
+// UART_TX_PIN with the replies. With LOCAL_ECHO it also goes on screen, for
+// a host that doesn't echo.
+#ifndef USB_KEYBOARD
+#define USB_KEYBOARD 0
+#endif
+#ifndef LOCAL_ECHO
+#define LOCAL_ECHO 0
+#endif
+#if USB_KEYBOARD && LIB_PICO_STDIO_USB
+#error "USB_KEYBOARD needs the USB port, so stdio over USB must be off"
+#endif
+#define KEY_REPEAT_DELAY_MS 500
+#define KEY_REPEAT_MS 33
+
+// With DUAL_HEAD (MY_TERMINAL_DUAL_HEAD) a second DVI output on pio1 mirrors
+// the first (see dvi_init_mirror()). It sends the very TMDS buffers core1
+// queues for the first, so it costs DMA bandwidth and one TMDS buffer but no
+// encoding, and the glyph and solid line caches serve both. It takes six
+// more DMA channels, which RP2040 hasn't got, and needs the PIO serialiser.
+// DVI_MIRROR_SERIAL_CONFIG gives its pins: by default TMDS pairs on GPIO8,
+// 10 and 20 and the clock on GPIO26, which are free on a Pico 2.
+#ifndef DUAL_HEAD
+#define DUAL_HEAD 0
+#endif
+#if DUAL_HEAD && (DVI_HSTX || PICO_RP2040)
+#error "DUAL_HEAD needs the PIO serialiser and RP2350's DMA channels"
+#endif
+#if DUAL_HEAD && (SESSIONS > 2 || (DMA_GATHER_RENDER && SESSIONS > 1))
+#error "DUAL_HEAD takes 12 of the 16 DMA channels, too many for these inputs"
+#endif
+#ifndef DVI_MIRROR_SERIAL_CONFIG
+#define DVI_MIRROR_SERIAL_CONFIG mirror_head_cfg
+#endif
+#if DUAL_HEAD
+static const struct dvi_serialiser_cfg mirror_head_cfg = {
+    .pio = pio1,
+    .sm_tmds = {0, 1, 2},
+    .pins_tmds = {8, 10, 20},
+    .pins_clk = 26,
+    .invert_diffpairs = false
+};
+#endif
+
 // === Global State ===
 struct dvi_inst dvi0;
-static uint8_t font_scanline[FONT_N_CHARS * FONT_CHAR_HEIGHT];
+#if DUAL_HEAD
+struct dvi_inst dvi1; // Mirrors dvi0
+#endif
 
-// Double buffering
-__attribute__((aligned(4))) static char charbuf_front[CHAR_ROWS * CHAR_COLS];
-__attribute__((aligned(4))) static char charbuf_back[CHAR_ROWS * CHAR_COLS];
+// Encode cost per scanline on one core (three planes at about 16 cycles per
+// character on the M33, see tmds_encode_font_2bpp.S) against the line time
+// in system clocks, which is 10 per pixel of the total line width:
+//   640x480  80 cols  3840 / 8000   48%
+//   800x480 100 cols  4992 / 9920   50%   (104 columns, whole groups of 8)
+//   800x600 100 cols  4992 / 9600   52%   (reduced blanking)
+//   960x540 120 cols  5760 / 11040  52%
+//  1280x720 160 cols  7680 / 16500  47%   (30 Hz)
+// Rows in the one colour pair of the monochrome glyph cache cost about a
+// third of this. The M0+ loop costs about 1.5x the full encode. The SIO
+// TMDS encoder (tmds_encode_font_sio()) does all 3 lanes in one pass, at
+// about 65 cycles per character; it is used if it times faster at boot, and
+// always for rows with extended colours (at most 7800 / 11040, 71%, at
+// 960x540). With DVI_HSTX the software only expands pixels, at about 35
+// cycles per character, and the HSTX clock is half the system clock, so 186 MHz at
+// 1280x720 (over its rated 150 MHz, as the 800x600 to 960x540 modes are). The Ctrl+V menu shows the worst line
+// measured in the mode in use, which also includes the DVI IRQs. These are
+// per scanline, so the same with FONT_8X8; only the work done once per text
+// row (the menu copy, the row's pointers) comes round twice as often.
+typedef struct {
+    const struct dvi_timing *timing;
+    enum vreg_voltage vsel;
+    const char *name;
+} display_mode_t;
+
+static const display_mode_t display_modes[] = {
+    {&dvi_timing_640x480p_60hz,         VREG_VOLTAGE_1_20, "640x480 "},
+    {&dvi_timing_800x480p_60hz,         VREG_VOLTAGE_1_20, "800x480 "},
+    {&dvi_timing_800x600p_reduced_60hz, VREG_VOLTAGE_1_30, "800x600 "},
+    {&dvi_timing_960x540p_60hz,         VREG_VOLTAGE_1_30, "960x540 "},
+    {&dvi_timing_1280x720p_30hz,        VREG_VOLTAGE_1_30, "1280x720"},
+};
+#define N_DISPLAY_MODES (sizeof(display_modes) / sizeof(display_modes[0]))
+
+// The mode is kept in a watchdog scratch register, which survives the reboot
+// used to change it (the clocks and libdvi can only be set up once)
+#define DISPLAY_MODE_SCRATCH 0
+#define DISPLAY_MODE_MAGIC 0x4d4f4400u
+
+static uint display_mode;
+static uint frame_width;
+static uint frame_height;
+
+// Worst time core1 took to produce a line (or a pair, with DUAL_CORE_RENDER)
+// during the last frame, and the time one line is on screen
+static volatile uint32_t encode_us_worst;
+static uint32_t line_period_ns;
+
+// Rows with attributes are encoded by first working out the final pixels of
+// each cell into attr_line (one per core), then passing that to the encoder
+// as the characters, with a font line that maps every byte to itself
+static uint8_t identity_font_line[256];
+static uint8_t attr_line[2][MAX_CHAR_COLS + CHARBUF_PAD];
+
+// Where core1's hot data lives:
+//   SCRATCH_X    core1's stack, the palette LUT and its encoder, libdvi's IRQ
+//                code, and core1's copy of the font line it is encoding
+//   SCRATCH_Y    core0's stack and core0's copy (DUAL_CORE_RENDER)
+//   main SRAM    font_ram, the flip buffers, TMDS lines and the glyph caches
+// The font is read for every character of every plane, so those reads go to
+// a bank that only the encoding core uses, as libdvi does with its fullres LUT,
+// and core0's parsing and copying can't hold them up. The front buffers can't
+// be kept apart the same way, since the flip hands them back to core0 as the
+// back buffer, so core1 just has bus priority for those.
+#if SCRATCH_FONT_LINE
+typedef struct {
+    uint32_t font_line[FONT_N_CHARS / 4];
+    uint8_t identity[FONT_N_CHARS]; // identity_font_line, for rows with attributes
+} scratch_lines_t;
+static scratch_lines_t __scratch_x("scratch_lines") scratch_lines_x;
+static scratch_lines_t __scratch_y("scratch_lines") scratch_lines_y;
+#endif
+static uint32_t cursor_colours[2][4 * MAX_COLOUR_ROW_WORDS]; // Cursor row colours and ext, per core
+
+// Double width and double height rows are encoded from a copy with each of
+// the first half of the cells made into two, the left and right halves of
+// its pixels, through the identity font line like rows with attributes
+static uint8_t wide_line[2][MAX_CHAR_COLS + CHARBUF_PAD];
+static uint32_t wide_colours[2][4 * MAX_COLOUR_ROW_WORDS];
+
+// Rows under the menu window are encoded from a copy with the window's cells
+// written over them, made at the row's first scanline. There are two, so that
+// the last lines of one row can still be encoding on core0 while the copy of
+// the next is made.
+typedef struct {
+    uint8_t chars[MAX_CHAR_COLS + CHARBUF_PAD];
+    uint32_t colours[COLOUR_POOL_ENTRY_WORDS + COLOUR_PAD_WORDS];
+    row_info_t info;
+} menu_row_t;
+static menu_row_t menu_rows[2];
 
-__attribute__((aligned(4))) static uint32_t colourbuf_front[3 * COLOUR_PLANE_SIZE_WORDS + COLOUR_PAD_WORDS];
-__attribute__((aligned(4))) static uint32_t colourbuf_back[3 * COLOUR_PLANE_SIZE_WORDS + COLOUR_PAD_WORDS];
+// Rows in the display's colours, two for the same reason (see palette_row())
+typedef struct {
+    uint32_t colours[COLOUR_POOL_ENTRY_WORDS + COLOUR_PAD_WORDS];
+    row_info_t info;
+} palette_row_t;
+static palette_row_t palette_rows[2];
+
+static bool blink_off = false; // Core1's blink phase, changed at VSYNC
+
+// Scanlines that are all background encode to the same TMDS data whatever the
+// characters are, so core1 keeps a few of them ready, keyed by colour, and
+// queues the cached buffer instead of encoding the line again. A slot can only
+// be reused once the DVI IRQ has given back every reference to it.
+#define SOLID_LINE_SLOTS 2
+#define TMDS_LINE_WORDS (3 * MAX_FRAME_WIDTH / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS)
+static uint32_t solid_line[SOLID_LINE_SLOTS][TMDS_LINE_WORDS];
+static uint8_t solid_line_bg[SOLID_LINE_SLOTS] = {ROW_BG_MIXED, ROW_BG_MIXED};
+static uint8_t solid_line_refs[SOLID_LINE_SLOTS];
+
+// On RP2350 rows can also be encoded through the SIO TMDS encoder, 3 lanes
+// per pass (tmds_encode_font_sio()). Which of that and the palette LUT is
+// faster depends on the core and the clock, so both are timed at boot
+// (benchmark_encoders()) and the faster one is used. Rows with extended
+// colours always take the SIO path, and mono cache rows the LUT one.
+static bool use_sio_encoder = false;
+static uint32_t bench_lut_ns; // Time to encode one line, or 0 if not measured
+static uint32_t bench_sio_ns;
+
+// Monochrome glyph cache. With a single colour pair on a row, every glyph
+// line always encodes to the same TMDS words, so core1 can build the
+// scanline by copying 4 words per character per lane instead of running the
+// palette encoder. The cache holds one pair, the pair most of the screen is
+// likely in (see mono_cache_update()). A lane where the pair has the same
+// level is solid whatever the glyph; the other lanes must share one pair of
+// levels (true of all the Ctrl+T themes) or the cache isn't built.
+#define MONO_CACHE_SETTLE_MS 500 // How long the colours must be left alone first
+#define TMDS_WORDS_PER_CHAR (FONT_CHAR_WIDTH / DVI_SYMBOLS_PER_WORD)
+typedef struct {
+    uint8_t fg, bg;
+    uint font;
+    uint8_t glyph_lanes; // Bit p: lane p is copied from glyphs, else from solid
+    uint32_t solid[3][TMDS_WORDS_PER_CHAR]; // One character's worth of each solid lane
+    uint32_t glyphs[FONT_CHAR_HEIGHT][FONT_N_CHARS * TMDS_WORDS_PER_CHAR];
+} mono_cache_t;
+
+static mono_cache_t mono_cache;
+static volatile bool mono_cache_ready = false; // Safe for core1 to use
+static bool frame_mono_ready;                  // Core1's copy for this frame
+static volatile uint32_t frame_count = 0;      // Frames started by core1
+
+#if DMA_GATHER_RENDER
+// A control channel feeds the data channel one source address at a time,
+// as libdvi does for the serialisers: the data channel copies one
+// character's worth of a lane and chains back to the control channel,
+// carrying on from the same write address. The list is ended by a null
+// address, which doesn't trigger. Core1 fills one list while the other runs.
+static uint gather_ctrl_chan;
+static uint gather_data_chan;
+static const uint32_t *gather_list[2][3 * MAX_CHAR_COLS + 1];
+static uint gather_list_next = 0;
+static const uint32_t **gather_list_end;
+static uint32_t *gather_tmdsbuf = NULL; // Line being gathered, queued once complete
+#endif
 
-static volatile bool buffer_lock = false;
-volatile bool swap_pending = false;
-volatile bool scroll_settled = true;
-volatile bool safe_to_scroll = false;
-volatile bool swap_queued = false; // Track if a swap is already queued
+static uint32_t frame_history_view; // Core1's copy of history_view for the frame being drawn
 
 // Input buffers
-static volatile uint8_t uart_buffer[UART_BUFFER_SIZE];
-static volatile uint16_t uart_head = 0;
-static volatile uint16_t uart_tail = 0;
+__attribute__((aligned(UART_BUFFER_SIZE))) static volatile uint8_t uart_buffer[UART_BUFFER_SIZE];
+static uint16_t uart_tail = 0;
+static uint uart_rx_dma_chan;
 static volatile bool uart_overflow = false;
+static bool flow_stopped = false; // The host has been asked to stop sending
+static bool xoff_sent = false;
+
+enum input_source { INPUT_UART, INPUT_USB, INPUT_SESSIONS, N_INPUT_SOURCES };
+static volatile uint32_t input_bytes[N_INPUT_SOURCES]; // Received from each, for the Ctrl+V menu
+static uint32_t capture_bytes, capture_dropped; // Logged to flash or not, with CAPTURE_LOG
+
+// Single producer, single consumer: each index is written by one side only,
+// and free-running, so head - tail is the number of bytes waiting. The
+// parser side keeps no state tied to a core.
+static uint8_t input_ring[INPUT_RING_SIZE];
+static volatile uint32_t input_head = 0; // Written by the front-end
+static volatile uint32_t input_tail = 0; // Written by the parser
+static repeating_timer_t input_poll_timer;
+static volatile bool rx_edge = false; // A start bit on UART_RX_PIN while idle
+#if LATENCY_TEST
+static volatile bool latency_rx = false; // Set with the pin, until the next flip
+#endif
+
+// The inputs of sessions past the first, each a DMA ring like uart_buffer
+// but parsed straight from there, as they have no flow control to drive
+#if SESSIONS > 1
+typedef struct {
+    uint dma_chan;
+    uint rx_pin;
+    volatile void *src; // Register the bytes are read from
+    uint dreq;
+    uint16_t tail;
+} session_input_t;
+
+__attribute__((aligned(UART_BUFFER_SIZE))) static volatile uint8_t session_rings[SESSIONS - 1][UART_BUFFER_SIZE];
+static session_input_t session_inputs[SESSIONS - 1];
+#endif
 
-// Terminal state
+// Replies on their way out, for session 0 on UART_ID and session 1 on uart1:
+// a DMA channel paced by the UART's TX DREQ reads them from the ring, so
+// queueing one never waits for the wire. Free-running indices as for
+// input_ring: queued up to head, sent up to tail, and handed to the DMA up
+// to dma_end. Only touched with interrupts off, as the input poll timer
+// hands on what was queued while the DMA was busy.
+#define N_UART_TX MIN(SESSIONS, 2)
 typedef struct {
-    uint16_t cursor_x;
-    uint16_t cursor_y;
-    bool cursor_visible;
-    bool escape_mode;
-    bool ansi_mode;
-    bool skip_next_lf;
-    bool skip_next_cr;
-    bool suppress_next_cr;
-} terminal_state_t;
-
-terminal_state_t term;
+    uart_inst_t *uart; // NULL until uart_tx_init()
+    uint dma_chan;
+    uint32_t head, tail, dma_end;
+} uart_tx_t;
+
+__attribute__((aligned(UART_TX_RING_SIZE))) static uint8_t uart_tx_rings[N_UART_TX][UART_TX_RING_SIZE];
+static uart_tx_t uart_tx[N_UART_TX];
 
 // === Global Additions ===
-volatile bool input_active = false;
-absolute_time_t last_input_time;
-
-// Cursor and rendering state
-bool cursor_drawn = false;
-int saved_cursor_x = -1;
-int saved_cursor_y = -1;
-int cursor_draw_x = -1;
-int cursor_draw_y = -1;
-char saved_cursor_char = ' ';
-uint8_t saved_cursor_fg = 0;
 volatile absolute_time_t led_off_time;
-volatile uint32_t cursor_blink_counter = 0; // Counter for blink timing
-volatile bool buffer_dirty = false;
+static absolute_time_t idle_time; // When core0 may go idle, if nothing arrives first
+static bool core0_idle = false;
 static char deferred_char;
 static bool deferred_pending = false;
 
-// ANSI parsingUART_ID
-#define ANSI_PARAM_MAX 4
-uint8_t ansi_params[ANSI_PARAM_MAX];
-uint8_t ansi_param_count = 0;
-uint8_t ansi_param_index = 0;
-char ansi_buffer[16];
-uint8_t ansi_buf_len = 0;
-char ansi_final_char = '\0';
-
-// Theme and cursor
-enum cursor_style { CURSOR__SOLID_BLOCK, CURSOR_UNDERLINE, CURSOR_BAR, CURSOR_APPLE_I, CURSOR_SHADED_BLOCK, CURSOR__SOLID_ARROW };
-enum cursor_style current_cursor = CURSOR_APPLE_I;
-uint8_t current_fg = 12;
-uint8_t current_bg = 0;
-
-// Menu system
-#define MENU_BUFFER_WIDTH 34
-#define MENU_BUFFER_HEIGHT 12  // Increased for color menu
-char saved_chars[MENU_BUFFER_HEIGHT][MENU_BUFFER_WIDTH];
-uint8_t saved_fg[MENU_BUFFER_HEIGHT][MENU_BUFFER_WIDTH];
-uint8_t saved_bg[MENU_BUFFER_HEIGHT][MENU_BUFFER_WIDTH];
-uint16_t menu_left = 0;
-uint16_t menu_top = 0;
-volatile bool theme_select_mode = false;
-volatile bool cursor_menu_mode = false;
-volatile bool bg_color_menu_mode = false;
-volatile bool fg_color_menu_mode = false;
-char color_menu_buf[3] = {0};
-uint8_t color_menu_buf_len = 0;
-
-// Function Prototypes
-uint8_t reverse_byte(uint8_t b);
-
 // Hardware config
 #define UART_ID uart0
 #define BAUD_RATE 115200
+#define UART_TX_PIN 0
 #define UART_RX_PIN 1
+#define UART_CTS_PIN 2
+#define UART_RTS_PIN 3
+#define UART1_TX_PIN 4 // Session 1 (SESSIONS > 1)
+#define UART1_RX_PIN 5
+#define PIO_UART_RX_PIN 6 // Session 2 (SESSIONS > 2)
+#define XON 0x11
+#define XOFF 0x13
 
 #define LED_PIN 25
 
 // Removed awaiting_fg_code and awaiting_bg_code - now using menu system
 
-// === Utilities ===
-uint8_t reverse_byte(uint8_t b) {
-    b = (b >> 4) | (b << 4);
-    b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
-    b = ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
-    return b;
+// === Display Modes ===
+// Pick up the mode chosen before the last reboot and size the screen to it
+static void select_display_mode(void) {
+    uint32_t saved = watchdog_hw->scratch[DISPLAY_MODE_SCRATCH];
+    display_mode = DEFAULT_DISPLAY_MODE;
+    if ((saved & ~0xFFu) == DISPLAY_MODE_MAGIC && (saved & 0xFF) < N_DISPLAY_MODES) {
+        display_mode = saved & 0xFF;
+    }
+    
+    const struct dvi_timing *t = display_modes[display_mode].timing;
+    frame_width = t->h_active_pixels;
+    frame_height = t->v_active_lines / DVI_VERTICAL_REPEAT; // The lines core1 makes
+    terminal_set_geometry(frame_width / (FONT_CHAR_WIDTH * TEXT_SCALE), frame_height / FONT_CHAR_HEIGHT);
+    
+    uint h_total = t->h_front_porch + t->h_sync_width + t->h_back_porch + t->h_active_pixels;
+    line_period_ns = (uint32_t)((uint64_t)h_total * 10 * 1000000 * DVI_VERTICAL_REPEAT / t->bit_clk_khz);
+}
+
+// Chosen from the Ctrl+V menu: a new mode is applied by rebooting into it
+bool platform_select_display_mode(uint mode) {
+    if (mode >= N_DISPLAY_MODES) {
+        return false;
+    }
+    if (mode == display_mode) {
+        return true;
+    }
+    watchdog_hw->scratch[DISPLAY_MODE_SCRATCH] = DISPLAY_MODE_MAGIC | mode;
+    watchdog_reboot(0, 0, 10);
+    while (1) {
+        tight_loop_contents();
+    }
+}
+
+// === Monochrome Glyph Cache ===
+// A font switch takes the cache away from core1 at the same flip
+void platform_font_changed(void) {
+    mono_cache_ready = false;
+}
+
+// Build the cache for the colour pair in use once it has been left alone for
+// a while. Called from the main loop, not holding the back buffer. The cache
+// is taken away from core1 first, and only rewritten once core1 has started
+// two frames since, so no line it prepared with the old one is still being
+// encoded.
+static void mono_cache_update(void) {
+    if (DVI_HSTX || BIG_TEXT) return; // Pixels are cheaper to expand than to copy
+    
+    static uint8_t settle_fg, settle_bg;
+    static absolute_time_t settle_time;
+    static bool rebuilding = false;
+    static uint32_t rebuild_frame;
+    
+    // The pair as it is shown
+    uint8_t fg = palette_colour(&display_palette, current_fg);
+    uint8_t bg = palette_colour(&display_palette, current_bg);
+    if (display_palette.reverse) {
+        uint8_t t = fg;
+        fg = bg;
+        bg = t;
+    }
+    if (fg != settle_fg || bg != settle_bg) {
+        settle_fg = fg;
+        settle_bg = bg;
+        settle_time = make_timeout_time_ms(MONO_CACHE_SETTLE_MS);
+        return;
+    }
+    if (!time_reached(settle_time)) return;
+    if ((fg | bg) & COLOUR_EXT_BITS) return; // Those rows take the SIO path
+    
+    if (mono_cache_ready) {
+        if (mono_cache.fg == fg && mono_cache.bg == bg && mono_cache.font == current_font) return;
+        mono_cache_ready = false;
+    }
+    
+    // Lanes where the pair differs must all have the same two levels
+    uint32_t glyph_nibble = 0;
+    uint8_t glyph_lanes = 0;
+    for (int p = 0; p < 3; p++) {
+        uint32_t f = (fg >> (2 * p)) & 0x3, b = (bg >> (2 * p)) & 0x3;
+        if (f == b) continue;
+        uint32_t nibble = f | (b << 2);
+        if (glyph_lanes && nibble != glyph_nibble) return;
+        glyph_nibble = nibble;
+        glyph_lanes |= 1u << p;
+    }
+    
+    if (!rebuilding) {
+        rebuilding = true;
+        rebuild_frame = frame_count;
+        return;
+    }
+    if (frame_count - rebuild_frame < 2) return;
+    rebuilding = false;
+    
+    // All 256 glyphs side by side make one row for the encoder, so each font
+    // line is a single call
+    uint32_t colours[FONT_N_CHARS / 8];
+    const uint8_t *font = fonts[current_font].scanline;
+    if (glyph_lanes) {
+        for (uint w = 0; w < FONT_N_CHARS / 8; w++) {
+            colours[w] = glyph_nibble * 0x11111111u;
+        }
+        for (uint y = 0; y < FONT_CHAR_HEIGHT; y++) {
+            tmds_encode_font_2bpp(identity_font_line, colours, mono_cache.glyphs[y],
+                                  FONT_N_CHARS * FONT_CHAR_WIDTH, &font[y * FONT_N_CHARS]);
+        }
+    }
+    for (int p = 0; p < 3; p++) {
+        if (glyph_lanes & (1u << p)) continue;
+        // The same level for foreground and background, so any glyph will
+        // do. The encoder always does 8 characters.
+        uint32_t level = (bg >> (2 * p)) & 0x3;
+        uint32_t solid[8 * TMDS_WORDS_PER_CHAR];
+        colours[0] = (level | level << 2) * 0x11111111u;
+        tmds_encode_font_2bpp(identity_font_line, colours, solid, 8 * FONT_CHAR_WIDTH,
+                              identity_font_line);
+        memcpy(mono_cache.solid[p], solid, sizeof(mono_cache.solid[p]));
+    }
+    mono_cache.fg = fg;
+    mono_cache.bg = bg;
+    mono_cache.font = current_font;
+    mono_cache.glyph_lanes = glyph_lanes;
+    __dmb();
+    mono_cache_ready = true;
+}
+
+// === Colours ===
+// Two RGB565 pixels for each pair of 2bpp grey pixels of a Sixel strip, at
+// the levels tmds_encode_2bpp() gives them
+static uint32_t grey_pairs_rgb565[16];
+
+// Fill in the pixel of every colour for the SIO and HSTX encoders
+// (font_palette_rgb565), at the levels the engine's colours stand for
+static void init_palette(void) {
+    for (uint i = 0; i < 16; i++) {
+        uint32_t pair = 0;
+        for (uint p = 0; p < 2; p++) {
+            uint v = ((i >> (2 * p)) & 0x3) * 85;
+            pair |= ((v >> 3) << 11 | (v >> 2) << 5 | (v >> 3)) << (16 * p);
+        }
+        grey_pairs_rgb565[i] = pair;
+    }
+    for (uint c = 0; c < 256; c++) {
+        uint r = colour_level((c >> 4) & 0x3, c & COLOUR_EXT_R);
+        uint g = colour_level((c >> 2) & 0x3, c & COLOUR_EXT_G);
+        uint b = (c & 0x3) * 85;
+        uint32_t pixel = (r >> 3) << 11 | (g >> 2) << 5 | (b >> 3);
+        font_palette_rgb565[c] = pixel * 0x10001u;
+    }
+}
+
+// === Menus ===
+// Lists the display modes, with the encode time measured in this one: the
+// worst line core1 produced in the last frame against the line period, and
+// what each text encoder took for a line at boot. Also the bytes received
+// from each input.
+void platform_draw_mode_menu(void) {
+    static char text[N_DISPLAY_MODES + 5][32];
+    const char *lines[N_DISPLAY_MODES + 5];
+    size_t n = 0;
+    
+    snprintf(text[n++], sizeof(text[0]), "Display Mode Menu:");
+    for (uint m = 0; m < N_DISPLAY_MODES; m++) {
+        const struct dvi_timing *t = display_modes[m].timing;
+        snprintf(text[n++], sizeof(text[0]), "[%u] %s %ux%u%s", m + 1, display_modes[m].name,
+                 t->h_active_pixels / (FONT_CHAR_WIDTH * TEXT_SCALE),
+                 t->v_active_lines / DVI_VERTICAL_REPEAT / FONT_CHAR_HEIGHT,
+                 m == display_mode ? " *" : "");
+    }
+    uint32_t worst_ns = encode_us_worst * 1000 / (DUAL_CORE_RENDER ? 2 : 1);
+    snprintf(text[n++], sizeof(text[0]), "Encode %lu/%lu ns (%lu%%)",
+             (unsigned long)worst_ns, (unsigned long)line_period_ns,
+             (unsigned long)(worst_ns * 100 / line_period_ns));
+    if (bench_lut_ns) {
+        snprintf(text[n++], sizeof(text[0]), "LUT %lu SIO %lu ns, %s",
+                 (unsigned long)bench_lut_ns, (unsigned long)bench_sio_ns,
+                 use_sio_encoder ? "SIO" : "LUT");
+    }
+    snprintf(text[n++], sizeof(text[0]), "UART %lu USB %lu bytes",
+             (unsigned long)input_bytes[INPUT_UART], (unsigned long)input_bytes[INPUT_USB]);
+    snprintf(text[n++], sizeof(text[0]), "Select mode (reboots): ");
+    
+    for (size_t i = 0; i < n; i++) {
+        lines[i] = text[i];
+    }
+    draw_text_menu(lines, n);
+}
+
+// === Replies ===
+static void uart_tx_init(uint i, uart_inst_t *uart) {
+    uart_tx_t *tx = &uart_tx[i];
+    tx->dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(tx->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_ring(&c, false, UART_TX_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(uart, true));
+    dma_channel_configure(tx->dma_chan, &c, &uart_get_hw(uart)->dr, uart_tx_rings[i], 0, false);
+    tx->uart = uart;
+}
+
+// Hand each UART's DMA what has been queued since, once it has sent the last
+// lot. The read address wraps with the ring, so that is always one transfer.
+static void __not_in_flash_func(uart_tx_kick)(void) {
+    for (uint i = 0; i < N_UART_TX; i++) {
+        uart_tx_t *tx = &uart_tx[i];
+        if (!tx->uart || dma_channel_is_busy(tx->dma_chan)) {
+            continue;
+        }
+        tx->tail = tx->dma_end;
+        uint32_t n = tx->head - tx->tail;
+        if (n) {
+            dma_channel_transfer_from_buffer_now(tx->dma_chan,
+                                                 &uart_tx_rings[i][tx->tail & (UART_TX_RING_SIZE - 1)], n);
+            tx->dma_end = tx->head;
+            stats.tx_bytes += n;
+        }
+    }
+}
+
+// Queue a reply for session's UART, whole or not at all, as half a report
+// would be misread. Session 2's PIO UART only receives.
+static void uart_reply(uint session, const char *s, size_t n) {
+    if (session >= N_UART_TX) {
+        return;
+    }
+    uint32_t irq_state = save_and_disable_interrupts();
+    uart_tx_t *tx = &uart_tx[session];
+    if (tx->uart && n <= UART_TX_RING_SIZE - (tx->head - tx->tail)) {
+        for (size_t i = 0; i < n; i++) {
+            uart_tx_rings[session][tx->head++ & (UART_TX_RING_SIZE - 1)] = s[i];
+        }
+        uart_tx_kick();
+    } else {
+        stats.tx_dropped += n;
+    }
+    restore_interrupts(irq_state);
+}
+
+// Session 0's input comes from the UART and USB CDC alike, so its replies go
+// to both
+void platform_reply(uint session, const char *s, size_t n) {
+    uart_reply(session, s, n);
+#if LIB_PICO_STDIO_USB
+    if (session == 0) {
+        uint32_t irq_state = save_and_disable_interrupts();
+        if (tud_cdc_connected()) {
+            tud_cdc_write(s, n);
+            tud_cdc_write_flush();
+        }
+        restore_interrupts(irq_state);
+    }
+#endif
+}
+
+// === Statistics ===
+// Cycle counts come from the M33's DWT cycle counter, mcycle on RISC-V, or
+// on RP2040 SysTick, which counts down and has only 24 bits. Each core has
+// its own, started by start_cycle_counter() on that core.
+#if PICO_RP2040
+#define CYCLE_COUNT_MASK 0xffffffu
+#else
+#define CYCLE_COUNT_MASK 0xffffffffu
+#endif
+
+static void start_cycle_counter(void) {
+#if PICO_RP2040
+    systick_hw->rvr = CYCLE_COUNT_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+#elif !PICO_RISCV
+    m33_hw->demcr |= M33_DEMCR_TRCENA_BITS;
+    m33_hw->dwt_cyccnt = 0;
+    m33_hw->dwt_ctrl |= M33_DWT_CTRL_CYCCNTENA_BITS;
+#endif
+}
+
+static inline uint32_t read_cycles(void) {
+#if PICO_RP2040
+    return -systick_hw->cvr;
+#elif PICO_RISCV
+    uint32_t cycles;
+    asm volatile ("csrr %0, mcycle" : "=r" (cycles));
+    return cycles;
+#else
+    return m33_hw->dwt_cyccnt;
+#endif
+}
+
+// The statistics as one line of name=value pairs: printed over USB CDC
+// (stdio), and sent to the UART of the session that asked as
+// "ESC P 9000 | pairs ESC \", so a rig on the serial line can poll them too
+void platform_report_stats(uint session) {
+    char pairs[512];
+    snprintf(pairs, sizeof(pairs),
+           "frames=%lu swaps=%lu late=%lu encode_cycles=%lu/%lu/%lu swap_us=%lu/%lu "
+           "in_bps=%lu uart=%lu usb=%lu uart_overflows=%lu bulk_crc_errors=%lu "
+           "bulk_rejected=%lu flips_deferred=%lu late_frame=%lu/%lu late_frames=%lu "
+           "tx=%lu tx_dropped=%lu capture=%lu capture_dropped=%lu",
+           (unsigned long)frame_count, (unsigned long)stats.swaps,
+           (unsigned long)dvi0.late_scanline_total,
+           (unsigned long)stats.encode_cycles_min, (unsigned long)stats.encode_cycles_avg,
+           (unsigned long)stats.encode_cycles_max,
+           (unsigned long)stats.swap_latency_us_last, (unsigned long)stats.swap_latency_us_worst,
+           (unsigned long)stats.ingest_bytes_per_s,
+           (unsigned long)input_bytes[INPUT_UART], (unsigned long)input_bytes[INPUT_USB],
+           (unsigned long)stats.uart_overflows, (unsigned long)stats.bulk_crc_errors,
+           (unsigned long)stats.bulk_rejected, (unsigned long)stats.flips_deferred,
+           (unsigned long)dvi0.late_scanlines_last_frame, (unsigned long)dvi0.late_scanlines_worst_frame,
+           (unsigned long)dvi0.late_frames, (unsigned long)stats.tx_bytes,
+           (unsigned long)stats.tx_dropped, (unsigned long)capture_bytes,
+           (unsigned long)capture_dropped);
+    printf("stats %s\n", pairs);
+    
+    char reply[sizeof(pairs) + 16];
+    int n = snprintf(reply, sizeof(reply), "\x1BP9000|%s\x1B\\", pairs);
+    uart_reply(session, reply, MIN((size_t)n, sizeof(reply) - 1));
+}
+
+// Called from the main loop: the ingest rate over each second
+static void update_ingest_rate(void) {
+    static absolute_time_t next;
+    static uint32_t last_total;
+    if (!time_reached(next)) {
+        return;
+    }
+    next = make_timeout_time_ms(1000);
+    uint32_t total = input_bytes[INPUT_UART] + input_bytes[INPUT_USB] + input_bytes[INPUT_SESSIONS];
+    stats.ingest_bytes_per_s = total - last_total;
+    last_total = total;
+}
+
+// === Capture Log ===
+// The log is a ring of flash pages, each numbered with the pages written
+// before it, so the newest is found at boot and writing carries on after it,
+// round and round, which wears every sector alike. Each sector is erased as
+// the ring comes to it. A page cut short by a reset fails its check and is
+// passed over.
+#define CAPTURE_PAGE_DATA (FLASH_PAGE_SIZE - 8)
+#define CAPTURE_LOG_PAGES (CAPTURE_LOG_BYTES / FLASH_PAGE_SIZE)
+#define CAPTURE_LOG_OFFSET (PICO_FLASH_SIZE_BYTES - CAPTURE_LOG_BYTES)
+typedef struct {
+    uint32_t seq;   // Pages written before this one, or all ones if erased
+    uint16_t len;   // Bytes of data
+    uint16_t check; // ~len
+    uint8_t data[CAPTURE_PAGE_DATA];
+} capture_page_t;
+
+#if CAPTURE_LOG
+static_assert(sizeof(capture_page_t) == FLASH_PAGE_SIZE, "");
+
+// Pages waiting to be written, to consecutive pages from capture_head:
+// capture_staged of them full, and the one after that being filled
+static capture_page_t capture_stage[CAPTURE_STAGE_PAGES];
+static uint capture_staged;
+static uint capture_head;
+static uint32_t capture_seq;           // Of the page written next
+static bool capture_ready;             // The log's flash is clear of the program
+static absolute_time_t capture_quiet;  // Staged pages can be written from then
+static volatile uint capture_request;  // From platform_capture_log()
+
+static inline const capture_page_t *capture_flash_page(uint i) {
+    return (const capture_page_t *)(uintptr_t)(XIP_BASE + CAPTURE_LOG_OFFSET + i * FLASH_PAGE_SIZE);
+}
+
+static inline bool capture_page_valid(const capture_page_t *p) {
+    return p->seq != 0xFFFFFFFFu && p->len <= CAPTURE_PAGE_DATA && (uint16_t)~p->len == p->check;
+}
+
+// Carry on from the newest page written before the reset
+static void capture_init(void) {
+    extern char __flash_binary_end;
+    if ((uintptr_t)&__flash_binary_end - XIP_BASE > CAPTURE_LOG_OFFSET) {
+        printf("capture log: the program reaches into its flash, so it is off\n");
+        return;
+    }
+    bool found = false;
+    for (uint i = 0; i < CAPTURE_LOG_PAGES; i++) {
+        const capture_page_t *p = capture_flash_page(i);
+        if (capture_page_valid(p) && (!found || (int32_t)(p->seq - capture_seq) >= 0)) {
+            capture_seq = p->seq + 1;
+            capture_head = (i + 1) % CAPTURE_LOG_PAGES;
+            found = true;
+        }
+    }
+    capture_ready = true;
+}
+
+static void capture_append(const uint8_t *buf, size_t n) {
+    if (!capture_ready) {
+        return;
+    }
+    capture_quiet = make_timeout_time_ms(CAPTURE_QUIET_MS);
+    while (n) {
+        if (capture_staged == CAPTURE_STAGE_PAGES) {
+            capture_dropped += n;
+            return;
+        }
+        capture_page_t *p = &capture_stage[capture_staged];
+        size_t k = MIN(n, CAPTURE_PAGE_DATA - p->len);
+        memcpy(&p->data[p->len], buf, k);
+        p->len += k;
+        capture_bytes += k;
+        buf += k;
+        n -= k;
+        if (p->len == CAPTURE_PAGE_DATA) {
+            capture_staged++;
+        }
+    }
+}
+
+// Write out the staged pages, a run to the end of a sector at a time. An
+// erase holds core0 for some 50 ms, while the timer keeps taking input in.
+static void capture_flush(void) {
+    uint n = capture_staged;
+    if (n < CAPTURE_STAGE_PAGES && capture_stage[n].len) {
+        n++;
+    }
+    for (uint i = 0; i < n; ) {
+        uint32_t offset = CAPTURE_LOG_OFFSET + capture_head * FLASH_PAGE_SIZE;
+        uint run = MIN(n - i, (FLASH_SECTOR_SIZE - offset % FLASH_SECTOR_SIZE) / FLASH_PAGE_SIZE);
+        if (offset % FLASH_SECTOR_SIZE == 0) {
+            flash_range_erase(offset, FLASH_SECTOR_SIZE);
+        }
+        for (uint j = i; j < i + run; j++) {
+            capture_stage[j].seq = capture_seq++;
+            capture_stage[j].check = ~capture_stage[j].len;
+        }
+        flash_range_program(offset, (const uint8_t *)&capture_stage[i], run * FLASH_PAGE_SIZE);
+        capture_head = (capture_head + run) % CAPTURE_LOG_PAGES;
+        i += run;
+        watchdog_update();
+    }
+    for (uint i = 0; i < n; i++) {
+        capture_stage[i].len = 0;
+    }
+    capture_staged = 0;
+}
+
+// Everything logged, oldest first: the ring from the page after the newest,
+// then what is still staged
+static void capture_for_each(void (*fn)(const uint8_t *data, size_t n)) {
+    for (uint i = 0; i < CAPTURE_LOG_PAGES; i++) {
+        const capture_page_t *p = capture_flash_page((capture_head + i) % CAPTURE_LOG_PAGES);
+        if (capture_page_valid(p) && p->len) {
+            fn(p->data, p->len);
+        }
+    }
+    for (uint i = 0; i <= capture_staged && i < CAPTURE_STAGE_PAGES; i++) {
+        if (capture_stage[i].len) {
+            fn(capture_stage[i].data, capture_stage[i].len);
+        }
+    }
+}
+
+static void capture_replay(const uint8_t *data, size_t n) {
+    lock_back_buffer();
+    handle_chars(data, n);
+    unlock_back_buffer();
+    watchdog_update();
+}
+
+static size_t capture_total;
+
+static void capture_count(const uint8_t *data, size_t n) {
+    (void)data;
+    capture_total += n;
+}
+
+// Straight to USB CDC, waiting for room, for as long as the host takes it
+static void capture_dump(const uint8_t *data, size_t n) {
+#if LIB_PICO_STDIO_USB
+    absolute_time_t give_up = make_timeout_time_ms(500);
+    while (n && tud_cdc_connected() && !time_reached(give_up)) {
+        uint32_t irq_state = save_and_disable_interrupts();
+        uint32_t k = tud_cdc_write(data, n);
+        tud_cdc_write_flush();
+        restore_interrupts(irq_state);
+        if (k) {
+            data += k;
+            n -= k;
+            give_up = make_timeout_time_ms(500);
+        }
+        watchdog_update();
+    }
+#else
+    (void)data;
+    (void)n;
+#endif
+}
+
+// Called from the main loop, not holding the back buffer. Replayed bytes go
+// straight to the parser, so they aren't logged again.
+static void capture_service(void) {
+    uint request = capture_request;
+    capture_request = 0;
+    if (request == 1) {
+        capture_for_each(capture_replay);
+    } else if (request == 2) {
+        capture_total = 0;
+        capture_for_each(capture_count);
+        printf("capture %lu bytes\n", (unsigned long)capture_total);
+        capture_for_each(capture_dump);
+    }
+    
+    bool staged = capture_staged || capture_stage[0].len;
+    if (capture_staged >= CAPTURE_STAGE_PAGES * 3 / 4 || (staged && time_reached(capture_quiet))) {
+        capture_flush();
+    }
+}
+
+// ESC[?9003;action n, from the parser: done from the main loop
+void platform_capture_log(uint action) {
+    capture_request = action;
+}
+#else
+static inline void capture_init(void) {}
+static inline void capture_append(const uint8_t *buf, size_t n) { (void)buf; (void)n; }
+static inline void capture_service(void) {}
+void platform_capture_log(uint action) { (void)action; }
+#endif
+
+// === Input Handling ===
+static void uart_rx_dma_start(void) {
+    dma_channel_config c = dma_channel_get_default_config(uart_rx_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, UART_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(UART_ID, false));
+    dma_channel_configure(
+        uart_rx_dma_chan,
+        &c,
+        uart_buffer,
+        &uart_get_hw(UART_ID)->dr,
+#if !PICO_RP2040
+        dma_encode_endless_transfer_count(),
+#else
+        0xffffffffu, // ~10 hours at 1 Mbaud; re-armed by poll_input()
+#endif
+        true
+    );
+}
+
+// Index in uart_buffer that the DMA will write next
+static inline uint16_t uart_rx_head(void) {
+    return (dma_hw->ch[uart_rx_dma_chan].write_addr - (uintptr_t)uart_buffer) & (UART_BUFFER_SIZE - 1);
+}
+
+#if SESSIONS > 1
+static void session_input_start(uint i) {
+    session_input_t *in = &session_inputs[i];
+    dma_channel_config c = dma_channel_get_default_config(in->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, UART_RING_BITS);
+    channel_config_set_dreq(&c, in->dreq);
+    dma_channel_configure(
+        in->dma_chan,
+        &c,
+        session_rings[i],
+        in->src,
+#if !PICO_RP2040
+        dma_encode_endless_transfer_count(),
+#else
+        0xffffffffu,
+#endif
+        true
+    );
+}
+
+static inline uint16_t session_input_level(uint i) {
+    const session_input_t *in = &session_inputs[i];
+    uint16_t head = (dma_hw->ch[in->dma_chan].write_addr - (uintptr_t)session_rings[i]) & (UART_BUFFER_SIZE - 1);
+    return (head - in->tail) & (UART_BUFFER_SIZE - 1);
+}
+
+// Session 1 on uart1, session 2 (if any) on a PIO state machine
+static void session_inputs_init(void) {
+    uart_init(uart1, BAUD_RATE);
+    gpio_set_function(UART1_TX_PIN, GPIO_FUNC_UART);
+    gpio_set_function(UART1_RX_PIN, GPIO_FUNC_UART);
+    uart_set_format(uart1, 8, 1, UART_PARITY_NONE);
+    uart_set_fifo_enabled(uart1, true);
+    uart_tx_init(1, uart1);
+    session_inputs[0] = (session_input_t){
+        .rx_pin = UART1_RX_PIN,
+        .src = &uart_get_hw(uart1)->dr,
+        .dreq = uart_get_dreq(uart1, false),
+    };
+#if SESSIONS > 2
+    // pio1, as libdvi has pio0 on RP2040. The byte is in the top of the
+    // FIFO word (see uart_rx.pio), which is little endian.
+    PIO pio = pio1;
+    uint sm = pio_claim_unused_sm(pio, true);
+    uint offset = pio_add_program(pio, &uart_rx_program);
+    uart_rx_program_init(pio, sm, offset, PIO_UART_RX_PIN, BAUD_RATE);
+    session_inputs[1] = (session_input_t){
+        .rx_pin = PIO_UART_RX_PIN,
+        .src = (volatile uint8_t *)&pio->rxf[sm] + 3,
+        .dreq = pio_get_dreq(pio, sm, false),
+    };
+#endif
+    for (uint i = 0; i < SESSIONS - 1; i++) {
+        session_inputs[i].dma_chan = dma_claim_unused_channel(true);
+        session_input_start(i);
+    }
+}
+
+static bool session_input_pending(void) {
+    for (uint i = 0; i < SESSIONS - 1; i++) {
+        if (session_input_level(i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Arm or disarm the wake on a start bit for each session's RX pin
+static void session_rx_edges(bool enabled) {
+    for (uint i = 0; i < SESSIONS - 1; i++) {
+        gpio_set_irq_enabled(session_inputs[i].rx_pin, GPIO_IRQ_EDGE_FALL, enabled);
+    }
+}
+
+// Parse what session s (from 1) has received, as process_input() does for
+// the first, and leave session 0 selected for everything else
+static void process_session_input(uint s) {
+    session_input_t *in = &session_inputs[s - 1];
+#if PICO_RP2040
+    if (!dma_channel_is_busy(in->dma_chan)) {
+        session_input_start(s - 1);
+    }
+#endif
+    uint32_t level = session_input_level(s - 1);
+    if (level == 0) {
+        return;
+    }
+    idle_time = make_timeout_time_ms(IDLE_AFTER_S * 1000);
+    if (level > UART_BATCH_MAX) {
+        level = UART_BATCH_MAX;
+    }
+    input_bytes[INPUT_SESSIONS] += level;
+    lock_back_buffer();
+    terminal_select_session(s);
+    begin_char_batch();
+    while (level) {
+        uint32_t n = MIN(level, UART_BUFFER_SIZE - in->tail);
+        put_chars((const uint8_t *)&session_rings[s - 1][in->tail], n);
+        in->tail = (in->tail + n) & (UART_BUFFER_SIZE - 1);
+        level -= n;
+    }
+    end_char_batch();
+    terminal_select_session(0);
+    unlock_back_buffer();
+}
+#else
+static inline bool session_input_pending(void) { return false; }
+static inline void session_rx_edges(bool enabled) { (void)enabled; }
+#endif
+
+// Feed a string through the terminal as if it had arrived on the UART
+void inject_debug_to_uart(const char *msg) {
+    lock_back_buffer();
+    handle_chars((const uint8_t *)msg, strlen(msg));
+    unlock_back_buffer();
+}
+
+// Stop or start the host from the number of bytes received and not yet
+// parsed, with hysteresis between the watermarks. RTS is a plain output rather
+// than the UART's own, which only follows its FIFO, and the DMA keeps that
+// empty. An XOFF or XON that doesn't fit in the TX FIFO is sent next time.
+static void __not_in_flash_func(update_flow_control)(uint32_t fill) {
+    if (fill >= FLOW_HIGH_WATER) {
+        flow_stopped = true;
+    } else if (fill <= FLOW_LOW_WATER) {
+        flow_stopped = false;
+    }
+#if UART_RTS_CTS
+    gpio_put(UART_RTS_PIN, flow_stopped); // Active low
+#endif
+#if UART_XON_XOFF
+    if (xoff_sent != flow_stopped && uart_is_writable(UART_ID)) {
+        uart_putc_raw(UART_ID, flow_stopped ? XOFF : XON);
+        xoff_sent = flow_stopped;
+    }
+#endif
+}
+
+// The I/O front-end: move whatever the UART DMA has delivered into
+// input_ring. Runs from the timer interrupt and (with interrupts off) from the
+// main loop, so only ever one at a time.
+static void __not_in_flash_func(poll_input)(void) {
+#if PICO_RP2040
+    if (!dma_channel_is_busy(uart_rx_dma_chan)) {
+        uart_rx_dma_start();
+    }
+#endif
+    uint16_t level = (uart_rx_head() - uart_tail) & (UART_BUFFER_SIZE - 1);
+    uint32_t in_head = input_head;
+    uint32_t queued = in_head - __atomic_load_n(&input_tail, __ATOMIC_ACQUIRE);
+    update_flow_control(queued + level);
+    if (level == 0) {
+        return;
+    }
+    
+    // The DMA never stops, so all we can detect is the ring getting close to
+    // lapping the reader
+    if (level > UART_BUFFER_SIZE - UART_BUFFER_SIZE / 8) {
+        if (!uart_overflow) {
+            stats.uart_overflows++;
+        }
+        uart_overflow = true;
+    } else if (level < UART_BUFFER_SIZE / 4) {
+        uart_overflow = false;
+    }
+    
+    // Whatever doesn't fit stays in the DMA ring for next time
+    uint32_t space = INPUT_RING_SIZE - queued;
+    if (level > space) {
+        level = space;
+    }
+    for (uint i = 0; i < level; i++) {
+        input_ring[in_head++ & (INPUT_RING_SIZE - 1)] = uart_buffer[uart_tail];
+        uart_tail = (uart_tail + 1) & (UART_BUFFER_SIZE - 1);
+    }
+    input_bytes[INPUT_UART] += level;
+    __atomic_store_n(&input_head, in_head, __ATOMIC_RELEASE);
+}
+
+// The other front-end: read what USB CDC has received straight into
+// input_ring, as much as fits contiguously. Only called with interrupts off,
+// as poll_input() from the timer is the ring's other producer and TinyUSB's
+// task runs from an interrupt. Past FLOW_HIGH_WATER it is left to wait, which
+// holds the host off once TinyUSB's FIFO fills, and the rest of the ring is
+// kept for the UART.
+static void poll_usb_input(void) {
+#if LIB_PICO_STDIO_USB
+    if (!tud_cdc_available()) {
+        return;
+    }
+    uint32_t in_head = input_head;
+    uint32_t queued = in_head - __atomic_load_n(&input_tail, __ATOMIC_ACQUIRE);
+    if (queued >= FLOW_HIGH_WATER) {
+        return;
+    }
+    uint32_t start = in_head & (INPUT_RING_SIZE - 1);
+    uint32_t n = MIN(FLOW_HIGH_WATER - queued, INPUT_RING_SIZE - start);
+    n = tud_cdc_read(&input_ring[start], n);
+    input_bytes[INPUT_USB] += n;
+    __atomic_store_n(&input_head, in_head + n, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline bool usb_input_pending(void) {
+#if LIB_PICO_STDIO_USB
+    return tud_cdc_available() != 0;
+#elif USB_KEYBOARD
+    return tuh_task_event_ready(); // For keyboard_service(), without waiting for the loop
+#else
+    return false;
+#endif
+}
+
+// === USB Keyboard ===
+// HID boot protocol keyboards, through TinyUSB's host stack. Its interrupt
+// only queues what the port did; keyboard_service() runs the rest from the
+// main loop, which a queued event wakes, so a key is in the UART TX ring
+// within microseconds of the report that brought it. None of it touches
+// core1 or the DMA channels libdvi uses.
+#if USB_KEYBOARD
+static const uint8_t keycode_ascii[128][2] = {HID_KEYCODE_TO_ASCII};
+static uint8_t keys_down[6]; // Of the last report
+static uint8_t repeat_key, repeat_modifiers; // Held down for the typematic repeat, or 0
+static absolute_time_t repeat_time;
+
+// Into the input ring behind whatever is waiting, with interrupts off as
+// poll_input() from the timer also writes it. Dropped if it doesn't all fit.
+static void local_echo(const char *s, size_t n) {
+#if LOCAL_ECHO
+    uint32_t irq_state = save_and_disable_interrupts();
+    uint32_t in_head = input_head;
+    if (n <= INPUT_RING_SIZE - (in_head - __atomic_load_n(&input_tail, __ATOMIC_ACQUIRE))) {
+        for (size_t i = 0; i < n; i++) {
+            input_ring[in_head++ & (INPUT_RING_SIZE - 1)] = s[i];
+        }
+        __atomic_store_n(&input_head, in_head, __ATOMIC_RELEASE);
+    }
+    restore_interrupts(irq_state);
+#else
+    (void)s;
+    (void)n;
+#endif
+}
+
+// The bytes a terminal sends for a key: ASCII, with the control codes for
+// Ctrl, an ESC in front for Alt, and VT220 sequences for the cursor and
+// editing keys
+static void key_pressed(uint8_t key, uint8_t modifiers) {
+    static const char *const nav_keys[] = {
+        "\x1b[2~", "\x1b[H", "\x1b[5~", "\x1b[3~", "\x1b[F", "\x1b[6~", // Insert to Page Down
+        "\x1b[C", "\x1b[D", "\x1b[B", "\x1b[A",                     // Arrows
+    };
+    char s[8];
+    size_t n = 0;
+    if (modifiers & (KEYBOARD_MODIFIER_LEFTALT | KEYBOARD_MODIFIER_RIGHTALT)) {
+        s[n++] = '\x1b';
+    }
+    if (key >= HID_KEY_INSERT && key <= HID_KEY_ARROW_UP) {
+        const char *seq = nav_keys[key - HID_KEY_INSERT];
+        size_t len = strlen(seq);
+        memcpy(&s[n], seq, len); // After Alt's ESC, if there is one
+        n += len;
+    } else if (key < 128 && keycode_ascii[key][0]) {
+        bool shift = modifiers & (KEYBOARD_MODIFIER_LEFTSHIFT | KEYBOARD_MODIFIER_RIGHTSHIFT);
+        char c = keycode_ascii[key][shift];
+        if ((modifiers & (KEYBOARD_MODIFIER_LEFTCTRL | KEYBOARD_MODIFIER_RIGHTCTRL)) && c >= '@') {
+            c &= 0x1f;
+        }
+        s[n++] = c;
+    } else {
+        return;
+    }
+    uart_reply(0, s, n);
+    local_echo(s, n);
+}
+
+void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t const *desc_report, uint16_t desc_len) {
+    (void)desc_report;
+    (void)desc_len;
+    if (tuh_hid_interface_protocol(dev_addr, instance) == HID_ITF_PROTOCOL_KEYBOARD) {
+        memset(keys_down, 0, sizeof(keys_down));
+        repeat_key = 0;
+        tuh_hid_receive_report(dev_addr, instance);
+    }
+}
+
+void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
+    (void)dev_addr;
+    (void)instance;
+    repeat_key = 0;
+}
+
+// Keys in the report that weren't in the last one have just gone down. The
+// newest of them repeats while it is held, until another goes down.
+void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const *report, uint16_t len) {
+    if (len >= sizeof(hid_keyboard_report_t)) {
+        const hid_keyboard_report_t *r = (const hid_keyboard_report_t *)report;
+        if (repeat_key && !memchr(r->keycode, repeat_key, sizeof(r->keycode))) {
+            repeat_key = 0;
+        }
+        for (uint i = 0; i < sizeof(r->keycode); i++) {
+            uint8_t key = r->keycode[i];
+            if (key >= HID_KEY_A && !memchr(keys_down, key, sizeof(keys_down))) {
+                key_pressed(key, r->modifier);
+                repeat_key = key;
+                repeat_time = make_timeout_time_ms(KEY_REPEAT_DELAY_MS);
+            }
+        }
+        repeat_modifiers = r->modifier;
+        memcpy(keys_down, r->keycode, sizeof(keys_down));
+    }
+    tuh_hid_receive_report(dev_addr, instance);
+}
+#endif
+
+static void keyboard_service(void) {
+#if USB_KEYBOARD
+    tuh_task();
+    if (repeat_key && time_reached(repeat_time)) {
+        key_pressed(repeat_key, repeat_modifiers);
+        repeat_time = make_timeout_time_ms(KEY_REPEAT_MS);
+    }
+#endif
+}
+
+// A held key repeats, so the loop mustn't go idle under it
+static inline bool key_repeating(void) {
+#if USB_KEYBOARD
+    return repeat_key != 0;
+#else
+    return false;
+#endif
+}
+
+static bool input_poll_callback(repeating_timer_t *rt) {
+    (void)rt;
+    poll_input();
+    uart_tx_kick();
+    return true;
+}
+
+static void poll_input_now(void) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    poll_input();
+    poll_usb_input();
+    uart_tx_kick(); // The timer is off while idle
+    restore_interrupts(irq_state);
+}
+
+static inline bool input_pending(void) {
+    return __atomic_load_n(&input_head, __ATOMIC_ACQUIRE) != input_tail;
+}
+
+// The falling edge of a start bit wakes core0 from idle_wait() straight
+// away, rather than at the next timer poll. Armed only while idle, and only
+// for the one edge, so a stream of bytes doesn't interrupt for each bit.
+static void __not_in_flash_func(rx_edge_irq)(uint gpio, uint32_t events) {
+    (void)events;
+    gpio_set_irq_enabled(gpio, GPIO_IRQ_EDGE_FALL, false);
+    rx_edge = true;
+#if LATENCY_TEST
+    gpio_put(LATENCY_TEST_PIN, 1);
+    latency_rx = true;
+#endif
+}
+
+// Sleep until there is input or the time until is reached. WFE
+// returns on any interrupt (the input poll timer, USB, the RX edge) and on
+// core1's SEV after each flip. Once a start bit has been seen the byte is
+// waited for here, which takes a character time, rather than going back to
+// sleep until the timer picks it up.
+static void idle_wait(absolute_time_t until) {
+    rx_edge = false;
+    gpio_set_irq_enabled(UART_RX_PIN, GPIO_IRQ_EDGE_FALL, true);
+    session_rx_edges(true);
+    while (!input_pending() && uart_rx_head() == uart_tail && !usb_input_pending() &&
+           !session_input_pending() && !time_reached(until)) {
+        if (rx_edge) {
+            tight_loop_contents();
+        } else {
+            __wfe();
+        }
+    }
+    gpio_set_irq_enabled(UART_RX_PIN, GPIO_IRQ_EDGE_FALL, false);
+    session_rx_edges(false);
+}
+
+// The parser: apply what is waiting in input_ring as one batch, in at most two
+// contiguous pieces. Very long bursts are split so the buffer lock is never
+// held long enough to make core1 miss a flip.
+void process_input(void) {
+    uint32_t tail = input_tail;
+    uint32_t level = __atomic_load_n(&input_head, __ATOMIC_ACQUIRE) - tail;
+    if (level == 0) {
+        return;
+    }
+    
+    gpio_put(LED_PIN, 1);
+    led_off_time = make_timeout_time_ms(30);
+    idle_time = make_timeout_time_ms(IDLE_AFTER_S * 1000);
+    #ifdef DEBUG
+    if (uart_overflow) {
+        printf("UART ring nearly full, %lu bytes waiting\n", (unsigned long)level);
+    }
+    #endif
+    
+    if (level > UART_BATCH_MAX) {
+        level = UART_BATCH_MAX;
+    }
+    lock_back_buffer();
+    begin_char_batch();
+    while (level) {
+        uint32_t start = tail & (INPUT_RING_SIZE - 1);
+        uint32_t n = INPUT_RING_SIZE - start;
+        if (n > level) n = level;
+        put_chars(&input_ring[start], n);
+        capture_append(&input_ring[start], n);
+        tail += n;
+        level -= n;
+    }
+    end_char_batch();
+    unlock_back_buffer();
+    __atomic_store_n(&input_tail, tail, __ATOMIC_RELEASE);
+}
+
+// Go idle once input has stopped for IDLE_AFTER_S and the screen is up to
+// date, and back to polling at the first byte after
+static void update_idle(void) {
+    bool quiet = time_reached(idle_time) && !swap_pending() && !deferred_pending && !search_pending() &&
+                 !bulk_pending() && !key_repeating();
+    if (quiet == core0_idle) {
+        return;
+    }
+    core0_idle = quiet;
+    if (quiet) {
+        cancel_repeating_timer(&input_poll_timer);
+    } else {
+        add_repeating_timer_us(-INPUT_POLL_US, input_poll_callback, NULL, &input_poll_timer);
+    }
+}
+
+// === Overlay ===
+#if OVERLAY_RENDER
+// The images overlay slots can show, 16x16 in libsprite's RGAB5515 (bit 5
+// set where the pixel is opaque), built at boot from these drawings
+#define OVERLAY_LOG_SIZE 4
+#define OVERLAY_IMAGE_SIZE (1u << OVERLAY_LOG_SIZE)
+#define OVERLAY_ALPHA 0x0020u
+#define OVERLAY_GROUP_PIXELS (8 * FONT_CHAR_WIDTH) // Characters sharing a colour word
+
+static const char *const overlay_drawings[][OVERLAY_IMAGE_SIZE] = {
+    { // 1: pointer
+        "#               ",
+        "##              ",
+        "#o#             ",
+        "#oo#            ",
+        "#ooo#           ",
+        "#oooo#          ",
+        "#ooooo#         ",
+        "#oooooo#        ",
+        "#ooooooo#       ",
+        "#oooooooo#      ",
+        "#ooooo#####     ",
+        "#oo#oo#         ",
+        "#o# #oo#        ",
+        "##  #oo#        ",
+        "#    #oo#       ",
+        "     ####       ",
+    },
+    { // 2: paused
+        "                ",
+        "  #####  #####  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #yyy#  #yyy#  ",
+        "  #####  #####  ",
+        "                ",
+    },
+    { // 3: ok
+        "                ",
+        "             ## ",
+        "            #gg#",
+        "           #ggg#",
+        "          #ggg# ",
+        "         #ggg#  ",
+        " ##     #ggg#   ",
+        "#gg#   #ggg#    ",
+        "#ggg# #ggg#     ",
+        " #ggg#ggg#      ",
+        "  #ggggg#       ",
+        "   #ggg#        ",
+        "    #g#         ",
+        "     #          ",
+        "                ",
+        "                ",
+    },
+    { // 4: error
+        "                ",
+        " ##          ## ",
+        "#rr#        #rr#",
+        "#rrr#      #rrr#",
+        " #rrr#    #rrr# ",
+        "  #rrr#  #rrr#  ",
+        "   #rrr##rrr#   ",
+        "    #rrrrrr#    ",
+        "    #rrrrrr#    ",
+        "   #rrr##rrr#   ",
+        "  #rrr#  #rrr#  ",
+        " #rrr#    #rrr# ",
+        "#rrr#      #rrr#",
+        "#rr#        #rr#",
+        " ##          ## ",
+        "                ",
+    },
+};
+#define N_OVERLAY_IMAGES (sizeof(overlay_drawings) / sizeof(overlay_drawings[0]))
+
+static uint16_t overlay_images[N_OVERLAY_IMAGES][OVERLAY_IMAGE_SIZE * OVERLAY_IMAGE_SIZE];
+
+// Pixels of the groups under the sprites, per core, to draw them on
+static uint32_t overlay_pixels[2][MAX_FRAME_WIDTH / 2];
+
+static void init_overlay_images(void) {
+    for (uint i = 0; i < N_OVERLAY_IMAGES; i++) {
+        for (uint p = 0; p < OVERLAY_IMAGE_SIZE * OVERLAY_IMAGE_SIZE; p++) {
+            uint16_t pixel;
+            switch (overlay_drawings[i][p / OVERLAY_IMAGE_SIZE][p % OVERLAY_IMAGE_SIZE]) {
+                case '#': pixel = 0x0000 | OVERLAY_ALPHA; break; // Black
+                case 'o': pixel = 0xFFFF | OVERLAY_ALPHA; break; // White
+                case 'r': pixel = 0xF800 | OVERLAY_ALPHA; break;
+                case 'g': pixel = 0x07E0 | OVERLAY_ALPHA; break;
+                case 'y': pixel = 0xFFE0 | OVERLAY_ALPHA; break;
+                default:  pixel = 0; break; // Transparent
+            }
+            overlay_images[i][p] = pixel;
+        }
+    }
+}
+
+// An overlay slot as a libsprite sprite, x0 pixels from the left of the
+// line. False if the slot is empty or off the screen.
+static bool __not_in_flash_func(overlay_sprite)(const overlay_sprite_t *s, uint x0, sprite_t *sp) {
+    if (s->image == 0 || s->image > N_OVERLAY_IMAGES || s->x >= frame_width || s->y >= frame_height) {
+        return false;
+    }
+    *sp = (sprite_t){
+        .x = (int16_t)(s->x - x0),
+        .y = (int16_t)s->y,
+        .img = overlay_images[s->image - 1],
+        .log_size = OVERLAY_LOG_SIZE,
+    };
+    return true;
+}
+
+// The groups of 8 characters that some sprite covers on scanline y, one bit
+// each, from the front buffer's table
+static uint32_t __not_in_flash_func(overlay_groups)(uint y) {
+    uint32_t groups = 0;
+    for (uint i = 0; i < OVERLAY_SPRITES; i++) {
+        const overlay_sprite_t *s = &screen_front->overlay.sprite[i];
+        sprite_t sp;
+        if (!overlay_sprite(s, 0, &sp) || y - s->y >= OVERLAY_IMAGE_SIZE) {
+            continue;
+        }
+        uint last = MIN(s->x + OVERLAY_IMAGE_SIZE, frame_width) - 1;
+        for (uint g = s->x / OVERLAY_GROUP_PIXELS; g <= last / OVERLAY_GROUP_PIXELS; g++) {
+            groups |= 1u << g;
+        }
+    }
+    return groups;
+}
+#endif
+
+// === Rendering Core ===
+// Core1 keeps count of the TMDS buffers it has queued and not yet had back,
+// rather than simply taking one free buffer per line, because cached solid
+// lines are queued without using up a free buffer. The free buffers it does
+// get back are kept in tmds_spare until a line actually needs encoding.
+static uint32_t *tmds_spare[DVI_N_TMDS_BUFFERS];
+static uint tmds_spare_count = 0;
+static uint tmds_in_flight = DVI_N_TMDS_BUFFERS; // dvi_init() queues them all as free
+
+static void __not_in_flash_func(reclaim_tmds_buffer)(void) {
+    uint32_t *buf;
+    queue_remove_blocking(&dvi0.q_tmds_free, &buf);
+    tmds_in_flight--;
+    for (uint s = 0; s < SOLID_LINE_SLOTS; s++) {
+        if (buf == solid_line[s]) {
+            solid_line_refs[s]--;
+            return;
+        }
+    }
+    tmds_spare[tmds_spare_count++] = buf;
 }
 
-void reset_ansi_state(void) {
-    ansi_param_count = 0;
-    ansi_param_index = 0;
-    ansi_buf_len = 0;
-    ansi_final_char = '\0';
+static uint32_t *__not_in_flash_func(take_tmds_buffer)(void) {
+    while (tmds_spare_count == 0) {
+        reclaim_tmds_buffer();
+    }
+    return tmds_spare[--tmds_spare_count];
 }
 
-// === Buffering System ===
-void request_swap(void) {
-    if (!swap_queued) { // Prevent redundant swap requests
-        swap_pending = true;
-        swap_queued = true;
-        #ifdef DEBUG
-        printf("Swap requested at time=%lld\n", get_absolute_time());
-        #endif
+// Slot already holding a solid line of colour bg, else one that is free to be
+// encoded into, else -1
+static int __not_in_flash_func(solid_line_slot)(uint8_t bg) {
+    for (int s = 0; s < SOLID_LINE_SLOTS; s++) {
+        if (solid_line_bg[s] == bg) return s;
+    }
+    for (int s = 0; s < SOLID_LINE_SLOTS; s++) {
+        if (solid_line_refs[s] == 0) return s;
     }
+    return -1;
 }
 
-void perform_swap(void) {
-    while (__atomic_test_and_set(&buffer_lock, __ATOMIC_ACQUIRE)) {
-        __wfe();
+// Everything needed to encode one scanline, so that either core can do it
+// without looking at the buffer pointers core1 flips
+typedef struct {
+    const uint8_t *chars;
+    const uint32_t *colours;
+    uint plane_stride; // Words from one colour plane of the row to the next
+    const uint8_t *scanline;
+    uint32_t *tmdsbuf;
+    const uint32_t *attrs; // NULL if the row has no attributes
+    const uint32_t *ext;   // EXT_PLANE of the row, NULL if it has no extended colours
+    const cursor_info_t *cursor; // NULL unless the cursor is drawn on this line
+    bool mono; // Copied from mono_cache rather than encoded
+    uint8_t font_y;
+    bool blink_off;
+    uint16_t y;
+    uint32_t overlay; // overlay_groups() of the line, 0 if it has no sprites
+    const uint32_t *gfx; // The line of the row's Sixel strip, drawn instead of the text
+    uint8_t size; // LINE_* of the row
+} line_job_t;
+
+#if OVERLAY_RENDER || BIG_TEXT
+// n_pix pixels of a Sixel strip line as RGB565, 2 per word
+static void __not_in_flash_func(gfx_expand_rgb565)(const uint32_t *gfx, uint32_t *pixbuf, uint n_pix) {
+    for (uint w = 0; w < n_pix / 16; w++) {
+        uint32_t bits = gfx[w];
+        for (uint i = 0; i < 8; i++) {
+            *pixbuf++ = grey_pairs_rgb565[bits & 0xF];
+            bits >>= 4;
+        }
     }
-    
-    memcpy(charbuf_front, charbuf_back, sizeof(charbuf_back));
-    memcpy(colourbuf_front, colourbuf_back, sizeof(colourbuf_back));
-    
-    __atomic_clear(&buffer_lock, __ATOMIC_RELEASE);
-    swap_pending = false;
-    swap_queued = false;
-    scroll_settled = true;
-    safe_to_scroll = true;
-    
-    #ifdef DEBUG
-    printf("Buffer swapped at time=%lld\n", get_absolute_time());
-    #endif
 }
+#endif
 
-void safe_request_swap(void) {
-    if (buffer_dirty || cursor_drawn || term.cursor_visible) {
-        request_swap();
-        perform_swap(); // Forced immediate swap
-        buffer_dirty = false;
+// Apply the attributes of a row to its font bits for one scanline. Font bytes
+// are bit-reversed (bit 0 is the leftmost pixel), so bold smears each pixel
+// one to the right with a left shift.
+static void __not_in_flash_func(resolve_attr_line)(const line_job_t *job, const uint8_t *scanline,
+                                                   uint8_t *out) {
+    for (uint x = 0; x < char_cols; x += 8) {
+        uint32_t attr_word = job->attrs ? job->attrs[x / 8] : 0;
+        for (uint i = 0; i < 8; i++) {
+            uint8_t bits = scanline[job->chars[x + i]];
+            uint attr = attr_word & 0xF;
+            attr_word >>= 4;
+            if (attr) {
+                if (attr & ATTR_BOLD) bits |= bits << 1;
+                if ((attr & ATTR_UNDERLINE) && job->font_y == UNDERLINE_FONT_LINE) bits = 0xFF;
+                if ((attr & ATTR_BLINK) && job->blink_off) bits = 0;
+                if (attr & ATTR_REVERSE) bits = ~bits;
+            }
+            out[x + i] = bits;
+        }
     }
 }
 
-void set_char(uint x, uint y, uint8_t c) {
-    if (x < CHAR_COLS && y < CHAR_ROWS) {
-        charbuf_back[x + y * CHAR_COLS] = c;
+// The cursor replaces its cell, glyph and colours, on a copy of the row. The
+// copy of the extension nibbles goes in the fourth plane of the copy, and is
+// all zero if the row has none. Returns whether it has any.
+static bool __not_in_flash_func(apply_cursor)(const line_job_t *job, const uint8_t *scanline,
+                                              uint8_t *resolved, uint32_t *colours) {
+    const cursor_info_t *cur = job->cursor;
+    resolved[cur->x] = scanline[cur->glyph];
+    
+    uint bit = (cur->x % 8) * 4;
+    for (int p = 0; p < 4; p++) {
+        const uint32_t *src = p < 3 ? job->colours + p * job->plane_stride : job->ext;
+        uint32_t *dst = colours + p * MAX_COLOUR_ROW_WORDS;
+        for (uint w = 0; w < colour_row_words; w++) {
+            dst[w] = src ? src[w] : 0;
+        }
+        uint32_t nibble = ((cur->fg >> (2 * p)) & 0x3) | (((cur->bg >> (2 * p)) & 0x3) << 2);
+        dst[cur->x / 8] = (dst[cur->x / 8] & ~(0xFu << bit)) | (nibble << bit);
     }
+    return job->ext || ((cur->fg | cur->bg) & COLOUR_EXT_BITS);
 }
 
-void set_colour(uint x, uint y, uint8_t fg, uint8_t bg) {
-    if (x >= CHAR_COLS || y >= CHAR_ROWS) return;
-    
-    uint idx = x + y * CHAR_COLS;
-    uint bit = (idx % 8) * 4;
-    uint word = idx / 8;
+// Each of 4 pixels (or 4 colour nibbles) twice
+static const uint8_t double_bits[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+};
 
-    #ifdef DEBUG
-    printf("set_colour: x=%u, y=%u, fg=0x%02X, bg=0x%02X, idx=%u, bit=%u, word=%u\n", 
-           x, y, fg, bg, idx, bit, word);
-    #endif
-    
-    for (int p = 0; p < 3; ++p) {
-        uint32_t val = (fg & 0x3) | ((bg << 2) & 0xC);
-        colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS] =
-            (colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS] & ~(0xFu << bit)) | (val << bit);
-        fg >>= 2;
-        bg >>= 2;
+static inline uint32_t double_nibbles(uint32_t v) {
+    uint32_t out = 0;
+    for (uint i = 0; i < 4; i++) {
+        out |= ((v >> (4 * i)) & 0xF) * 0x11u << (8 * i);
     }
+    return out;
 }
 
-// === Terminal Operations ===
-void clear_screen(void) {
-    while (__atomic_test_and_set(&buffer_lock, __ATOMIC_ACQUIRE)) {
-        __wfe();
+// A double width line: the first half of the cells, each as two, in out
+// (font bits, for the identity font line) and out_colours (the three colour
+// planes, then the extension nibbles if ext isn't NULL)
+static void __not_in_flash_func(widen_line)(const uint8_t *chars, const uint32_t *colours, uint plane_stride,
+                                            const uint32_t *ext, const uint8_t *scanline,
+                                            uint8_t *out, uint32_t *out_colours) {
+    uint half = char_cols / 2;
+    for (uint x = 0; x < half; x++) {
+        uint8_t bits = scanline[chars[x]];
+        out[2 * x] = double_bits[bits & 0xF];
+        out[2 * x + 1] = double_bits[bits >> 4];
     }
-    
-    memset(colourbuf_back, 0, sizeof(colourbuf_back));
-    
-    for (uint y = 0; y < CHAR_ROWS; y++) {
-        for (uint x = 0; x < CHAR_COLS; x++) {
-            charbuf_back[x + y * CHAR_COLS] = ' ';
-            set_colour(x, y, current_fg, current_bg);
+    for (int p = 0; p < (ext ? 4 : 3); p++) {
+        const uint32_t *src = p < 3 ? colours + p * plane_stride : ext;
+        uint32_t *dst = out_colours + p * MAX_COLOUR_ROW_WORDS;
+        for (uint w = 0; w < (half + 7) / 8; w++) {
+            dst[2 * w] = double_nibbles(src[w] & 0xFFFF);
+            dst[2 * w + 1] = double_nibbles(src[w] >> 16);
         }
     }
-    
-    term.cursor_x = 0;
-    term.cursor_y = 0;
-    __atomic_clear(&buffer_lock, __ATOMIC_RELEASE);
-    request_swap();
 }
 
-void scroll_up(void) {
-    while (__atomic_test_and_set(&buffer_lock, __ATOMIC_ACQUIRE)) {
-        __wfe();
-    }
-    
-    // Shift character buffer
-    memmove(&charbuf_back[0], 
-            &charbuf_back[CHAR_COLS], 
-            (CHAR_ROWS - 1) * CHAR_COLS);
-    
-    // Clear the last row of characters
-    for (uint x = 0; x < CHAR_COLS; x++) {
-        charbuf_back[x + (CHAR_ROWS - 1) * CHAR_COLS] = ' ';
-    }
-    
-    // Shift color buffer for all planes
-    for (int p = 0; p < 3; p++) {
-        uint32_t *base = &colourbuf_back[p * COLOUR_PLANE_SIZE_WORDS];
-        memmove(base, 
-                &base[CHAR_COLS / 8], 
-                (CHAR_ROWS - 1) * (CHAR_COLS / 8) * sizeof(uint32_t));
+#if BIG_TEXT
+// Big text lines are made at half width as RGB565 pixels, and every pixel
+// sent twice: with HSTX by a copy, otherwise by libdvi's 16bpp encoders,
+// which double the pixels as they encode them (as in its 320x240 modes)
+static uint32_t big_pixels[2][MAX_FRAME_WIDTH / 4];
+
+static void __not_in_flash_func(double_pixels)(const uint32_t *pixels, uint32_t *tmdsbuf) {
+#if DVI_HSTX
+    for (uint w = 0; w < frame_width / 4; w++) {
+        uint32_t pair = pixels[w];
+        tmdsbuf[2 * w] = (pair & 0xFFFFu) * 0x10001u;
+        tmdsbuf[2 * w + 1] = (pair >> 16) * 0x10001u;
     }
-    
-    // Clear the last row's color data before setting new color
-    for (uint x = 0; x < CHAR_COLS; x++) {
-        uint idx = x + (CHAR_ROWS - 1) * CHAR_COLS;
-        uint bit = (idx % 8) * 4;
-        uint word = idx / 8;
-        for (int p = 0; p < 3; p++) {
-            colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS] &= ~(0xFu << bit); // Clear 4 bits
+#else
+    uint lane_words = frame_width / DVI_SYMBOLS_PER_WORD;
+    tmds_encode_data_channel_16bpp(pixels, tmdsbuf, frame_width / 2, DVI_16BPP_BLUE_MSB, DVI_16BPP_BLUE_LSB);
+    tmds_encode_data_channel_16bpp(pixels, tmdsbuf + lane_words, frame_width / 2, DVI_16BPP_GREEN_MSB, DVI_16BPP_GREEN_LSB);
+    tmds_encode_data_channel_16bpp(pixels, tmdsbuf + 2 * lane_words, frame_width / 2, DVI_16BPP_RED_MSB, DVI_16BPP_RED_LSB);
+#endif
+}
+#endif
+
+// A row in mono_cache's colours: each character is a copy of its glyph line
+static void __not_in_flash_func(copy_mono_line)(const line_job_t *job) {
+    const uint32_t *glyphs = mono_cache.glyphs[job->font_y];
+    for (int plane = 0; plane < 3; plane++) {
+        uint32_t *dst = job->tmdsbuf + plane * (frame_width / DVI_SYMBOLS_PER_WORD);
+        if (mono_cache.glyph_lanes & (1u << plane)) {
+            for (uint x = 0; x < char_cols; x++) {
+                const uint32_t *src = &glyphs[job->chars[x] * TMDS_WORDS_PER_CHAR];
+                for (uint i = 0; i < TMDS_WORDS_PER_CHAR; i++) {
+                    dst[i] = src[i];
+                }
+                dst += TMDS_WORDS_PER_CHAR;
+            }
+        } else {
+            const uint32_t *solid = mono_cache.solid[plane];
+            for (uint x = 0; x < char_cols; x++) {
+                for (uint i = 0; i < TMDS_WORDS_PER_CHAR; i++) {
+                    dst[i] = solid[i];
+                }
+                dst += TMDS_WORDS_PER_CHAR;
+            }
         }
     }
-    
-    // Set the last row with current colors
-    for (uint x = 0; x < CHAR_COLS; x++) {
-        set_colour(x, CHAR_ROWS - 1, current_fg, current_bg);
-    }
-    
-    __atomic_clear(&buffer_lock, __ATOMIC_RELEASE);
-    buffer_dirty = true;
-    safe_request_swap();
 }
 
-void new_line(void) {
-    term.cursor_x = 0;
-    
-    if (++term.cursor_y >= CHAR_ROWS) {
-        term.cursor_y = CHAR_ROWS - 1;
-        scroll_up();
-    }
-    buffer_dirty = true;
-    safe_request_swap(); // Ensure swap after new line
-}
-
-// === ANSI Processing ===
-// Map ANSI color codes to 6-bit RGB values
-// (2 bits per component: R, G, B)
-void process_ansi_code(uint8_t param) {
-    if (param == 0) {
-        // Reset: white on black
-        current_fg = 63;  // 0b111111
-        current_bg = 0;   // 0b000000
-    } else if (param >= 30 && param <= 37) {
-        // Standard ANSI foreground colors
-        static const uint8_t ansi_colors[] = {
-            0,   // 30: black   (0b000000)
-            48,  // 31: red     (0b110000)
-            12,  // 32: green   (0b001100)
-            60,  // 33: yellow  (0b111100)
-            3,   // 34: blue    (0b000011)
-            51,  // 35: magenta (0b110011)
-            15,  // 36: cyan    (0b001111)
-            63   // 37: white   (0b111111)
-        };
-        current_fg = ansi_colors[param - 30];
-    } else if (param >= 40 && param <= 47) {
-        // Standard ANSI background colors
-        static const uint8_t ansi_colors[] = {
-            0,   // 40: black
-            48,  // 41: red
-            12,  // 42: green
-            60,  // 43: yellow
-            3,   // 44: blue
-            51,  // 45: magenta
-            15,  // 46: cyan
-            63   // 47: white
-        };
-        current_bg = ansi_colors[param - 40];
-    }
-}
-
-void process_ansi_sequence(uint8_t *params, uint8_t count, char final) {
-    switch (final) {
-    case 'J':
-        if (count == 1 && params[0] == 2) {
-            clear_screen();
-        }
-        break;
-        
-    case 'K':
-        for (uint x = term.cursor_x; x < CHAR_COLS; x++) {
-            set_char(x, term.cursor_y, ' ');
-            set_colour(x, term.cursor_y, current_fg, current_bg);
-        }
-        buffer_dirty = true;
-        break;
-        
-    case 'H':
-        if (count >= 1) {
-            term.cursor_y = (params[0] > 0 ? params[0] - 1 : 0);
-        }
-        if (count >= 2) {
-            term.cursor_x = (params[1] > 0 ? params[1] - 1 : 0);
-        }
-        break;
-        
-    case 'm':
-        for (uint8_t i = 0; i < count; i++) {
-            process_ansi_code(params[i]);
-        }
-        break;
-        
-    case 's':
-        saved_cursor_x = term.cursor_x;
-        saved_cursor_y = term.cursor_y;
-        break;
-        
-    case 'u':
-        if (saved_cursor_x != -1 && saved_cursor_y != -1) {
-            term.cursor_x = saved_cursor_x;
-            term.cursor_y = saved_cursor_y;
+#if OVERLAY_RENDER
+// Draw the sprites over a line that has been encoded. With HSTX the line is
+// pixels already. Otherwise each run of groups under sprites is expanded to
+// pixels again, the sprites drawn on those, and the run encoded over the
+// TMDS of the text, which leaves the rest of the line on the cheap path.
+static void __not_in_flash_func(draw_overlay)(const line_job_t *job, const uint8_t *chars,
+                                              const uint32_t *colours, uint plane_stride,
+                                              const uint32_t *ext, const uint8_t *font_line) {
+    sprite_t sp;
+#if DVI_HSTX
+    (void)chars; (void)colours; (void)plane_stride; (void)ext; (void)font_line;
+    for (uint i = 0; i < OVERLAY_SPRITES; i++) {
+        if (overlay_sprite(&screen_front->overlay.sprite[i], 0, &sp)) {
+            sprite_sprite16((uint16_t *)job->tmdsbuf, &sp, job->y, frame_width);
         }
-        break;
+    }
+#else
+    uint32_t *pixels = overlay_pixels[get_core_num()];
+    uint32_t groups = job->overlay;
+    while (groups) {
+        uint first = __builtin_ctz(groups);
+        uint n = __builtin_ctz(~(groups >> first));
+        groups &= ~(((1u << n) - 1) << first);
         
-        case 'A': { // Cursor Up
-            uint8_t n = (count >= 1 && params[0] > 0) ? params[0] : 1;
-            if (term.cursor_y >= n)
-                term.cursor_y -= n;
-            else
-                term.cursor_y = 0;
-            break;
-        }
-        case 'B': { // Cursor Down
-            uint8_t n = (count >= 1 && params[0] > 0) ? params[0] : 1;
-            if (term.cursor_y + n < CHAR_ROWS)
-                term.cursor_y += n;
-            else
-                term.cursor_y = CHAR_ROWS - 1;
-            break;
-        }
-        case 'C': { // Cursor Forward
-            uint8_t n = (count >= 1 && params[0] > 0) ? params[0] : 1;
-            if (term.cursor_x + n < CHAR_COLS)
-                term.cursor_x += n;
-            else
-                term.cursor_x = CHAR_COLS - 1;
-            break;
+        uint x0 = first * OVERLAY_GROUP_PIXELS;
+        uint width = MIN(n * OVERLAY_GROUP_PIXELS, frame_width - x0);
+        uint c0 = x0 / FONT_CHAR_WIDTH;
+        if (job->gfx) {
+            gfx_expand_rgb565(job->gfx + x0 / 16, pixels, width);
+        } else {
+            font_expand_rgb565(chars + c0, colours + c0 / 8, plane_stride, ext ? ext + c0 / 8 : NULL,
+                               pixels, width / FONT_CHAR_WIDTH, font_line);
         }
-        case 'D': { // Cursor Back
-            uint8_t n = (count >= 1 && params[0] > 0) ? params[0] : 1;
-            if (term.cursor_x >= n)
-                term.cursor_x -= n;
-            else
-                term.cursor_x = 0;
-            break;
+        for (uint i = 0; i < OVERLAY_SPRITES; i++) {
+            if (overlay_sprite(&screen_front->overlay.sprite[i], x0, &sp)) {
+                sprite_sprite16((uint16_t *)pixels, &sp, job->y, width);
+            }
         }
+        tmds_encode_rgb565_sio(pixels, job->tmdsbuf + x0 / DVI_SYMBOLS_PER_WORD,
+                               frame_width / DVI_SYMBOLS_PER_WORD, width);
     }
+#endif
 }
+#endif
 
-// === Color Menu ===
-void draw_color_menu(const char *title, const char *prompt) {
-    uint16_t x = 2;
-    uint16_t y;
-    
-    if (term.cursor_y + 12 < CHAR_ROWS) {
-        y = term.cursor_y + 1;
-    } else {
-        y = CHAR_ROWS - 12;
+#if SCRATCH_FONT_LINE
+// 64 words, four at a time. This is around 130 cycles against the thousands
+// the line takes to encode, and the line's font reads then never wait on core0.
+static inline void __not_in_flash_func(copy_font_line)(uint32_t *dst, const uint8_t *font_line) {
+    const uint32_t *src = (const uint32_t *)font_line;
+    for (uint i = 0; i < FONT_N_CHARS / 4; i += 4) {
+        dst[i] = src[i];
+        dst[i + 1] = src[i + 1];
+        dst[i + 2] = src[i + 2];
+        dst[i + 3] = src[i + 3];
     }
-    
-    menu_left = x - 1;
-    menu_top = y - 1;
-    
-    // Save current screen region
-    for (uint8_t row = 0; row < 12; row++) {
-        for (uint8_t col = 0; col < 34; col++) {
-            uint px = menu_left + col;
-            uint py = menu_top + row;
-            
-            if (px < CHAR_COLS && py < CHAR_ROWS) {
-                saved_chars[row][col] = charbuf_back[px + py * CHAR_COLS];
-                
-                uint idx = px + py * CHAR_COLS;
-                uint bit = (idx % 8) * 4;
-                uint word = idx / 8;
-                
-                uint8_t fg = 0, bg = 0;
-                for (int p = 2; p >= 0; --p) {
-                    uint32_t val = colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS];
-                    uint8_t nibble = (val >> bit) & 0xF;
-                    fg = (fg << 2) | (nibble & 0x3);
-                    bg = (bg << 2) | ((nibble >> 2) & 0x3);
-                }
-                
-                saved_fg[row][col] = fg;
-                saved_bg[row][col] = bg;
-            }
+}
+#endif
+
+static void __not_in_flash_func(encode_line)(const line_job_t *job) {
+    if (job->gfx) {
+#if BIG_TEXT
+        uint32_t *pixels = big_pixels[get_core_num()];
+        gfx_expand_rgb565(job->gfx, pixels, frame_width / 2);
+        double_pixels(pixels, job->tmdsbuf);
+#elif DVI_HSTX
+        gfx_expand_rgb565(job->gfx, job->tmdsbuf, frame_width);
+#else
+        for (int plane = 0; plane < 3; plane++) {
+            tmds_encode_2bpp(job->gfx, job->tmdsbuf + plane * (frame_width / DVI_SYMBOLS_PER_WORD),
+                             frame_width);
         }
+#endif
+#if OVERLAY_RENDER
+        if (job->overlay) {
+            draw_overlay(job, NULL, NULL, 0, NULL, NULL);
+        }
+#endif
+        return;
     }
-    
-    // Draw menu border
-    set_char(menu_left, menu_top, '+');
-    for (uint8_t i = 0; i < 32; i++) {
-        set_char(x + i, menu_top, '-');
-    }
-    set_char(menu_left + 32, menu_top, '+');
-    
-    for (uint8_t i = 0; i < 10; i++) {
-        set_char(menu_left, y + i, '|');
-        set_char(menu_left + 32, y + i, '|');
-    }
-    
-    set_char(menu_left, menu_top + 10, '+');
-    for (uint8_t i = 0; i < 32; i++) {
-        set_char(x + i, menu_top + 10, '-');
-    }
-    set_char(menu_left + 32, menu_top + 10, '+');
-    
-    // Draw title
-    for (size_t i = 0; i < strlen(title); i++) {
-        set_char(x + i, y, title[i]);
-        set_colour(x + i, y, current_fg, current_bg);
+    if (job->mono) {
+        copy_mono_line(job);
+#if OVERLAY_RENDER
+        if (job->overlay) {
+            draw_overlay(job, job->chars, job->colours, job->plane_stride, job->ext, job->scanline);
+        }
+#endif
+        return;
     }
     
-    // Draw color grid with two-digit numbers
-    for (uint8_t row = 0; row < 8; row++) {
-        for (uint8_t col = 0; col < 8; col++) {
-            uint8_t color_idx = row * 8 + col;
-            uint16_t pos_x = x + col * 4;
-            uint16_t pos_y = y + row + 1;
-            
-            // Draw two-digit color number with leading zero
-            char num[4];
-            snprintf(num, sizeof(num), "%02d", color_idx);
-            set_char(pos_x, pos_y, num[0]);
-            set_char(pos_x+1, pos_y, num[1]);
-            set_colour(pos_x, pos_y, 63, color_idx);
-            set_colour(pos_x+1, pos_y, 63, color_idx);
-            
-            // Draw color sample
-            set_char(pos_x+2, pos_y, 0xDB); // Block character
-            set_colour(pos_x+2, pos_y, 63, color_idx);
+    const uint8_t *chars = job->chars;
+    const uint32_t *colours = job->colours;
+    const uint32_t *ext = job->ext;
+    uint plane_stride = job->plane_stride;
+    uint core = get_core_num();
+#if SCRATCH_FONT_LINE
+    scratch_lines_t *local = core ? &scratch_lines_x : &scratch_lines_y;
+    copy_font_line(local->font_line, job->scanline);
+    const uint8_t *scanline = (const uint8_t *)local->font_line;
+    const uint8_t *identity = local->identity;
+#else
+    const uint8_t *scanline = job->scanline;
+    const uint8_t *identity = identity_font_line;
+#endif
+    if (job->attrs || job->cursor) {
+        uint8_t *resolved = attr_line[core];
+        resolve_attr_line(job, scanline, resolved);
+        if (job->cursor) {
+            colours = cursor_colours[core];
+            ext = apply_cursor(job, scanline, resolved, cursor_colours[core]) ?
+                  colours + 3 * MAX_COLOUR_ROW_WORDS : NULL;
+            plane_stride = MAX_COLOUR_ROW_WORDS;
         }
+        chars = resolved;
+        scanline = identity;
     }
-    
-    // Draw input prompt
-    for (size_t i = 0; i < strlen(prompt); i++) {
-        set_char(x + i, y + 9, prompt[i]);
-        set_colour(x + i, y + 9, current_fg, current_bg);
+    if (job->size != LINE_SINGLE) {
+        widen_line(chars, colours, plane_stride, ext, scanline, wide_line[core], wide_colours[core]);
+        chars = wide_line[core];
+        colours = wide_colours[core];
+        ext = ext ? colours + 3 * MAX_COLOUR_ROW_WORDS : NULL;
+        plane_stride = MAX_COLOUR_ROW_WORDS;
+        scanline = identity;
     }
     
-    buffer_dirty = true;
-    safe_request_swap();
-}
-
-// === Menu System ===
-void restore_menu_region(void) {
-    for (uint8_t row = 0; row < MENU_BUFFER_HEIGHT; row++) {
-        for (uint8_t col = 0; col < MENU_BUFFER_WIDTH; col++) {
-            uint px = menu_left + col;
-            uint py = menu_top + row;
-            if (px < CHAR_COLS && py < CHAR_ROWS) {
-                set_char(px, py, saved_chars[row][col]);
-                set_colour(px, py, saved_fg[row][col], saved_bg[row][col]);
-            }
+#if BIG_TEXT
+    font_expand_rgb565(chars, colours, plane_stride, ext, big_pixels[core], char_cols, scanline);
+    double_pixels(big_pixels[core], job->tmdsbuf);
+#elif DVI_HSTX
+    font_expand_rgb565(chars, colours, plane_stride, ext, job->tmdsbuf, char_cols, scanline);
+#else
+#if !PICO_RP2040
+    if (use_sio_encoder || ext) {
+        tmds_encode_font_sio(chars, colours, plane_stride, ext, job->tmdsbuf,
+                             frame_width / DVI_SYMBOLS_PER_WORD, char_cols, scanline);
+    } else
+#else
+    (void)ext; // No SIO encoder, so extended colours aren't drawn
+#endif
+    {
+        for (int plane = 0; plane < 3; plane++) {
+            tmds_encode_font_2bpp(chars,
+                                  colours + plane * plane_stride,
+                                  job->tmdsbuf + plane * (frame_width / DVI_SYMBOLS_PER_WORD),
+                                  frame_width, scanline);
         }
     }
-    buffer_dirty = true;
-    safe_request_swap();
+#endif
+#if OVERLAY_RENDER
+    if (job->overlay) {
+        draw_overlay(job, chars, colours, plane_stride, ext, scanline);
+    }
+#endif
 }
 
-void draw_cursor_menu(void) {
-    uint16_t x = 2;
-    uint16_t y;
-    
-    if (term.cursor_y + MENU_BUFFER_HEIGHT + 1 < CHAR_ROWS) {
-        y = term.cursor_y + 1;
-    } else {
-        y = CHAR_ROWS - MENU_BUFFER_HEIGHT - 1;
+// Time both text encoders on a line of every glyph in mixed colours, and
+// use the faster. Runs on core0 before core1 is started, encoding into a
+// solid line slot that isn't in use yet.
+#define BENCH_LINES 64
+static void benchmark_encoders(void) {
+#if !PICO_RP2040 && !DVI_HSTX
+    static uint8_t chars[MAX_CHAR_COLS + CHARBUF_PAD];
+    static uint32_t colours[3 * MAX_COLOUR_ROW_WORDS];
+    for (uint x = 0; x < char_cols; x++) {
+        chars[x] = x;
     }
+    for (uint w = 0; w < 3 * MAX_COLOUR_ROW_WORDS; w++) {
+        colours[w] = 0x9E3779B9u * (w + 1);
+    }
+    const uint8_t *font_line = &font_scanline[(FONT_CHAR_HEIGHT / 2) * FONT_N_CHARS];
+    uint32_t *buf = solid_line[0];
+    uint lane_words = frame_width / DVI_SYMBOLS_PER_WORD;
     
-    const char *lines[] = {
-        "Cursor Style Menu:", 
-        "[1] Block        \xDB",
-        "[2] Underline    _",
-        "[3] Bar          |",          
-        "[4] Apple I      @",
-        "[5] Shaded Block \xB2",  
-        "[6] Arrow        >",
-        "Select style: "
-    };
-    
-    size_t num_lines = sizeof(lines) / sizeof(lines[0]);
-    uint8_t box_width = 32;
-    uint8_t box_height = num_lines + 2;
-    menu_left = x - 1;
-    menu_top = y - 1;
-    
-    for (uint8_t row = 0; row < MENU_BUFFER_HEIGHT; row++) {
-        for (uint8_t col = 0; col < MENU_BUFFER_WIDTH; col++) {
-            uint px = menu_left + col;
-            uint py = menu_top + row;
-            
-            if (px < CHAR_COLS && py < CHAR_ROWS) {
-                saved_chars[row][col] = charbuf_back[px + py * CHAR_COLS];
-                
-                uint idx = px + py * CHAR_COLS;
-                uint bit = (idx % 8) * 4;
-                uint word = idx / 8;
-                
-                uint8_t fg = 0, bg = 0;
-                for (int p = 2; p >= 0; --p) {
-                    uint32_t val = colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS];
-                    uint8_t nibble = (val >> bit) & 0xF;
-                    fg = (fg << 2) | (nibble & 0x3);
-                    bg = (bg << 2) | ((nibble >> 2) & 0x3);
-                }
-                
-                saved_fg[row][col] = fg;
-                saved_bg[row][col] = bg;
-            }
+    uint32_t irq_state = save_and_disable_interrupts();
+    uint32_t start = time_us_32();
+    for (uint n = 0; n < BENCH_LINES; n++) {
+        for (int plane = 0; plane < 3; plane++) {
+            tmds_encode_font_2bpp(chars, colours + plane * MAX_COLOUR_ROW_WORDS,
+                                  buf + plane * lane_words, frame_width, font_line);
         }
     }
+    bench_lut_ns = (time_us_32() - start) * 1000 / BENCH_LINES;
     
-    set_char(menu_left, menu_top, '+');
-    for (uint8_t i = 0; i < box_width; i++) {
-        set_char(x + i, menu_top, '-');
+    start = time_us_32();
+    for (uint n = 0; n < BENCH_LINES; n++) {
+        tmds_encode_font_sio(chars, colours, MAX_COLOUR_ROW_WORDS, NULL, buf, lane_words,
+                             char_cols, font_line);
     }
-    set_char(menu_left + box_width, menu_top, '+');
+    bench_sio_ns = (time_us_32() - start) * 1000 / BENCH_LINES;
+    restore_interrupts(irq_state);
     
-    for (uint8_t i = 0; i < box_height - 2; i++) {
-        set_char(menu_left, y + i, '|');
-        set_char(menu_left + box_width, y + i, '|');
+    use_sio_encoder = bench_sio_ns < bench_lut_ns;
+#endif
+}
+
+// The copy of screen_row with the menu window over it, or NULL if the window
+// doesn't cover the row. Made once per row (see fetch_row()).
+static const menu_row_t *__not_in_flash_func(menu_row)(uint screen_row,
+                                                       const uint8_t *chars, const uint32_t *colours,
+                                                       uint plane_stride, const row_info_t *info) {
+    const menu_window_t *m = &screen_front->menu;
+    if (!m->visible || screen_row < m->top || screen_row >= m->top + m->rows) {
+        return NULL;
     }
+    menu_row_t *out = &menu_rows[screen_row & 1];
     
-    set_char(menu_left, menu_top + box_height - 1, '+');
-    for (uint8_t i = 0; i < box_width; i++) {
-        set_char(x + i, menu_top + box_height - 1, '-');
+    uint wy = screen_row - m->top;
+    memcpy(out->chars, chars, char_cols);
+    for (int p = 0; p < COLOUR_N_PLANES; p++) {
+        memcpy(&out->colours[p * MAX_COLOUR_ROW_WORDS], &colours[p * plane_stride],
+               colour_row_words * sizeof(uint32_t));
     }
-    set_char(menu_left + box_width, menu_top + box_height - 1, '+');
-    
-    for (size_t i = 0; i < num_lines; i++) {
-        size_t len = strlen(lines[i]);
-        for (size_t j = 0; j < len; j++) {
-            set_char(x + j, y + i, lines[i][j]);
-            set_colour(x + j, y + i, current_fg, current_bg);
+    for (uint i = 0; i < m->cols && m->left + i < char_cols; i++) {
+        uint x = m->left + i;
+        uint bit = (x % 8) * 4;
+        uint8_t fg = m->fg[wy][i], bg = m->bg[wy][i];
+        out->chars[x] = m->chars[wy][i];
+        for (int p = 0; p < COLOUR_N_PLANES; p++) {
+            uint32_t nibble = 0; // No attributes in the window
+            if (p != ATTR_PLANE) {
+                nibble = (fg & 0x3) | ((bg & 0x3) << 2);
+                fg >>= 2;
+                bg >>= 2;
+            }
+            uint32_t *word = &out->colours[p * MAX_COLOUR_ROW_WORDS + x / 8];
+            *word = (*word & ~(0xFu << bit)) | (nibble << bit);
         }
     }
-    
-    buffer_dirty = true;
-    safe_request_swap();
+    out->info = *info;
+    out->info.bg = ROW_BG_MIXED;
+    out->info.fg = ROW_BG_MIXED;
+    out->info.ext = info->ext || m->ext;
+    out->info.gfx = 0;
+    out->info.size = LINE_SINGLE; // The window is drawn at its own size
+    return out;
 }
 
-// === Character Handling ===
-void handle_char(char c) {
-    input_active = true;
-    last_input_time = get_absolute_time();
-
-    // Remove cursor if it's drawn
-    if (cursor_drawn) {
-        set_char(cursor_draw_x, cursor_draw_y, saved_cursor_char);
-        set_colour(cursor_draw_x, cursor_draw_y, saved_cursor_fg, current_bg);
-        cursor_drawn = false;
-        buffer_dirty = true;
-    }
-
-    // 1. First handle BASIC echo suppression
-    if (term.suppress_next_cr && c == '\r') {
-        term.suppress_next_cr = false;
-        #ifdef DEBUG
-        printf("Suppressed BASIC echo CR\n");
-        #endif
-        return;
+// The copy of a row's colour planes in the display's colours (see
+// palette_info_t), with its row_info to match. Made once per row (see
+// fetch_row()), 8 cells a word at a time.
+static const palette_row_t *__not_in_flash_func(palette_row)(uint screen_row, const uint32_t *colours,
+                                                             uint plane_stride, const row_info_t *info,
+                                                             const palette_info_t *pal) {
+    palette_row_t *out = &palette_rows[screen_row & 1];
+    const uint32_t *ext = info->ext ? colours + EXT_PLANE * plane_stride : NULL;
+    for (uint x = 0; x < colour_row_words; x++) {
+        uint32_t w[4] = {colours[x], colours[plane_stride + x], colours[2 * plane_stride + x],
+                         ext ? ext[x] : 0};
+        palette_map_word(pal, w);
+        out->colours[x] = w[0];
+        out->colours[MAX_COLOUR_ROW_WORDS + x] = w[1];
+        out->colours[2 * MAX_COLOUR_ROW_WORDS + x] = w[2];
+        out->colours[ATTR_PLANE * MAX_COLOUR_ROW_WORDS + x] = colours[ATTR_PLANE * plane_stride + x];
+        out->colours[EXT_PLANE * MAX_COLOUR_ROW_WORDS + x] = w[3];
     }
-    term.suppress_next_cr = false;  // Reset if not matched
     
+    // A row with extended colours may have cells the palette leaves alone in
+    // what looks like white or black, so it is taken as mixed
+    out->info = *info;
+    uint8_t fg = info->fg, bg = info->bg;
+    fg = info->ext || fg == ROW_BG_MIXED ? ROW_BG_MIXED : palette_colour(pal, fg);
+    bg = info->ext || bg == ROW_BG_MIXED ? ROW_BG_MIXED : palette_colour(pal, bg);
+    out->info.fg = pal->reverse ? bg : fg;
+    out->info.bg = pal->reverse ? fg : bg;
+    return out;
+}
 
-    if (term.skip_next_lf && c == '\n') {
-        term.skip_next_lf = false;
-        return;
-    }
-    if (term.skip_next_cr && c == '\r') {
-        term.skip_next_cr = false;
-        return;
-    }
-
-    // Reset skip flags if we get any non-matching character
-    if (term.skip_next_lf && c != '\n') {
-        term.skip_next_lf = false;  // Reset if next char isn't LF
+// What prepare_line() works out for a text row, kept for the rest of its
+// scanlines: where its cells are (the screen, the history or the menu's
+// copy) and whether the cursor is on it. Only a flip can change any of that,
+// and core1 flips at the top of a row, after which fetch_row() runs again.
+typedef struct {
+    uint screen_row; // ~0u when nothing is kept
+    const uint8_t *chars;
+    const uint32_t *colours;
+    const row_info_t *info;
+    uint plane_stride;
+    const cursor_info_t *cursor;
+} row_cache_t;
+
+static row_cache_t row_cache = {.screen_row = ~0u};
+
+static void __not_in_flash_func(fetch_row)(uint screen_row) {
+    row_cache_t *r = &row_cache;
+    r->screen_row = screen_row;
+    
+    // With the view scrolled back the top rows come from the history and the
+    // screen is pushed down by as many rows
+    uint view = frame_history_view & 0xFFFF;
+    const screen_t *screen = screen_front; // Only perform_swap() on this core changes it
+    if (screen_row < view) {
+        uint line = ((frame_history_view >> 16) + history_capacity - (view - screen_row)) % history_capacity;
+        r->chars = &history_chars[line * char_cols];
+        r->colours = colour_pool[history[line].colours];
+        r->info = &history[line].info;
+        r->plane_stride = MAX_COLOUR_ROW_WORDS;
+    } else {
+        uint row = screen_row < char_rows ? screen->row_map[screen_row - view] : BORDER_ROW;
+        r->chars = (const uint8_t *)&screen->charbuf[row * char_cols];
+        r->colours = &screen->colourbuf[row * colour_row_words];
+        r->info = &screen->row_info[row];
+        r->plane_stride = colour_plane_words;
     }
-    if (term.skip_next_cr && c != '\r') {
-        term.skip_next_cr = false;  // Reset if next char isn't CR
+    const menu_row_t *menu = menu_row(screen_row, r->chars, r->colours, r->plane_stride, r->info);
+    if (menu) {
+        r->chars = menu->chars;
+        r->colours = menu->colours;
+        r->info = &menu->info;
+        r->plane_stride = MAX_COLOUR_ROW_WORDS;
     }
-    
-    if (term.escape_mode) {
-        if (c == '[') {
-            term.ansi_mode = true;
-            reset_ansi_state();
-            return;
-        }
-        
-        if (term.ansi_mode) {
-            if (c >= '0' && c <= '9') {
-                if (ansi_buf_len < sizeof(ansi_buffer) - 1) {
-                    ansi_buffer[ansi_buf_len++] = c;
-                }
-                return;
-            } else if (c == ';') {
-                ansi_buffer[ansi_buf_len] = '\0';
-                if (ansi_param_count < ANSI_PARAM_MAX) {
-                    ansi_params[ansi_param_count++] = atoi(ansi_buffer);
-                }
-                ansi_buf_len = 0;
-                return;
-            } else {
-                ansi_buffer[ansi_buf_len] = '\0';
-                if (ansi_buf_len > 0 && ansi_param_count < ANSI_PARAM_MAX) {
-                    ansi_params[ansi_param_count++] = atoi(ansi_buffer);
-                }
-                process_ansi_sequence(ansi_params, ansi_param_count, c);
-                term.escape_mode = false;
-                term.ansi_mode = false;
-                return;
-            }
-        }
-        
-        term.escape_mode = false;
-        return;
+    if (!palette_is_identity(&screen->palette) && !r->info->gfx) {
+        const palette_row_t *p = palette_row(screen_row, r->colours, r->plane_stride, r->info,
+                                             &screen->palette);
+        r->colours = p->colours;
+        r->info = &p->info;
+        r->plane_stride = MAX_COLOUR_ROW_WORDS;
     }
     
-    if (fg_color_menu_mode) {
-        if (c >= '0' && c <= '9' && color_menu_buf_len < 2) {
-            color_menu_buf[color_menu_buf_len++] = c;
-            if (color_menu_buf_len == 2) {
-                // Convert to number and set foreground color
-                uint8_t color_num = (color_menu_buf[0] - '0') * 10 + (color_menu_buf[1] - '0');
-                if (color_num < 64) {
-                    current_fg = color_num;
-                }
-                restore_menu_region();
-                fg_color_menu_mode = false;
-                color_menu_buf_len = 0;
-            }
-        } else if (c == '\b' && color_menu_buf_len > 0) {
-            // Handle backspace
-            color_menu_buf_len--;
-        } else if (c == '\x1B') {
-            // ESC pressed - cancel menu
-            restore_menu_region();
-            fg_color_menu_mode = false;
-            color_menu_buf_len = 0;
-        }
-        return;
+    r->cursor = &screen->cursor;
+    if (!r->cursor->visible || blink_off || view || r->cursor->y != screen_row || r->info->gfx) {
+        r->cursor = NULL;
     }
-    if (bg_color_menu_mode) {
-        if (c >= '0' && c <= '9' && color_menu_buf_len < 2) {
-            color_menu_buf[color_menu_buf_len++] = c;
-            if (color_menu_buf_len == 2) {
-                // Convert to number and set background color
-                uint8_t color_num = (color_menu_buf[0] - '0') * 10 + (color_menu_buf[1] - '0');
-                if (color_num < 64) {
-                    current_bg = color_num;
-                }
-                restore_menu_region();
-                bg_color_menu_mode = false;
-                color_menu_buf_len = 0;
-            }
-        } else if (c == '\b' && color_menu_buf_len > 0) {
-            // Handle backspace
-            color_menu_buf_len--;
-        } else if (c == '\x1B') {
-            // ESC pressed - cancel menu
-            restore_menu_region();
-            bg_color_menu_mode = false;
-            color_menu_buf_len = 0;
-        }
-        return;
+}
+
+// Choose the TMDS buffer for scanline y. Returns false if it is a cached solid
+// line that is ready to queue, otherwise fills in the job to encode it. Lines
+// are queued only once all the lines prepared with them have been encoded, so
+// a slot claimed here can be shared straight away.
+static bool __not_in_flash_func(prepare_line)(uint y, uint32_t **tmdsbuf, line_job_t *job) {
+    uint screen_row = y / FONT_CHAR_HEIGHT;
+    uint font_y = y % FONT_CHAR_HEIGHT;
+    if (screen_row != row_cache.screen_row) {
+        fetch_row(screen_row);
     }
-    
-    if (cursor_menu_mode) {
-        switch (c) {
-        case '1': current_cursor = CURSOR__SOLID_BLOCK; break;
-        case '2': current_cursor = CURSOR_UNDERLINE; break;
-        case '3': current_cursor = CURSOR_BAR; break;
-        case '4': current_cursor = CURSOR_APPLE_I; break;
-        case '5': current_cursor = CURSOR_SHADED_BLOCK; break;
-        case '6': current_cursor = CURSOR__SOLID_ARROW; break; // Default to solid block
-        default: return;
-        }
-        cursor_menu_mode = false;
-        restore_menu_region();
-        term.cursor_visible = true;
-        cursor_blink_counter = 0; // Reset blink counter
-        return;
+    const uint8_t *chars = row_cache.chars;
+    const uint32_t *colours = row_cache.colours;
+    const row_info_t *info = row_cache.info;
+    uint plane_stride = row_cache.plane_stride;
+    const cursor_info_t *cursor = row_cache.cursor;
+    const uint32_t *gfx = NULL;
+    if (info->gfx) {
+        gfx = &gfx_pool[(info->gfx - 1) * gfx_strip_words + font_y * (gfx_strip_words / FONT_CHAR_HEIGHT)];
     }
     
-    if (theme_select_mode) {
-        switch (c) {
-        case '0': current_fg = 12; current_bg = 0;  break;  // Green on Black (VT100/Apple IIe)
-        case '1': current_fg = 60; current_bg = 0;  break;  // Amber on Black (Wyse/VT220)
-        case '2': current_fg = 63; current_bg = 3;  break;  // White on Blue (DOS/PC BIOS)
-        case '3': current_fg = 0;  current_bg = 63; break;  // Black on White (Mac Classic/Light mode)
-        case '4': current_fg = 11; current_bg = 3;  break;  // Light Blue on Blue (Commodore 64)
-        case '5': current_fg = 60; current_bg = 3;  break;  // Yellow on Blue (Turbo Pascal / DOS IDEs)
-        case '6': current_fg = 51; current_bg = 0;  break;  // Magenta on Black (ZX Spectrum/CPM)
-        case '7': current_fg = 42; current_bg = 0;  break;  // Light Gray on Black (DOS/Windows text mode)
-        case '8': current_fg = 15; current_bg = 0;  break;  // Cyan on Black (Retro secondary text)
-        case '9': current_fg = 48; current_bg = 21; break;  // Red on Dark Gray (Mainframe/Alert)
-        default: return;
-        }
-        theme_select_mode = false;
-        return;
+    // A double height row shows half the font, each line twice
+    if (info->size == LINE_DOUBLE_TOP) {
+        font_y /= 2;
+    } else if (info->size == LINE_DOUBLE_BOTTOM) {
+        font_y = FONT_CHAR_HEIGHT / 2 + font_y / 2;
     }
     
-    switch (c) {
-    case '\x06': // Ctrl+F
-        fg_color_menu_mode = true;
-        color_menu_buf_len = 0;
-        memset(color_menu_buf, 0, sizeof(color_menu_buf));
-        draw_color_menu("Foreground Color Menu", "Enter color code (00-63):");
-        break;
-    case '\x02': // Ctrl+B
-        bg_color_menu_mode = true;
-        color_menu_buf_len = 0;
-        memset(color_menu_buf, 0, sizeof(color_menu_buf));
-        draw_color_menu("Background Color Menu", "Enter color code (00-63):");
-        break;
-    case '\x14': theme_select_mode = true; break;
-    case '\x0E': cursor_menu_mode = true; draw_cursor_menu(); break;
-    //case '\x07': current_fg = 12; current_bg = 0; break;
-    //case '\x17': current_fg = 63; current_bg = 0; break;
-    //case '\x03': current_fg = 15; break;
-    //case '\x04': current_fg = 4; break;
-    //case '\x0F': current_fg = 48; break;
-    //case '\x12': current_fg = 48; break;
-    //case '\x13': current_fg = 51; break;
-    //case '\x19': current_fg = 60; break;
-    //case '\x0C': current_fg = 21; break;
-    case '\x1B': term.escape_mode = true; break;
-    case '\r':
-        new_line();
-        term.skip_next_lf = true;
-        term.suppress_next_cr = true;
-        break;
+#if OVERLAY_RENDER
+    uint32_t overlay = overlay_groups(y);
+#else
+    uint32_t overlay = 0;
+#endif
     
-    case '\n':
-        new_line();
-        term.skip_next_cr = true;
-        break;
+    int slot = -1;
+    if (!cursor && !overlay && !gfx && info->bg != ROW_BG_MIXED && (info->blank_lines >> font_y) & 1) {
+        slot = solid_line_slot(info->bg);
+    }
     
-    case '\b':
-        if (term.cursor_x > 0) {
-            term.cursor_x--;
-            set_char(term.cursor_x, term.cursor_y, ' ');
-            set_colour(term.cursor_x, term.cursor_y, current_fg, current_bg);
-            buffer_dirty = true;
+    if (slot >= 0) {
+        solid_line_refs[slot]++;
+        *tmdsbuf = solid_line[slot];
+        if (solid_line_bg[slot] == info->bg) {
+            return false;
         }
-        break;
-        
-    default:
-        // Handle normal character input
-        set_char(term.cursor_x, term.cursor_y, c);
-        set_colour(term.cursor_x, term.cursor_y, current_fg, current_bg);
-        term.cursor_x++;
-        buffer_dirty = true;
-        if (term.cursor_x >= CHAR_COLS) {
-            new_line();
-        }
-        break;
+        solid_line_bg[slot] = info->bg;
+    } else {
+        *tmdsbuf = take_tmds_buffer();
     }
     
-    // Force cursor redraw after character processing
-    if (term.cursor_visible && !cursor_menu_mode) {
-        // Always clear the old cursor position if drawn
-        if (cursor_drawn) {
-            set_char(cursor_draw_x, cursor_draw_y, saved_cursor_char);
-            set_colour(cursor_draw_x, cursor_draw_y, saved_cursor_fg, current_bg);
-            #ifdef DEBUG
-            uint idx = cursor_draw_x + cursor_draw_y * CHAR_COLS;
-            uint bit = (idx % 8) * 4;
-            uint word = idx / 8;
-            uint8_t check_bg = 0;
-            for (int p = 2; p >= 0; --p) {
-                uint32_t val = colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS];
-                uint8_t nibble = (val >> bit) & 0xF;
-                check_bg = (check_bg << 2) | ((nibble >> 2) & 0x3);
-            }
-            printf("Cleared old pos: x=%d, y=%d, intended_bg=0x%02X, actual_bg=0x%02X\n",
-                   cursor_draw_x, cursor_draw_y, current_bg, check_bg);
-            #endif
-        }
+    job->chars = chars;
+    job->colours = colours;
+    job->plane_stride = plane_stride;
+    job->scanline = &font_scanline[font_y * FONT_N_CHARS];
+    job->tmdsbuf = *tmdsbuf;
+    job->attrs = info->attrs ? colours + ATTR_PLANE * plane_stride : NULL;
+    job->ext = info->ext ? colours + EXT_PLANE * plane_stride : NULL;
+    job->cursor = cursor;
+    job->mono = !DVI_HSTX && frame_mono_ready && !cursor && !gfx && info->size == LINE_SINGLE &&
+                info->fg == mono_cache.fg && info->bg == mono_cache.bg;
+    job->font_y = font_y;
+    job->blink_off = blink_off;
+    job->y = y;
+    job->overlay = overlay;
+    job->gfx = gfx;
+    job->size = info->size;
+    return true;
+}
 
-        cursor_draw_x = term.cursor_x;
-        cursor_draw_y = term.cursor_y;
-        saved_cursor_char = charbuf_back[cursor_draw_x + cursor_draw_y * CHAR_COLS];
+static void __not_in_flash_func(queue_line)(uint32_t *tmdsbuf) {
+    queue_add_blocking(&dvi0.q_tmds_valid, &tmdsbuf);
+    tmds_in_flight++;
+}
 
-        // Clear the new area with current background
-        set_char(cursor_draw_x, cursor_draw_y, ' ');
-        set_colour(cursor_draw_x, cursor_draw_y, 0, current_bg);
-        
-        uint8_t cursor_char = ' ';
-        uint8_t cursor_fg = current_fg;
-        uint8_t cursor_bg = current_bg;
-        switch (current_cursor) {
-            case CURSOR__SOLID_BLOCK: cursor_char = (uint8_t)0xDB; break;
-            case CURSOR_APPLE_I: cursor_char = '@'; break;
-            case CURSOR_UNDERLINE: cursor_char = '_'; break;
-            case CURSOR_BAR: cursor_char = '|'; break;
-            case CURSOR_SHADED_BLOCK: cursor_char = (uint8_t)0xB2; break;
-            case CURSOR__SOLID_ARROW: cursor_char = '>'; break; // Solid arrow
-        }
-        set_char(cursor_draw_x, cursor_draw_y, cursor_char);
-        set_colour(cursor_draw_x, cursor_draw_y, cursor_fg, cursor_bg);
-        cursor_drawn = true;
-        buffer_dirty = true;
-    }
+#if DMA_GATHER_RENDER
+static void gather_init(void) {
+    gather_ctrl_chan = dma_claim_unused_channel(true);
+    gather_data_chan = dma_claim_unused_channel(true);
     
-    safe_request_swap();
-  
-    #ifdef DEBUG
-    printf("Char processed: %c (0x%02X), cursor_x=%d, cursor_y=%d\n", 
-           (c >= 32 && c < 127) ? c : '.', c, term.cursor_x, term.cursor_y);
-    #endif
+    dma_channel_config c = dma_channel_get_default_config(gather_ctrl_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(gather_ctrl_chan, &c,
+                          &dma_hw->ch[gather_data_chan].al3_read_addr_trig, NULL, 1, false);
+    
+    c = dma_channel_get_default_config(gather_data_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_chain_to(&c, gather_ctrl_chan);
+    dma_channel_configure(gather_data_chan, &c, NULL, NULL, TMDS_WORDS_PER_CHAR, false);
 }
 
-// === Input Handling ===
-void on_uart_rx() {
-    while (uart_is_readable(UART_ID)) {
-        uint8_t ch = uart_getc(UART_ID);
-        uint16_t next_head = (uart_head + 1) % UART_BUFFER_SIZE;
-        if (next_head == uart_tail) {
-            uart_overflow = true;
-            #ifdef DEBUG
-            printf("UART buffer overflow, head=%d, tail=%d\n", uart_head, uart_tail);
-            #endif
-            continue;
+// Wait for the line being gathered, if any, and queue it. The control
+// channel has read the null at the end only once the last copy is done.
+static void __not_in_flash_func(finish_gather)(void) {
+    if (!gather_tmdsbuf) return;
+    while (dma_hw->ch[gather_ctrl_chan].read_addr != (uintptr_t)gather_list_end ||
+           dma_channel_is_busy(gather_ctrl_chan)) {
+        tight_loop_contents();
+    }
+    queue_line(gather_tmdsbuf);
+    gather_tmdsbuf = NULL;
+}
+
+// Start gathering a line of mono_cache glyphs. The line before it (which the
+// channels may still be busy with) is queued first, keeping lines in order.
+static void __not_in_flash_func(start_gather)(const line_job_t *job) {
+    const uint32_t **list = gather_list[gather_list_next];
+    gather_list_next ^= 1;
+    const uint32_t **l = list;
+    const uint32_t *glyphs = mono_cache.glyphs[job->font_y];
+    for (int plane = 0; plane < 3; plane++) {
+        if (mono_cache.glyph_lanes & (1u << plane)) {
+            for (uint x = 0; x < char_cols; x++) {
+                *l++ = &glyphs[job->chars[x] * TMDS_WORDS_PER_CHAR];
+            }
+        } else {
+            for (uint x = 0; x < char_cols; x++) {
+                *l++ = mono_cache.solid[plane];
+            }
         }
-        uart_buffer[uart_head] = ch;
-        uart_head = next_head;
-        gpio_put(LED_PIN, 1);
-        led_off_time = make_timeout_time_ms(30);
     }
+    *l++ = NULL;
+    
+    finish_gather();
+    gather_list_end = l;
+    gather_tmdsbuf = job->tmdsbuf;
+    dma_channel_set_write_addr(gather_data_chan, job->tmdsbuf, false);
+    dma_channel_set_read_addr(gather_ctrl_chan, list, true);
 }
+#endif
 
-void inject_debug_to_uart(const char *msg) {
-    for (int i = 0; msg[i]; i++) {
-        uart_buffer[uart_head] = msg[i];
-        uart_head = (uart_head + 1) % UART_BUFFER_SIZE;
+#if DUAL_CORE_RENDER
+// Core0's half of the encode. Core1 passes a line_job_t through the FIFO and
+// waits for the reply before queuing the line, which keeps scanlines in order.
+static void __not_in_flash_func(core0_encode_irq)(void) {
+    while (multicore_fifo_rvalid()) {
+        const line_job_t *job = (const line_job_t *)(uintptr_t)multicore_fifo_pop_blocking();
+        encode_line(job);
+        __dmb();
+        multicore_fifo_push_blocking(0);
     }
+    multicore_fifo_clear_irq();
 }
+#endif
 
-void process_uart_buffer(void) {
-    while (uart_tail != uart_head) {
-        char c = uart_buffer[uart_tail];
-        uart_tail = (uart_tail + 1) % UART_BUFFER_SIZE;
-        handle_char(c);
-        
-        if (uart_overflow && 
-            ((uart_head - uart_tail + UART_BUFFER_SIZE) % UART_BUFFER_SIZE) > UART_BUFFER_SIZE / 4) {
-            uart_overflow = false;
-            #ifdef DEBUG
-            printf("UART overflow cleared, buffer space: %d\n", 
-                   (uart_head - uart_tail + UART_BUFFER_SIZE) % UART_BUFFER_SIZE);
-            #endif
-        }
+#if LATENCY_TEST
+// Whether scanline y is the first of a screen row the last flip changed
+static bool __not_in_flash_func(line_shows_swap)(uint y) {
+    uint screen_row = y / FONT_CHAR_HEIGHT;
+    uint view = frame_history_view & 0xFFFF;
+    if (y % FONT_CHAR_HEIGHT || screen_row < view || screen_row - view >= char_rows) {
+        return false;
     }
+    uint row = screen_front->row_map[screen_row - view];
+    return (swap_rows[row / 32] >> (row % 32)) & 1;
 }
+#endif
 
-// === Rendering Core ===
-void core1_main(void) {
+void __not_in_flash_func(core1_main)(void) {
     dvi_register_irqs_this_core(&dvi0, DMA_IRQ_0);
+#if DUAL_HEAD
+    dvi_register_irqs_this_core(&dvi1, DMA_IRQ_1);
+#endif
+    start_cycle_counter();
     dvi_start(&dvi0);
+#if DUAL_HEAD
+    dvi_start(&dvi1); // Straight after, so it runs just behind
+#endif
+    
+    // Scanlines are done in pairs when core0 is helping (line y here, line y+1
+    // on core0), otherwise one at a time
+    const uint lines_per_step = DUAL_CORE_RENDER ? 2 : 1;
+    uint32_t frame_worst_us = 0;
+    uint32_t cycles_min = ~0u, cycles_max = 0, cycles_sum = 0, n_encoded = 0;
+    uint blink_frames = 0;
+#if LATENCY_TEST
+    bool latency_watch = false; // Flipped since the edge, looking for the first changed row
+#endif
     
     while (1) {
         watchdog_update();
+        encode_us_worst = frame_worst_us;
+        frame_worst_us = 0;
+        if (n_encoded) {
+            stats.encode_cycles_min = cycles_min;
+            stats.encode_cycles_avg = cycles_sum / n_encoded;
+            stats.encode_cycles_max = cycles_max;
+        }
+        cycles_min = ~0u;
+        cycles_max = cycles_sum = n_encoded = 0;
+        frame_history_view = history_view;
+        frame_count++;
+        if (++blink_frames >= BLINK_HALF_PERIOD_FRAMES) {
+            blink_frames = 0;
+            blink_off = !blink_off;
+        }
         
-        for (uint y = 0; y < FRAME_HEIGHT; y++) {
-            uint32_t *tmdsbuf;
-            queue_remove_blocking(&dvi0.q_tmds_free, &tmdsbuf);
+        for (uint y = 0; y < frame_height; y += lines_per_step) {
+            // Keep no more lines queued than there are buffers, as before
+            uint lines_held = lines_per_step;
+#if DMA_GATHER_RENDER
+            lines_held += gather_tmdsbuf != NULL;
+#endif
+            while (tmds_in_flight + lines_held > DVI_N_TMDS_BUFFERS) {
+                reclaim_tmds_buffer();
+            }
             
-            // Perform swap only at VSYNC (y == 0) and if pending
-            if (y == 0 && swap_pending) {
-                perform_swap();
+            // Flip at VSYNC (y == 0) if pending, or with SWAP_BELOW_BEAM at
+            // any row. A font change from a flip mid-frame leaves the glyph
+            // cache out of date for the rest of the frame, so it isn't used.
+            // Only at VSYNC is there time to wait for core0 to finish a
+            // write; mid-frame the flip is tried again at the next row.
+            if (swap_pending() && (y == 0 || (SWAP_BELOW_BEAM && y % FONT_CHAR_HEIGHT == 0))) {
+                const uint8_t *font = font_scanline;
+                bool flipped = y == 0 ? perform_swap_within(FLIP_WAIT_US) : perform_swap();
+                if (font_scanline != font) {
+                    frame_mono_ready = false;
+                }
+                if (flipped) {
+                    row_cache.screen_row = ~0u;
+                }
+#if LATENCY_TEST
+                if (flipped && latency_rx) {
+                    latency_rx = false;
+                    latency_watch = true;
+                }
+#else
+                (void)flipped;
+#endif
                 #ifdef DEBUG
-                printf("Swap performed at VSYNC, y=%d\n", y);
+                printf("Swap performed at y=%d\n", y);
                 #endif
             }
+            if (y == 0) {
+                frame_mono_ready = mono_cache_ready; // After the flip, which may change font
+                row_cache.screen_row = ~0u; // The view and the blink may have changed too
+            }
             
-            uint row = y / FONT_CHAR_HEIGHT;
-            if (row >= CHAR_ROWS) row = CHAR_ROWS - 1;
-            
-            uint font_y = y % FONT_CHAR_HEIGHT;
-            const uint8_t *scanline = &font_scanline[font_y * FONT_N_CHARS];
-            
-            for (int plane = 0; plane < 3; plane++) {
-                tmds_encode_font_2bpp((const uint8_t *)&charbuf_front[row * CHAR_COLS],
-                                      &colourbuf_front[row * (COLOUR_PLANE_SIZE_WORDS / CHAR_ROWS) +
-                                                       plane * COLOUR_PLANE_SIZE_WORDS],
-                                      tmdsbuf + plane * (FRAME_WIDTH / DVI_SYMBOLS_PER_WORD),
-                                      FRAME_WIDTH, scanline);
+            uint32_t step_start = time_us_32();
+            uint32_t *tmdsbuf;
+            line_job_t job;
+#if DUAL_CORE_RENDER
+            uint32_t *tmdsbuf_odd;
+            line_job_t job_odd;
+            bool encode_odd = prepare_line(y + 1, &tmdsbuf_odd, &job_odd);
+            if (encode_odd) {
+                __dmb();
+                multicore_fifo_push_blocking((uintptr_t)&job_odd);
+            }
+#endif
+            bool gathering = false;
+            if (prepare_line(y, &tmdsbuf, &job)) {
+#if DMA_GATHER_RENDER
+                if (job.mono && !job.overlay) {
+                    start_gather(&job);
+                    gathering = true;
+                } else
+#endif
+                {
+                    uint32_t start = read_cycles();
+                    encode_line(&job);
+                    uint32_t cycles = (read_cycles() - start) & CYCLE_COUNT_MASK;
+                    cycles_min = MIN(cycles_min, cycles);
+                    cycles_max = MAX(cycles_max, cycles);
+                    cycles_sum += cycles;
+                    n_encoded++;
+                }
+            }
+#if DUAL_CORE_RENDER
+            if (encode_odd) {
+                multicore_fifo_pop_blocking();
+                __dmb();
+            }
+#endif
+            uint32_t step_us = time_us_32() - step_start;
+            if (step_us > frame_worst_us) {
+                frame_worst_us = step_us;
             }
             
-            queue_add_blocking(&dvi0.q_tmds_valid, &tmdsbuf);
+            if (!gathering) {
+#if DMA_GATHER_RENDER
+                finish_gather();
+#endif
+                queue_line(tmdsbuf);
+            }
+#if DUAL_CORE_RENDER
+            queue_line(tmdsbuf_odd);
+#endif
+#if LATENCY_TEST
+            if (latency_watch && line_shows_swap(y)) {
+                gpio_put(LATENCY_TEST_PIN, 0);
+                latency_watch = false;
+            }
+#endif
         }
     }
 }
@@ -1054,144 +2695,170 @@ void watchdog_reinit(void) {
 
 // === Main Application ===
 int main(void) {
-    vreg_set_voltage(VREG_VSEL);
-    sleep_ms(10);
-    set_sys_clock_khz(DVI_TIMING.bit_clk_khz, true);
+    // The first screen is built at the boot clock while the regulator
+    // settles, and the display starts as soon as the clock is up. The
+    // inputs and USB come up after, with core1 already sending frames.
+    select_display_mode();
+    vreg_set_voltage(display_modes[display_mode].vsel);
+    absolute_time_t vreg_settled = make_timeout_time_ms(VREG_SETTLE_MS);
+
+    terminal_init();
+#if SESSIONS > 1 && CONSOLES > 1
+    terminal_set_consoles(SESSIONS);
+#elif SESSIONS > 1
+    terminal_set_sessions(SESSIONS);
+#endif
+    for (uint ch = 0; ch < FONT_N_CHARS; ++ch) {
+        identity_font_line[ch] = ch;
+    }
+#if SCRATCH_FONT_LINE
+    memcpy(scratch_lines_x.identity, identity_font_line, FONT_N_CHARS);
+    memcpy(scratch_lines_y.identity, identity_font_line, FONT_N_CHARS);
+#endif
+    init_palette();
+#if OVERLAY_RENDER
+    init_overlay_images();
+#endif
+
+    busy_wait_until(vreg_settled);
+    set_sys_clock_khz(display_modes[display_mode].timing->bit_clk_khz, true);
+    dvi0.timing = display_modes[display_mode].timing;
+    dvi0.ser_cfg = DVI_DEFAULT_SERIAL_CONFIG;
+    dvi_init(&dvi0, next_striped_spin_lock_num(), next_striped_spin_lock_num());
+#if DUAL_HEAD
+    dvi1.ser_cfg = DVI_MIRROR_SERIAL_CONFIG;
+    dvi_init_mirror(&dvi1, &dvi0);
+#endif
+#if DMA_GATHER_RENDER
+    gather_init();
+#endif
+    benchmark_encoders(); // At the clock it will run at
+
+    // Set bus priority for core1
+    bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_PROC1_BITS;
+    multicore_launch_core1(core1_main);
+#if DUAL_CORE_RENDER
+    // Core1 may already be waiting on a job; it stays in the FIFO until this
+    // is enabled. Highest priority, as core1 is stalled for as long as it runs.
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_FIFO_IRQ_NUM(0), core0_encode_irq);
+    irq_set_priority(SIO_FIFO_IRQ_NUM(0), PICO_HIGHEST_IRQ_PRIORITY);
+    irq_set_enabled(SIO_FIFO_IRQ_NUM(0), true);
+#endif
 
     //stdio_init_all();
+#if LIB_PICO_STDIO_USB
     stdio_usb_init();
+#elif USB_KEYBOARD
+    tuh_init(BOARD_TUH_RHPORT);
+#endif
     gpio_init(LED_PIN);
     gpio_set_dir(LED_PIN, GPIO_OUT);
     gpio_put(LED_PIN, 1);
 
     // UART initialization
     uart_init(UART_ID, BAUD_RATE);
+    gpio_set_function(UART_TX_PIN, GPIO_FUNC_UART);
     gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART);
+#if UART_RTS_CTS
+    // RTS is driven by update_flow_control(); CTS holds back what we send,
+    // and reads as clear to send with nothing connected
+    gpio_init(UART_RTS_PIN);
+    gpio_set_dir(UART_RTS_PIN, GPIO_OUT);
+    gpio_put(UART_RTS_PIN, 0);
+    gpio_set_function(UART_CTS_PIN, GPIO_FUNC_UART);
+    gpio_pull_down(UART_CTS_PIN);
+    uart_set_hw_flow(UART_ID, true, false);
+#else
     uart_set_hw_flow(UART_ID, false, false);
+#endif
     uart_set_format(UART_ID, 8, 1, UART_PARITY_NONE);
-    uart_set_fifo_enabled(UART_ID, false);
-    int UART_IRQ = UART_ID == uart0 ? UART0_IRQ : UART1_IRQ;
-    irq_set_exclusive_handler(UART_IRQ, on_uart_rx);
-    irq_set_enabled(UART_IRQ, true);
-    uart_set_irq_enables(UART_ID, true, false);
-
-    dvi0.timing = &DVI_TIMING;
-    dvi0.ser_cfg = DVI_DEFAULT_SERIAL_CONFIG;
-    dvi_init(&dvi0, next_striped_spin_lock_num(), next_striped_spin_lock_num());
-
-    for (uint16_t ch = 0; ch < FONT_N_CHARS; ++ch) {
-        for (uint8_t row = 0; row < FONT_CHAR_HEIGHT; ++row) {
-            uint8_t byte = font_8x16[ch][row];
-            font_scanline[row * FONT_N_CHARS + ch] = reverse_byte(byte);
-        }
-    }
-
-    memset(&term, 0, sizeof(term));
-    term.suppress_next_cr = false;
-    term.cursor_visible = true;
-    term.cursor_x = 0;
-    term.cursor_y = 0;
-    cursor_draw_x = 0;
-    cursor_draw_y = 0;
-    saved_cursor_x = 0;
-    saved_cursor_y = 0;
-    
-    clear_screen();
-    perform_swap();
+    uart_set_fifo_enabled(UART_ID, true);
+    uart_rx_dma_chan = dma_claim_unused_channel(true);
+    uart_rx_dma_start();
+    uart_tx_init(0, UART_ID);
+    add_repeating_timer_us(-INPUT_POLL_US, input_poll_callback, NULL, &input_poll_timer);
+    gpio_set_irq_callback(rx_edge_irq);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+#if LATENCY_TEST
+    gpio_init(LATENCY_TEST_PIN);
+    gpio_set_dir(LATENCY_TEST_PIN, GPIO_OUT);
+    gpio_put(LATENCY_TEST_PIN, 0);
+#endif
 
-    // Set bus priority for core1
-    bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_PROC1_BITS;
-    multicore_launch_core1(core1_main);
+    capture_init();
+#if SESSIONS > 1
+    session_inputs_init();
+#endif
     
     watchdog_reinit();
-    cursor_blink_counter = 0;
 
     absolute_time_t last_loop_time = get_absolute_time();
     while (1) {
         absolute_time_t now = get_absolute_time();
         watchdog_update();
         
-        // Cursor blinking (counter-based)
-        if (term.cursor_visible && !cursor_menu_mode) {
-            cursor_blink_counter++;
-            if (cursor_blink_counter >= (CURSOR_BLINK_MS / MAIN_LOOP_MIN_MS)) {
-                cursor_blink_counter = 0;
-                if (cursor_drawn) {
-                    // Remove cursor by restoring original character and colors
-                    set_char(cursor_draw_x, cursor_draw_y, saved_cursor_char);
-                    set_colour(cursor_draw_x, cursor_draw_y, saved_cursor_fg, current_bg);
-                    cursor_drawn = false;
-                } else {
-                    // Draw cursor
-                    cursor_draw_x = term.cursor_x;
-                    cursor_draw_y = term.cursor_y;
-                    saved_cursor_char = charbuf_back[cursor_draw_x + cursor_draw_y * CHAR_COLS];
-                    
-                    uint idx = cursor_draw_x + cursor_draw_y * CHAR_COLS;
-                    uint bit = (idx % 8) * 4;
-                    uint word = idx / 8;
-                    saved_cursor_fg = 0;
-                    for (int p = 2; p >= 0; --p) {
-                        uint32_t val = colourbuf_back[word + p * COLOUR_PLANE_SIZE_WORDS];
-                        uint8_t nibble = (val >> bit) & 0xF;
-                        saved_cursor_fg = (saved_cursor_fg << 2) | (nibble & 0x3);
-                    }
-                    
-                    // Clear the area with current background color before drawing
-                    set_char(cursor_draw_x, cursor_draw_y, ' ');
-                    set_colour(cursor_draw_x, cursor_draw_y, 0, current_bg);
-                    
-                    uint8_t cursor_char = ' ';
-                    uint8_t cursor_fg = current_fg;
-                    uint8_t cursor_bg = current_bg;
-                    switch (current_cursor) {
-                        case CURSOR__SOLID_BLOCK: cursor_char = (uint8_t)0xDB; break;
-                        case CURSOR_APPLE_I: cursor_char = '@'; break;
-                        case CURSOR_UNDERLINE: cursor_char = '_'; break;
-                        case CURSOR_BAR: cursor_char = '|'; break;
-                        case CURSOR_SHADED_BLOCK: cursor_char = (uint8_t)0xB2; break;
-                        case CURSOR__SOLID_ARROW: cursor_char = '>'; break;
-                    }
-                    set_char(cursor_draw_x, cursor_draw_y, cursor_char);
-                    set_colour(cursor_draw_x, cursor_draw_y, cursor_fg, cursor_bg);
-                    cursor_drawn = true;
-                }
-                buffer_dirty = true;
-                safe_request_swap();
-                
-                #ifdef DEBUG
-                static int cursor_debug_count = 0;
-                if (cursor_debug_count++ > 100) {
-                    cursor_debug_count = 0;
-                    printf("Cursor: x=%d, y=%d, visible=%d, drawn=%d, fg=%d, bg=%d\n",
-                           term.cursor_x, term.cursor_y, term.cursor_visible, 
-                           cursor_drawn, current_fg, current_bg);
-                }
-                #endif
-            }
+        #ifdef DEBUG
+        static int cursor_debug_count = 0;
+        if (cursor_debug_count++ > 100) {
+            cursor_debug_count = 0;
+            printf("Cursor: x=%d, y=%d, visible=%d, fg=%d, bg=%d\n",
+                   term.cursor_x, term.cursor_y, term.cursor_visible,
+                   current_fg, current_bg);
         }
+        #endif
         
-        // Process UART input
-        process_uart_buffer();
+        // Take in and process input, the keyboard's first so that its keys
+        // are on their way before the screen is touched
+        keyboard_service();
+        poll_input_now();
+        process_input();
+#if SESSIONS > 1
+        for (uint s = 1; s < SESSIONS; s++) {
+            process_session_input(s);
+        }
+#endif
+        mono_cache_update();
+        capture_service();
         
         if (absolute_time_diff_us(last_loop_time, now) > 100000) {
             input_active = false;
         }
         
-        if (deferred_pending && scroll_settled) {
+        if (deferred_pending) {
             //deprocess_uart_bufferferred_pending = false;
+            lock_back_buffer();
             handle_char(deferred_char);
+            unlock_back_buffer();
+        }
+        
+        // A history search goes on a slice at a time, between batches of input
+        if (search_pending()) {
+            lock_back_buffer();
+            search_step();
+            unlock_back_buffer();
+        }
+        
+        // A bulk update whose host has gone quiet is given up here, or it
+        // would hold the flips until more input came
+        if (bulk_pending()) {
+            lock_back_buffer();
+            bulk_expire();
+            unlock_back_buffer();
         }
         
         if (time_reached(led_off_time)) {
             gpio_put(LED_PIN, 0);
         }
+        update_ingest_rate();
+        update_idle();
         
-        // Ensure minimum loop frequency to keep cursor blinking
-        int64_t time_diff = absolute_time_diff_us(last_loop_time, now);
-        if (uart_tail == uart_head && time_diff < MAIN_LOOP_MIN_MS * 1000) {
-            busy_wait_us(MAIN_LOOP_MIN_MS * 1000 - time_diff);
-        }
+        // Go round at least every MAIN_LOOP_MIN_MS for the LED and the
+        // deferred character (IDLE_LOOP_MS when idle), asleep in between,
+        // and straight back to work when input arrives. A search in hand
+        // goes round every millisecond until it's done.
+        uint loop_ms = search_pending() ? 1 : core0_idle ? IDLE_LOOP_MS : MAIN_LOOP_MIN_MS;
+        idle_wait(delayed_by_us(last_loop_time, loop_ms * 1000));
         last_loop_time = now;
     }
 }
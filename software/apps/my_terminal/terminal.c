@@ -0,0 +1,3058 @@
+/*
+===============================================================================
+Terminal engine for the DVI terminal (see main.c)
+===============================================================================
+  The screen buffers and the page flip between them, the escape sequence
+  parser, scrolling regions, scrollback, fonts, colours and the menus. No
+  hardware is touched here, so this file also builds on a PC for the
+  benchmark in host/. What the board provides comes through the
+  platform_*() hooks in terminal.h.
+
+License: MIT
+Author: Donald R. Moran
+===============================================================================
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico.h"
+#include "pico/time.h"
+#include "hardware/sync.h"
+#include "terminal.h"
+#if FONT_8X8
+#include "font_work/Px437_IBM_BIOS/Px437_IBM_BIOS_scanline.h"
+#include "font_work/Px437_IBM_CGA/Px437_IBM_CGA_scanline.h"
+#include "font_work/Px437_IBM_EGA_8x8/Px437_IBM_EGA_8x8_scanline.h"
+#include "font_work/Px437_TridentEarly_8x8/Px437_TridentEarly_8x8_scanline.h"
+#else
+#include "Px437_IBM_VGA_8x16_scanline.h"
+#include "font_work/Px437_TridentEarly_8x16/Px437_TridentEarly_8x16_scanline.h"
+#include "font_work/Tamzen8x16r/Tamzen8x16r_scanline.h"
+#include "font_work/Tamzen8x16b/Tamzen8x16b_scanline.h"
+#endif
+
+// === Global State ===
+// The fonts stay in flash, and the one in use is copied into SRAM, since
+// core1 reads it for every character it encodes. (The scratch banks only
+// have room for the line being encoded, which the encoding core copies there:
+// see scratch_lines_t in main.c.) A new font goes into the other table and
+// perform_swap() moves core1 over to it, so switching takes effect on the
+// next frame.
+const font_t fonts[N_FONTS] = {
+#if FONT_8X8
+    {"ibm-bios",    px437_ibm_bios_scanline,          px437_ibm_bios_blank_lines},
+    {"ibm-cga",     px437_ibm_cga_scanline,           px437_ibm_cga_blank_lines},
+    {"ibm-ega",     px437_ibm_ega_8x8_scanline,       px437_ibm_ega_8x8_blank_lines},
+    {"trident",     px437_tridentearly_8x8_scanline,  px437_tridentearly_8x8_blank_lines},
+#else
+    {"ibm-vga",     px437_ibm_vga_8x16_scanline,      px437_ibm_vga_8x16_blank_lines},
+    {"trident",     px437_tridentearly_8x16_scanline, px437_tridentearly_8x16_blank_lines},
+    {"tamzen",      tamzen8x16r_scanline,             tamzen8x16r_blank_lines},
+    {"tamzen-bold", tamzen8x16b_scanline,             tamzen8x16b_blank_lines},
+#endif
+};
+
+__attribute__((aligned(4))) uint8_t font_ram[2][FONT_N_CHARS * FONT_CHAR_HEIGHT];
+const uint8_t *font_scanline = font_ram[0];
+static const uint8_t *font_pending = NULL; // Installed by the next flip
+uint current_font = 0;
+
+uint char_cols;
+uint char_rows;
+uint colour_row_words;
+uint colour_plane_words;
+
+// Swaps are timed from request_swap() for stats
+#define STATS_QUERY 9000
+#define OVERLAY_SET 9001 // ESC[?9001;slot;image;x;y n
+#define BULK_UPDATE 9002 // ESC P ?9002;row;col;count;flags b (see bulk_begin())
+#define CAPTURE_LOG_QUERY 9003 // ESC[?9003;action n (see platform_capture_log())
+volatile render_stats_t stats;
+static uint32_t swap_request_us;
+
+// Double buffering: core1 renders from the front screen, core0 writes to the
+// back one, and perform_swap() exchanges the pointers at VSYNC. Each screen
+// also has a row map from screen row to physical row, used by core1's row
+// lookup. Scrolling (whole screen or a DECSTBM region) and inserting or
+// deleting lines just rotate part of the map and blank the rows exposed, so
+// the text itself never moves. Every virtual console past the first has a
+// screen more (see terminal_set_consoles()).
+#define N_SCREENS (CONSOLES + 1)
+static screen_t screens[N_SCREENS];
+
+// The cell store (see HISTORY_STORE_BYTES): each screen's characters and
+// colour planes, then the history's index, lines and characters, placed by
+// terminal_set_geometry()
+#define CHARBUF_MAX_BYTES (((MAX_CHAR_ROWS + 1) * MAX_CHAR_COLS + CHARBUF_PAD + 3) & ~3)
+#define COLOURBUF_MAX_BYTES ((COLOUR_N_PLANES * (MAX_CHAR_ROWS + 1) * MAX_COLOUR_ROW_WORDS + COLOUR_PAD_WORDS) * 4)
+#define CELL_STORE_BYTES (N_SCREENS * (CHARBUF_MAX_BYTES + COLOURBUF_MAX_BYTES) + HISTORY_STORE_BYTES)
+static uint64_t cell_store[CELL_STORE_BYTES / 8];
+screen_t *screen_front = &screens[0];
+static screen_t *screen_back = &screens[1]; // Of the session being parsed
+static bool resync_pending = false;
+
+static const uint16_t *glyph_blank_lines; // Of current_font
+
+// Scrollback, in the cell store
+uint8_t *history_chars; // history_capacity lines of char_cols, then CHARBUF_PAD
+history_line_t *history;
+uint history_capacity; // Lines, set from the geometry
+static uint history_count = 0;
+static uint history_head = 0; // Next line to be written
+// For each line, the pairs of characters in it (see line_bigrams()), which
+// rule most lines out of a search before their text is looked at. Line i is
+// always at history_chars[i * char_cols], so nothing more is needed to find it.
+static uint64_t *history_index;
+__attribute__((aligned(4))) uint32_t colour_pool[COLOUR_POOL_SIZE][COLOUR_POOL_ENTRY_WORDS + COLOUR_PAD_WORDS];
+static uint16_t colour_pool_refs[COLOUR_POOL_SIZE];
+static uint colour_pool_last = 0;
+
+// How far back the view is (0 is the live screen), with history_head in the
+// top half so core1 reads both at once. Core1 picks it up at the start of
+// each frame.
+static uint view_offset = 0;
+volatile uint32_t history_view = 0;
+
+// Sixel strips (see GFX_POOL_WORDS), sized for the screen by
+// terminal_set_geometry()
+uint32_t gfx_pool[GFX_POOL_WORDS];
+uint gfx_strip_words;
+static uint gfx_n_strips;
+
+// The pane of the session being parsed (see terminal_select_session()): its
+// rows are screen rows pane_top onwards, and everything the parser does is
+// in pane rows
+static uint pane_top = 0;
+static uint pane_rows;
+
+// Scrolling region (DECSTBM), inclusive pane rows
+static uint8_t scroll_top = 0;
+static uint8_t scroll_bottom; // Set up by terminal_set_geometry()
+
+// Each console has one bit per character row of its back buffer, set
+// whenever a row is written. At a flip these become resync_rows: the rows
+// where the new back buffer is stale and must be copied from the new front
+// before core0 writes again.
+typedef struct {
+    screen_t *screen; // Back buffer; for the console shown, the one paired with the front
+    uint32_t dirty_rows[DIRTY_MAP_WORDS];
+    uint32_t stale_info_rows[DIRTY_MAP_WORDS]; // screen->row_info needs refreshing
+    uint8_t bulk_blocks; // Bulk updates coming in, which hold its flips (see bulk_begin())
+} console_t;
+
+static console_t consoles[CONSOLES] = {{.screen = &screens[1]}};
+static console_t *console = &consoles[0]; // Of the session being parsed
+static uint n_consoles = 1;
+static uint shown_console = 0;
+static uint32_t resync_rows[DIRTY_MAP_WORDS];
+uint32_t swap_rows[DIRTY_MAP_WORDS];
+
+// The handoff between the cores, in which every flag has a single writer.
+// Core0 raises core0_writing for as long as it writes the back buffer, and
+// core1 raises core1_flipping for as long as it flips. Each raises its own
+// and then checks the other's (a full barrier between), so they are never
+// both inside; core1 backs off at once if core0 is there, and only core0
+// ever waits. Core1 reads nothing but the front buffer, which core0 never
+// writes, so a flip is the only thing the two have to agree on.
+//
+// At VSYNC core1 also raises flip_wanted while the flip is due (see
+// perform_swap_within()). That keeps core0 from starting another write, so
+// the worst core1 waits for, with time to spare in the blanking interval, is
+// the end of the one in progress, never a stream of them.
+static volatile bool core0_writing = false;
+static volatile bool core1_flipping = false;
+static volatile bool flip_wanted = false;
+
+// Swaps asked for by core0 and answered by core1's flips: one is pending
+// while they differ (see swap_pending())
+volatile uint32_t swap_requests = 0;
+volatile uint32_t swaps_done = 0;
+
+// Terminal state
+terminal_state_t term;
+
+volatile bool input_active = false;
+absolute_time_t last_input_time;
+
+// Cursor and rendering state
+int saved_cursor_x = -1;
+int saved_cursor_y = -1;
+volatile bool buffer_dirty = false;
+
+// ANSI parsing: the state of the escape sequence parser (see vt_advance())
+#define ANSI_PARAM_MAX 16 // Enough for ESC[38;2;r;g;b and ESC[48;2;r;g;b together
+#define ANSI_INTERMEDIATE_MAX 2
+typedef struct {
+    uint8_t state;            // enum vt_state
+    uint8_t n_params;         // Parameters seen, which may be more than are kept
+    uint8_t n_intermediates;
+    char private_marker;      // '<' to '?' straight after CSI or DCS, or 0
+    bool overflow;            // Too many intermediates: consumed but not dispatched
+    char intermediates[ANSI_INTERMEDIATE_MAX];
+    uint16_t params[ANSI_PARAM_MAX];
+    bool utf8;                // Decoding UTF-8 (see utf8_decode())
+    uint8_t utf8_pending;     // Continuation bytes still to come
+    uint32_t utf8_codepoint;  // What they have given so far
+    uint8_t last_glyph;       // The last character printed, for REP
+    bool last_glyph_valid;
+} vt_parser_t;
+
+vt_parser_t vt;
+char osc_buffer[24];
+uint8_t osc_len = 0;
+static uint current_session = 0; // Whose input is being parsed (see Sessions)
+
+// The Sixel image being received (see sixel_put()). Its pixels go straight
+// into strips, which it takes as it reaches each text row.
+#define SIXEL_REGISTERS 256
+#define SIXEL_PARAM_MAX 5
+enum sixel_state { SIXEL_DATA, SIXEL_REPEAT, SIXEL_COLOUR, SIXEL_RASTER };
+typedef struct {
+    bool active;
+    uint8_t state;       // enum sixel_state
+    uint8_t level;       // Grey level of the colour register in use
+    uint8_t bg_level;    // What new strips are cleared to
+    int top;             // Screen row of the image's first text row, < 0 once scrolled off
+    uint left;           // Screen pixel of the image's first column
+    uint x, y;           // Next sixel: column, and top line of its band
+    uint repeat;
+    uint8_t n_params;
+    uint16_t params[SIXEL_PARAM_MAX];
+    uint8_t strip[GFX_MAX_STRIPS]; // 1 + the strip of each text row of the image, or 0
+    uint8_t levels[SIXEL_REGISTERS];
+} sixel_t;
+
+static sixel_t sixel;
+
+// Theme and cursor
+enum cursor_style { CURSOR__SOLID_BLOCK, CURSOR_UNDERLINE, CURSOR_BAR, CURSOR_APPLE_I, CURSOR_SHADED_BLOCK, CURSOR__SOLID_ARROW };
+enum cursor_style current_cursor = CURSOR_APPLE_I;
+uint8_t current_fg = COLOUR_WHITE;
+uint8_t current_bg = COLOUR_BLACK;
+palette_info_t display_palette = {.fg = 12, .bg = COLOUR_BLACK}; // Green on black, theme 0
+uint8_t current_attr = 0; // ATTR_* set by SGR, applied to text as it is written
+
+// Menu system
+volatile bool theme_select_mode = false;
+volatile bool cursor_menu_mode = false;
+volatile bool mode_menu_mode = false;
+volatile bool bg_color_menu_mode = false;
+volatile bool fg_color_menu_mode = false;
+volatile bool search_menu_mode = false;
+char color_menu_buf[3] = {0};
+uint8_t color_menu_buf_len = 0;
+
+// Scrollback search (Ctrl+R). Lines are counted back from the newest, 1 being
+// the line just above the screen, and history_push() keeps the counts on the
+// same lines as more scroll off.
+#define SEARCH_MAX_QUERY 28
+#define SEARCH_STEP_BYTES (16 * 1024) // Of index and text looked at per search_step()
+static struct {
+    char query[SEARCH_MAX_QUERY + 1];
+    uint len;
+    uint64_t bigrams; // line_bigrams() of the query
+    uint next;        // Line to look at next while the scan runs, else 0
+    uint match;       // Line of the last match, 0 if none
+} search;
+
+// === Buffering System ===
+static inline void mark_row_dirty(uint y) {
+    console->dirty_rows[y / 32] |= 1u << (y % 32);
+    console->stale_info_rows[y / 32] |= 1u << (y % 32);
+}
+
+static inline void mark_all_rows_dirty(void) {
+    for (uint i = 0; i < DIRTY_MAP_WORDS; i++) {
+        console->dirty_rows[i] = ~0u;
+        console->stale_info_rows[i] = ~0u;
+    }
+}
+
+// Ask for a flip, if one isn't pending already: whatever changes before it
+// goes in the same one. Only core0 writes swap_requests, holding the back
+// buffer, so core1 can't flip while it does.
+void request_swap(void) {
+    if (!swap_pending()) {
+        swap_request_us = time_us_32();
+        swap_requests++;
+        #ifdef DEBUG
+        printf("Swap requested at time=%lld\n", get_absolute_time());
+        #endif
+    }
+}
+
+// Called by core1 (and once by main() before core1 starts). Flips the front
+// and back buffers of the console shown by pointer; nothing is copied here.
+// If core0 is writing the back buffer it doesn't wait but returns false, with
+// the swap still pending, and likewise while a bulk update is coming in.
+bool perform_swap(void) {
+    console_t *shown = &consoles[shown_console];
+    __atomic_store_n(&core1_flipping, true, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&core0_writing, __ATOMIC_SEQ_CST) || shown->bulk_blocks) {
+        __atomic_store_n(&core1_flipping, false, __ATOMIC_RELEASE);
+        return false;
+    }
+    
+    screen_t *front = screen_front;
+    screen_front = shown->screen;
+    shown->screen = front;
+    if (console == shown) {
+        screen_back = front;
+    }
+    if (font_pending) {
+        font_scanline = font_pending;
+        font_pending = NULL;
+    }
+    resync_pending = true;
+    
+    for (uint w = 0; w < DIRTY_MAP_WORDS; w++) {
+        resync_rows[w] |= shown->dirty_rows[w];
+        swap_rows[w] = shown->dirty_rows[w];
+        shown->dirty_rows[w] = 0;
+    }
+    
+    if (swap_pending()) {
+        uint32_t latency = time_us_32() - swap_request_us;
+        stats.swap_latency_us_last = latency;
+        if (latency > stats.swap_latency_us_worst) {
+            stats.swap_latency_us_worst = latency;
+        }
+    }
+    stats.swaps++;
+    swaps_done = swap_requests;
+    __atomic_store_n(&core1_flipping, false, __ATOMIC_RELEASE);
+    __sev();
+    
+    #ifdef DEBUG
+    printf("Buffer swapped at time=%lld\n", get_absolute_time());
+    #endif
+    return true;
+}
+
+// The flip at VSYNC: hold core0 off starting another write, and give the one
+// in progress until wait_us to finish, or put the flip off to the next frame.
+// A flip held for a bulk update isn't waited for.
+bool perform_swap_within(uint32_t wait_us) {
+    if (consoles[shown_console].bulk_blocks) {
+        return false;
+    }
+    uint32_t start = time_us_32();
+    __atomic_store_n(&flip_wanted, true, __ATOMIC_SEQ_CST);
+    bool flipped;
+    while (!(flipped = perform_swap()) && time_us_32() - start < wait_us) {
+        tight_loop_contents();
+    }
+    __atomic_store_n(&flip_wanted, false, __ATOMIC_RELEASE);
+    __sev();
+    if (!flipped) {
+        stats.flips_deferred++;
+    }
+    return flipped;
+}
+
+// Only when something changed: the cursor is drawn by core1 from cursor_info,
+// and publish_cursor() marks the buffer dirty when it moves
+// (A console not on screen has nothing to flip: it goes up as a whole when
+// it is shown.)
+void safe_request_swap(void) {
+    if (buffer_dirty) {
+        if (console == &consoles[shown_console]) {
+            request_swap(); // Flipped by core1 at the next VSYNC
+        }
+        buffer_dirty = false;
+    }
+}
+
+// Core0 must hold the back buffer while it writes to it, so that core1 never
+// flips half way through an update. Taking it also copies across any rows the
+// new back buffer missed while it was on screen.
+void lock_back_buffer(void) {
+    while (1) {
+        while (flip_wanted || core1_flipping) {
+            __wfe(); // Core1 sends an event when it is done
+        }
+        __atomic_store_n(&core0_writing, true, __ATOMIC_SEQ_CST);
+        if (!__atomic_load_n(&core1_flipping, __ATOMIC_SEQ_CST)) {
+            break;
+        }
+        __atomic_store_n(&core0_writing, false, __ATOMIC_SEQ_CST);
+    }
+    
+    if (!resync_pending) {
+        return;
+    }
+    resync_pending = false;
+    screen_t *back = consoles[shown_console].screen; // Not screen_back if another session is selected
+    const screen_t *front = screen_front;
+    memcpy(back->row_map, front->row_map, char_rows);
+    back->cursor = front->cursor;
+    back->overlay = front->overlay;
+    if (front->menu.visible || back->menu.visible) {
+        back->menu = front->menu;
+    }
+    for (uint w = 0; w < DIRTY_MAP_WORDS; w++) {
+        uint32_t bits = resync_rows[w];
+        resync_rows[w] = 0;
+        while (bits) {
+            uint y = w * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            if (y >= char_rows) break;
+            memcpy(&back->charbuf[y * char_cols], &front->charbuf[y * char_cols], char_cols);
+            for (int p = 0; p < COLOUR_N_PLANES; p++) {
+                uint word = p * colour_plane_words + y * colour_row_words;
+                memcpy(&back->colourbuf[word], &front->colourbuf[word],
+                       colour_row_words * sizeof(uint32_t));
+            }
+            back->row_info[y] = front->row_info[y];
+        }
+    }
+}
+
+// Font lines that are empty in every glyph of a row of characters
+static uint16_t row_blank_lines(const uint8_t *chars) {
+    uint16_t blank = 0xFFFF;
+    for (uint x = 0; x < char_cols; x++) {
+        blank &= glyph_blank_lines[chars[x]];
+    }
+    return blank;
+}
+
+// Work out row_info for physical row r of the back buffer. The background is
+// kept whenever the row has a single one, even if no font line is blank, so
+// that the blank lines can be worked out again for a new font from the
+// characters alone.
+static void update_row_info(uint r) {
+    uint16_t blank = row_blank_lines((const uint8_t *)&screen_back->charbuf[r * char_cols]);
+    bool uniform = true;
+    
+    // The background is bits 3:2 of every nibble, in each of the three
+    // planes, and the foreground bits 1:0
+    uint8_t bg = 0;
+    uint8_t fg = 0;
+    bool same_fg = true;
+    for (int p = 2; p >= 0; --p) {
+        const uint32_t *words = &screen_back->colourbuf[p * colour_plane_words + r * colour_row_words];
+        uint32_t nibble = words[0] & 0xF;
+        uint32_t pattern = nibble * 0x11111111u;
+        for (uint w = 0; w < colour_row_words; w++) {
+            uint32_t mask = ~0u;
+            if (w == colour_row_words - 1 && char_cols % 8) {
+                mask >>= (8 - char_cols % 8) * 4; // Only some cells of the last word are used
+            }
+            uint32_t diff = (words[w] ^ pattern) & mask;
+            if (diff & 0xCCCCCCCCu) {
+                uniform = false;
+            }
+            if (diff & 0x33333333u) {
+                same_fg = false;
+            }
+        }
+        bg = (bg << 2) | (nibble >> 2);
+        fg = (fg << 2) | (nibble & 0x3);
+    }
+    
+    // Underline and reverse draw on blank lines too, so such rows never count
+    // as blank. Rows with extended colours don't either: the caches are of
+    // RGB222 colours.
+    const uint32_t *attrs = &screen_back->colourbuf[ATTR_PLANE * colour_plane_words + r * colour_row_words];
+    const uint32_t *ext = &screen_back->colourbuf[EXT_PLANE * colour_plane_words + r * colour_row_words];
+    bool any_attrs = false;
+    bool any_ext = false;
+    for (uint w = 0; w < colour_row_words; w++) {
+        uint32_t mask = ~0u;
+        if (w == colour_row_words - 1 && char_cols % 8) {
+            mask >>= (8 - char_cols % 8) * 4;
+        }
+        if (attrs[w] & mask) {
+            any_attrs = true;
+            uniform = false;
+        }
+        if (ext[w] & mask) {
+            any_ext = true;
+            uniform = false;
+        }
+    }
+    
+    screen_back->row_info[r].blank_lines = uniform ? blank : 0;
+    screen_back->row_info[r].bg = uniform ? bg : ROW_BG_MIXED;
+    screen_back->row_info[r].fg = uniform && same_fg ? fg : ROW_BG_MIXED;
+    screen_back->row_info[r].attrs = any_attrs;
+    screen_back->row_info[r].ext = any_ext;
+}
+
+static void refresh_row_info(void) {
+    for (uint w = 0; w < DIRTY_MAP_WORDS; w++) {
+        uint32_t bits = console->stale_info_rows[w];
+        console->stale_info_rows[w] = 0;
+        while (bits) {
+            uint y = w * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            if (y >= char_rows) break;
+            update_row_info(y);
+        }
+    }
+}
+
+void unlock_back_buffer(void) {
+    refresh_row_info();
+    __atomic_store_n(&core0_writing, false, __ATOMIC_RELEASE);
+    __sev();
+}
+
+// Physical row of the back buffer that holds row y of the session's pane
+static inline uint back_row(uint y) {
+    return screen_back->row_map[pane_top + y];
+}
+
+// Cells of row y of the pane that are shown: half of them on a double width
+// or double height line
+static inline uint line_cols(uint y) {
+    if (y < pane_rows && screen_back->row_info[back_row(y)].size != LINE_SINGLE) {
+        return char_cols / 2;
+    }
+    return char_cols;
+}
+
+void set_char(uint x, uint y, uint8_t c) {
+    if (x < char_cols && y < pane_rows) {
+        uint r = back_row(y);
+        screen_back->charbuf[x + r * char_cols] = c;
+        mark_row_dirty(r);
+    }
+}
+
+char get_char(uint x, uint y) {
+    if (x >= char_cols || y >= pane_rows) return ' ';
+    return screen_back->charbuf[x + back_row(y) * char_cols];
+}
+
+// Read back the colours of a cell from the three planes and EXT_PLANE
+void get_colour(uint x, uint y, uint8_t *fg, uint8_t *bg) {
+    *fg = 0;
+    *bg = 0;
+    if (x >= char_cols || y >= pane_rows) return;
+    
+    uint bit = (x % 8) * 4;
+    uint word = back_row(y) * colour_row_words + x / 8;
+    for (int p = EXT_PLANE; p >= 0; --p) {
+        if (p == ATTR_PLANE) continue;
+        uint32_t val = screen_back->colourbuf[word + p * colour_plane_words];
+        uint8_t nibble = (val >> bit) & 0xF;
+        *fg = (*fg << 2) | (nibble & 0x3);
+        *bg = (*bg << 2) | ((nibble >> 2) & 0x3);
+    }
+}
+
+void set_colour(uint x, uint y, uint8_t fg, uint8_t bg) {
+    if (x >= char_cols || y >= pane_rows) return;
+    uint r = back_row(y);
+    mark_row_dirty(r);
+    
+    uint bit = (x % 8) * 4;
+    uint word = r * colour_row_words + x / 8;
+
+    #ifdef DEBUG
+    printf("set_colour: x=%u, y=%u, fg=0x%02X, bg=0x%02X, bit=%u, word=%u\n", 
+           x, y, fg, bg, bit, word);
+    #endif
+    
+    for (int p = 0; p <= EXT_PLANE; ++p) {
+        if (p == ATTR_PLANE) continue;
+        uint32_t val = (fg & 0x3) | ((bg << 2) & 0xC);
+        screen_back->colourbuf[word + p * colour_plane_words] =
+            (screen_back->colourbuf[word + p * colour_plane_words] & ~(0xFu << bit)) | (val << bit);
+        fg >>= 2;
+        bg >>= 2;
+    }
+}
+
+// Set nibbles x..x+n-1 of one row of a plane to the same value. Whole words
+// (8 cells) are written at once, with masked read-modify-writes only for the
+// partial words at each end.
+static void fill_nibbles(uint32_t *row_words, uint x, uint n, uint32_t nibble) {
+    uint last_x = x + n - 1;
+    uint first = x / 8;
+    uint last = last_x / 8;
+    uint32_t head_mask = ~0u << ((x % 8) * 4);
+    uint32_t tail_mask = ~0u >> ((7 - last_x % 8) * 4);
+    uint32_t pattern = nibble * 0x11111111u;
+    
+    if (first == last) {
+        uint32_t mask = head_mask & tail_mask;
+        row_words[first] = (row_words[first] & ~mask) | (pattern & mask);
+    } else {
+        row_words[first] = (row_words[first] & ~head_mask) | (pattern & head_mask);
+        for (uint w = first + 1; w < last; ++w) {
+            row_words[w] = pattern;
+        }
+        row_words[last] = (row_words[last] & ~tail_mask) | (pattern & tail_mask);
+    }
+}
+
+// Move nibbles src..src+n-1 of one row of a plane to dst..dst+n-1, where
+// the two may overlap. The span is lined up on a word boundary in a copy
+// with a funnel shift per word, then shifted into place the same way, with
+// masked writes only for the partial words at each end.
+static void move_nibbles(uint32_t *row_words, uint dst, uint src, uint n) {
+    uint32_t span[MAX_COLOUR_ROW_WORDS + 1];
+    uint words = (n + 7) / 8;
+    uint shift = (src % 8) * 4;
+    const uint32_t *from = &row_words[src / 8];
+    for (uint i = 0; i < words; i++) {
+        span[i] = shift ? from[i] >> shift | from[i + 1] << (32 - shift) : from[i];
+    }
+    span[words] = 0;
+    
+    shift = (dst % 8) * 4;
+    uint end = shift + n * 4;
+    uint32_t *to = &row_words[dst / 8];
+    for (uint i = 0; i < (end + 31) / 32; i++) {
+        uint32_t v = shift ? span[i] << shift | (i ? span[i - 1] >> (32 - shift) : 0) : span[i];
+        uint32_t mask = i == 0 ? ~0u << shift : ~0u;
+        if (i == (end - 1) / 32 && end % 32) {
+            mask &= ~0u >> (32 - end % 32);
+        }
+        to[i] = (to[i] & ~mask) | (v & mask);
+    }
+}
+
+// Set the colours of n cells of row y starting at x (clipped to the row)
+void set_colour_span(uint x, uint y, uint n, uint8_t fg, uint8_t bg) {
+    if (x >= char_cols || y >= pane_rows || n == 0) return;
+    if (n > char_cols - x) n = char_cols - x;
+    uint r = back_row(y);
+    mark_row_dirty(r);
+    
+    for (int p = 0; p <= EXT_PLANE; ++p) {
+        if (p == ATTR_PLANE) continue;
+        fill_nibbles(&screen_back->colourbuf[p * colour_plane_words + r * colour_row_words],
+                     x, n, (fg & 0x3) | ((bg << 2) & 0xC));
+        fg >>= 2;
+        bg >>= 2;
+    }
+}
+
+// SGR attributes (ATTR_*) of a span of cells, or of one cell
+void set_attr_span(uint x, uint y, uint n, uint8_t attr) {
+    if (x >= char_cols || y >= pane_rows || n == 0) return;
+    if (n > char_cols - x) n = char_cols - x;
+    uint r = back_row(y);
+    mark_row_dirty(r);
+    fill_nibbles(&screen_back->colourbuf[ATTR_PLANE * colour_plane_words + r * colour_row_words],
+                 x, n, attr & 0xF);
+}
+
+void set_attr(uint x, uint y, uint8_t attr) {
+    set_attr_span(x, y, 1, attr);
+}
+
+uint8_t get_attr(uint x, uint y) {
+    if (x >= char_cols || y >= pane_rows) return 0;
+    uint32_t word = screen_back->colourbuf[ATTR_PLANE * colour_plane_words +
+                                   back_row(y) * colour_row_words + x / 8];
+    return (word >> ((x % 8) * 4)) & 0xF;
+}
+
+// === Terminal Operations ===
+// Caller holds the back buffer (see lock_back_buffer())
+void clear_screen(void) {
+    for (uint y = pane_top; y < pane_top + pane_rows; y++) {
+        screen_back->row_map[y] = y;
+        screen_back->row_info[y].gfx = 0;
+        screen_back->row_info[y].size = LINE_SINGLE;
+    }
+    memset(&screen_back->charbuf[pane_top * char_cols], ' ', pane_rows * char_cols);
+    for (uint y = 0; y < pane_rows; y++) {
+        set_colour_span(0, y, char_cols, current_fg, current_bg);
+        set_attr_span(0, y, char_cols, 0);
+    }
+    
+    term.cursor_x = 0;
+    term.cursor_y = 0;
+    mark_all_rows_dirty();
+    request_swap();
+}
+
+static void blank_rows(uint first, uint count) {
+    for (uint y = first; y < first + count; y++) {
+        screen_back->row_info[back_row(y)].gfx = 0;
+        screen_back->row_info[back_row(y)].size = LINE_SINGLE;
+        memset(&screen_back->charbuf[back_row(y) * char_cols], ' ', char_cols);
+        set_colour_span(0, y, char_cols, current_fg, current_bg);
+        set_attr_span(0, y, char_cols, 0);
+    }
+}
+
+// Move screen rows top..bottom up by n. The n physical rows that fall off the
+// top are recycled, blank, at the bottom; nothing else is copied.
+static void rotate_rows_up(uint top, uint bottom, uint n) {
+    if (top > bottom || bottom >= pane_rows) return;
+    uint height = bottom - top + 1;
+    if (n > height) n = height;
+    if (n == 0) return;
+    
+    uint8_t recycled[MAX_CHAR_ROWS];
+    uint8_t *map = &screen_back->row_map[pane_top];
+    memcpy(recycled, &map[top], n);
+    memmove(&map[top], &map[top + n], height - n);
+    memcpy(&map[bottom - n + 1], recycled, n);
+    blank_rows(bottom - n + 1, n);
+    buffer_dirty = true;
+}
+
+// Move screen rows top..bottom down by n, recycling rows into the top
+static void rotate_rows_down(uint top, uint bottom, uint n) {
+    if (top > bottom || bottom >= pane_rows) return;
+    uint height = bottom - top + 1;
+    if (n > height) n = height;
+    if (n == 0) return;
+    
+    uint8_t recycled[MAX_CHAR_ROWS];
+    uint8_t *map = &screen_back->row_map[pane_top];
+    memcpy(recycled, &map[bottom - n + 1], n);
+    memmove(&map[top + n], &map[top], height - n);
+    memcpy(&map[top], recycled, n);
+    blank_rows(top, n);
+    buffer_dirty = true;
+}
+
+// ICH and DCH: move the cells of row y from x on n places right (to insert)
+// or left (to delete), within the row, blanking the n cells left behind in
+// the current colours. The characters are one memmove and each plane a
+// move_nibbles(), so only the row is dirtied.
+static void shift_cells(uint x, uint y, uint n, bool right) {
+    uint cols = line_cols(y);
+    if (y >= pane_rows || x >= cols || n == 0) return;
+    if (n > cols - x) n = cols - x;
+    uint keep = cols - x - n;
+    uint r = back_row(y);
+    uint dst = right ? x + n : x;
+    uint src = right ? x : x + n;
+    uint blank = right ? x : cols - n;
+    
+    char *row = &screen_back->charbuf[r * char_cols];
+    if (keep) {
+        memmove(&row[dst], &row[src], keep);
+        for (int p = 0; p < COLOUR_N_PLANES; p++) {
+            move_nibbles(&screen_back->colourbuf[p * colour_plane_words + r * colour_row_words],
+                         dst, src, keep);
+        }
+    }
+    memset(&row[blank], ' ', n);
+    set_colour_span(blank, y, n, current_fg, current_bg);
+    set_attr_span(blank, y, n, 0);
+    buffer_dirty = true;
+}
+
+// ECH and EL: blank n cells of row y from x (clipped to the row), without
+// moving the others
+static void erase_cells(uint x, uint y, uint n) {
+    uint cols = line_cols(y);
+    if (y >= pane_rows || x >= cols || n == 0) return;
+    if (n > cols - x) n = cols - x;
+    memset(&screen_back->charbuf[x + back_row(y) * char_cols], ' ', n);
+    set_colour_span(x, y, n, current_fg, current_bg);
+    set_attr_span(x, y, n, 0);
+    buffer_dirty = true;
+}
+
+// === Scrollback ===
+static void publish_history_view(void) {
+    history_view = (history_head << 16) | view_offset;
+}
+
+// Pool entry holding the colour and attribute planes of physical row r of the
+// back buffer, adding it if it is new. If the pool is full of other rows the
+// line keeps the most recent entry: its text is kept, its colours are not.
+static uint colour_pool_add(uint r) {
+    uint32_t row[COLOUR_POOL_ENTRY_WORDS];
+    for (int p = 0; p < COLOUR_N_PLANES; p++) {
+        memcpy(&row[p * MAX_COLOUR_ROW_WORDS],
+               &screen_back->colourbuf[p * colour_plane_words + r * colour_row_words],
+               colour_row_words * sizeof(uint32_t));
+    }
+
+    // Compare only the words in use, which covers the odd spare cell too
+    uint free_entry = COLOUR_POOL_SIZE;
+    for (uint i = 0; i < COLOUR_POOL_SIZE; i++) {
+        uint e = (colour_pool_last + i) % COLOUR_POOL_SIZE;
+        if (colour_pool_refs[e] == 0) {
+            if (free_entry == COLOUR_POOL_SIZE) free_entry = e;
+            continue;
+        }
+        bool same = true;
+        for (int p = 0; p < COLOUR_N_PLANES && same; p++) {
+            same = memcmp(&colour_pool[e][p * MAX_COLOUR_ROW_WORDS], &row[p * MAX_COLOUR_ROW_WORDS],
+                          colour_row_words * sizeof(uint32_t)) == 0;
+        }
+        if (same) {
+            free_entry = e;
+            break;
+        }
+    }
+
+    if (free_entry == COLOUR_POOL_SIZE) {
+        free_entry = colour_pool_last;
+    } else if (colour_pool_refs[free_entry] == 0) {
+        memcpy(colour_pool[free_entry], row, sizeof(row));
+    }
+    colour_pool_refs[free_entry]++;
+    colour_pool_last = free_entry;
+    return free_entry;
+}
+
+static inline uint8_t fold_case(uint8_t c) {
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+// One bit for each pair of neighbouring characters in s, case aside, leaving
+// out pairs with a space. A line can only hold the query if it has all of the
+// query's bits.
+static uint64_t line_bigrams(const uint8_t *s, uint n) {
+    uint64_t set = 0;
+    for (uint i = 1; i < n; i++) {
+        uint a = fold_case(s[i - 1]), b = fold_case(s[i]);
+        if (a != ' ' && b != ' ') {
+            set |= 1ull << ((a * 31 + b) & 63);
+        }
+    }
+    return set;
+}
+
+// Copy physical row r of the back buffer into the history, dropping the oldest
+// line once the store is full. A scrolled back view stays on the same text.
+static void history_push(uint r) {
+    history_line_t *line = &history[history_head];
+    if (history_count == history_capacity) {
+        colour_pool_refs[line->colours]--;
+    } else {
+        history_count++;
+    }
+
+    update_row_info(r); // The row may have been written since unlock_back_buffer()
+    memcpy(&history_chars[history_head * char_cols], &screen_back->charbuf[r * char_cols], char_cols);
+    line->info = screen_back->row_info[r];
+    line->info.gfx = 0; // The strip goes back to the pool; the text under it is kept
+    line->colours = colour_pool_add(r);
+    history_index[history_head] = line_bigrams(&history_chars[history_head * char_cols], char_cols);
+
+    history_head = (history_head + 1) % history_capacity;
+    if (view_offset && view_offset < history_count) {
+        view_offset++;
+    }
+    if (search.next) search.next++;
+    if (search.match) search.match++;
+    publish_history_view();
+}
+
+// Move the view by lines (positive is further back), 0 returning to the
+// screen. The history is the first console's.
+static void scroll_view(int lines) {
+    if (shown_console != 0) {
+        return;
+    }
+    int offset = (int)view_offset + lines;
+    if (offset < 0) offset = 0;
+    if (offset > (int)history_count) offset = history_count;
+    view_offset = offset;
+    publish_history_view();
+}
+
+// Scroll the scrolling region (the whole screen unless DECSTBM set one).
+// Only a session that has the whole screen keeps history, as the view
+// scrolls back the whole screen, and of the consoles only the first.
+// Caller holds the back buffer (see lock_back_buffer())
+void scroll_up(void) {
+    if (scroll_top == 0 && pane_rows == char_rows && console == &consoles[0]) {
+        history_push(back_row(0));
+    }
+    rotate_rows_up(scroll_top, scroll_bottom, 1);
+    safe_request_swap();
+}
+
+void new_line(void) {
+    term.cursor_x = 0;
+    
+    if (term.cursor_y == scroll_bottom) {
+        scroll_up();
+    } else if (term.cursor_y + 1 >= pane_rows) {
+        term.cursor_y = pane_rows - 1;
+        if (scroll_bottom == pane_rows - 1) {
+            scroll_up();
+        }
+    } else {
+        term.cursor_y++;
+    }
+    buffer_dirty = true;
+    safe_request_swap(); // Ensure swap after new line
+}
+
+// Draw glyph g at the cursor and move it on
+static void put_glyph(uint8_t g) {
+    vt.last_glyph = g;
+    vt.last_glyph_valid = true;
+    set_char(term.cursor_x, term.cursor_y, g);
+    set_colour(term.cursor_x, term.cursor_y, current_fg, current_bg);
+    set_attr(term.cursor_x, term.cursor_y, current_attr);
+    term.cursor_x++;
+    buffer_dirty = true;
+    if (term.cursor_x >= line_cols(term.cursor_y)) {
+        new_line();
+    }
+}
+
+// REP: glyph g n more times, a span of the row at a time as a printable run
+// is written (at most a screenful, as any more would only scroll it away)
+static void repeat_glyph(uint8_t g, uint n) {
+    n = MIN(n, char_cols * pane_rows);
+    while (n) {
+        uint x = term.cursor_x;
+        uint y = term.cursor_y;
+        if (y >= pane_rows || x >= line_cols(y)) {
+            put_glyph(g);
+            n--;
+            continue;
+        }
+        uint run = MIN(n, line_cols(y) - x);
+        memset(&screen_back->charbuf[x + back_row(y) * char_cols], g, run);
+        set_colour_span(x, y, run, current_fg, current_bg);
+        set_attr_span(x, y, run, current_attr);
+        term.cursor_x += run;
+        n -= run;
+        if (term.cursor_x >= line_cols(y)) {
+            new_line();
+        }
+    }
+    buffer_dirty = true;
+}
+
+// === Fonts ===
+// Switch to font f from the next frame. Caller holds the back buffer.
+static void select_font(uint f) {
+    if (f >= N_FONTS || f == current_font) return;
+    
+    // The table core1 isn't using is free: if an earlier switch is still
+    // waiting for its flip, this one simply replaces it
+    uint8_t *spare = font_scanline == font_ram[0] ? font_ram[1] : font_ram[0];
+    memcpy(spare, fonts[f].scanline, sizeof(font_ram[0]));
+    platform_font_changed(); // Anything built from the old font goes at the same flip
+    font_pending = spare;
+    current_font = f;
+    
+    // Which scanlines are blank depends on the glyphs, so work that out again
+    // for the screen (as the rows are next refreshed) and for the history
+    glyph_blank_lines = fonts[f].blank_lines;
+    mark_all_rows_dirty();
+    for (uint i = 0; i < history_count; i++) {
+        history_line_t *line = &history[i];
+        if (line->info.bg != ROW_BG_MIXED) {
+            line->info.blank_lines = row_blank_lines(&history_chars[i * char_cols]);
+        }
+    }
+    buffer_dirty = true;
+}
+
+// Font named by OSC 50 ("ESC ] 50 ; name BEL"), by name or by number
+static void select_font_by_name(const char *name) {
+    if (name[0] >= '0' && name[0] <= '9') {
+        select_font(atoi(name));
+        return;
+    }
+    for (uint f = 0; f < N_FONTS; f++) {
+        if (strcmp(name, fonts[f].name) == 0) {
+            select_font(f);
+            return;
+        }
+    }
+}
+
+// === UTF-8 ===
+// With UTF-8 on (ESC%G, and UTF8_INPUT by default) bytes from 0x80 up are
+// decoded as they arrive, one at a time so a character can straddle reads,
+// and each character is drawn as the CP437 glyph for it: the glyph itself
+// where the font has one, a near enough stand-in for the rounded, heavy and
+// dashed box drawing and the eighth blocks, or UTF8_REPLACEMENT. With it off
+// (ESC%@) a byte is the glyph, as before. Plain ASCII never gets here.
+#define UTF8_REPLACEMENT 0xFE // A small square
+
+// U+2500 to U+25FF: box drawing, blocks and shapes
+static const uint8_t utf8_box_glyphs[256] = {
+    0xC4, 0xC4, 0xB3, 0xB3, 0xC4, 0xC4, 0xB3, 0xB3, 0xC4, 0xC4, 0xB3, 0xB3, 0xDA, 0x00, 0x00, 0xDA,
+    0xBF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xC0, 0xD9, 0x00, 0x00, 0xD9, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC3, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xC2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xC5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xC4, 0xC4, 0xB3, 0xB3,
+    0xCD, 0xBA, 0xD5, 0xD6, 0xC9, 0xB8, 0xB7, 0xBB, 0xD4, 0xD3, 0xC8, 0xBE, 0xBD, 0xBC, 0xC6, 0xC7,
+    0xCC, 0xB5, 0xB6, 0xB9, 0xD1, 0xD2, 0xCB, 0xCF, 0xD0, 0xCA, 0xD8, 0xD7, 0xCE, 0xDA, 0xBF, 0xD9,
+    0xC0, 0x00, 0x00, 0x00, 0xC4, 0xB3, 0xC4, 0xB3, 0xC4, 0xB3, 0xC4, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0x5F, 0xDC, 0xDC, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDD, 0xDD, 0xDD, 0xDD, 0xB3,
+    0xDE, 0xB0, 0xB1, 0xB2, 0xDF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const struct { uint16_t cp; uint8_t glyph; } utf8_glyphs[] = {
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A5, 0x9D}, {0x00A7, 0x15},
+    {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD},
+    {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC},
+    {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C9, 0x90}, {0x00D1, 0xA5}, {0x00D6, 0x99}, {0x00D7, 0x78}, {0x00DC, 0x9A}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91},
+    {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D},
+    {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2},
+    {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96},
+    {0x00FC, 0x81}, {0x00FF, 0x98}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4},
+    {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3},
+    {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2013, 0x2D}, {0x2014, 0x2D}, {0x2018, 0x27},
+    {0x2019, 0x27}, {0x201C, 0x22}, {0x201D, 0x22}, {0x2022, 0x07}, {0x2026, 0x2E}, {0x2032, 0x27},
+    {0x2039, 0x3C}, {0x203A, 0x3E}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2190, 0x1B},
+    {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17},
+    {0x2212, 0x2D}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2302, 0x7F}, {0x2310, 0xA9},
+    {0x2320, 0xF4}, {0x2321, 0xF5}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C},
+    {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D},
+    {0x266B, 0x0E}, {0x2713, 0xFB},
+};
+#define N_UTF8_GLYPHS (sizeof(utf8_glyphs) / sizeof(utf8_glyphs[0]))
+
+// The glyph for a codepoint: box drawing by table, which is what most of it
+// is (borders, bars and graphs), and anything else by binary search. 0 for
+// a character taking no cell of its own (combining marks, zero width
+// spaces and variation selectors).
+static uint8_t utf8_glyph(uint32_t cp) {
+    if (cp - 0x2500 < 0x100) {
+        uint8_t g = utf8_box_glyphs[cp - 0x2500];
+        return g ? g : UTF8_REPLACEMENT;
+    }
+    if (cp - 0x300 < 0x70 || cp - 0x200B < 5 || cp - 0xFE00 < 0x10) {
+        return 0;
+    }
+    uint lo = 0, hi = N_UTF8_GLYPHS;
+    while (lo < hi) {
+        uint mid = (lo + hi) / 2;
+        if (utf8_glyphs[mid].cp < cp) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < N_UTF8_GLYPHS && utf8_glyphs[lo].cp == cp ? utf8_glyphs[lo].glyph : UTF8_REPLACEMENT;
+}
+
+// Take byte c (0x80 or over) of a character. Returns its glyph once the
+// character is complete, -1 until then or if it takes no cell.
+static int utf8_decode(uint8_t c) {
+    if ((c & 0xC0) == 0x80) {
+        if (!vt.utf8_pending) {
+            return UTF8_REPLACEMENT; // A continuation byte out of place
+        }
+        vt.utf8_codepoint = vt.utf8_codepoint << 6 | (c & 0x3F);
+        if (--vt.utf8_pending) {
+            return -1;
+        }
+        uint8_t g = utf8_glyph(vt.utf8_codepoint);
+        return g ? g : -1;
+    }
+    if (c >= 0xC2 && c <= 0xDF) {
+        vt.utf8_codepoint = c & 0x1F;
+        vt.utf8_pending = 1;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        vt.utf8_codepoint = c & 0x0F;
+        vt.utf8_pending = 2;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        vt.utf8_codepoint = c & 0x07;
+        vt.utf8_pending = 3;
+    } else {
+        vt.utf8_pending = 0;
+        return UTF8_REPLACEMENT; // Overlong or out of range
+    }
+    return -1;
+}
+
+// === Colours ===
+// The 16 ANSI colours, as RGB222: the usual 8, then their bright forms,
+// which are the same here but for bright black
+static const uint8_t ansi_colours[16] = {
+    0,   // black   (0b000000)
+    48,  // red     (0b110000)
+    12,  // green   (0b001100)
+    60,  // yellow  (0b111100)
+    3,   // blue    (0b000011)
+    51,  // magenta (0b110011)
+    15,  // cyan    (0b001111)
+    63,  // white   (0b111111)
+    21,  // bright black (0b010101)
+    48, 12, 60, 3, 51, 15, 63
+};
+
+// xterm's 256 colour palette, each as the nearest colour we have
+static uint8_t xterm_colours[256];
+
+// The level (0-255) a red or green channel is drawn at, from its 2 RGB222
+// bits v and its extension bit. Without the extension it is the RGB222
+// level, and with it the RGB332 level next to that (v doubled, and the low
+// bit the opposite of the top one), giving 8 levels in all:
+//   0 36 85 109 146 170 219 255
+uint colour_level(uint v, bool ext) {
+    if (!ext) return v * 85;
+    uint v3 = (v << 1) | (((v >> 1) & 1) ^ 1);
+    return (v3 * 255 + 3) / 7;
+}
+
+// Nearest colour to a 24-bit one: the nearest of the 8 levels for red and
+// green, and of the 4 RGB222 ones for blue
+static uint8_t colour_from_rgb(uint8_t r, uint8_t g, uint8_t b) {
+    static const struct { uint shift; uint8_t ext_bit; } channels[2] = {
+        {4, COLOUR_EXT_R}, {2, COLOUR_EXT_G},
+    };
+    const uint8_t values[2] = {r, g};
+    uint8_t colour = (b * 3 + 127) / 255;
+    for (int c = 0; c < 2; c++) {
+        uint best = 0, best_dist = ~0u;
+        for (uint level = 0; level < 8; level++) {
+            int d = (int)colour_level(level >> 1, level & 1) - values[c];
+            uint dist = d < 0 ? -d : d;
+            if (dist < best_dist) {
+                best_dist = dist;
+                best = level;
+            }
+        }
+        colour |= (best >> 1) << channels[c].shift;
+        if (best & 1) colour |= channels[c].ext_bit;
+    }
+    return colour;
+}
+
+// Fill in xterm_colours
+static void init_xterm_colours(void) {
+    static const uint8_t cube_levels[6] = {0, 95, 135, 175, 215, 255};
+    for (uint i = 0; i < 16; i++) {
+        xterm_colours[i] = ansi_colours[i];
+    }
+    for (uint i = 16; i < 232; i++) {
+        uint n = i - 16;
+        xterm_colours[i] = colour_from_rgb(cube_levels[n / 36], cube_levels[(n / 6) % 6],
+                                           cube_levels[n % 6]);
+    }
+    for (uint i = 232; i < 256; i++) {
+        uint grey = 8 + 10 * (i - 232);
+        xterm_colours[i] = colour_from_rgb(grey, grey, grey);
+    }
+}
+
+// SGR 38 or 48 (in params[0]) with 5;n (xterm colour n) or 2;r;g;b, setting
+// the foreground or background. Returns how many more parameters it used.
+static uint8_t process_extended_colour(const uint16_t *params, uint8_t count) {
+    uint8_t colour;
+    uint8_t used;
+    if (count >= 3 && params[1] == 5) {
+        colour = xterm_colours[MIN(params[2], 255)];
+        used = 2;
+    } else if (count >= 5 && params[1] == 2) {
+        colour = colour_from_rgb(MIN(params[2], 255), MIN(params[3], 255), MIN(params[4], 255));
+        used = 4;
+    } else {
+        return count - 1; // Can't tell where it ends, so drop the rest
+    }
+    if (params[0] == 38) {
+        current_fg = colour;
+    } else {
+        current_bg = colour;
+    }
+    return used;
+}
+
+// === ANSI Processing ===
+// Map ANSI color codes to 6-bit RGB values
+// (2 bits per component: R, G, B)
+void process_ansi_code(uint16_t param) {
+    if (param == 0) {
+        // Reset: white on black, the default colours the theme shows as its own
+        current_fg = COLOUR_WHITE;
+        current_bg = COLOUR_BLACK;
+        current_attr = 0;
+    } else if (param == 1) {
+        current_attr |= ATTR_BOLD;
+    } else if (param == 4) {
+        current_attr |= ATTR_UNDERLINE;
+    } else if (param == 5) {
+        current_attr |= ATTR_BLINK;
+    } else if (param == 7) {
+        current_attr |= ATTR_REVERSE;
+    } else if (param == 22) {
+        current_attr &= ~ATTR_BOLD;
+    } else if (param == 24) {
+        current_attr &= ~ATTR_UNDERLINE;
+    } else if (param == 25) {
+        current_attr &= ~ATTR_BLINK;
+    } else if (param == 27) {
+        current_attr &= ~ATTR_REVERSE;
+    } else if (param >= 30 && param <= 37) {
+        current_fg = ansi_colours[param - 30];
+    } else if (param == 39) {
+        current_fg = 63;
+    } else if (param >= 40 && param <= 47) {
+        current_bg = ansi_colours[param - 40];
+    } else if (param == 49) {
+        current_bg = 0;
+    } else if (param >= 90 && param <= 97) {
+        current_fg = ansi_colours[8 + param - 90];
+    } else if (param >= 100 && param <= 107) {
+        current_bg = ansi_colours[8 + param - 100];
+    }
+}
+
+// Answer the host of the session being parsed
+static void session_reply(const char *s) {
+    platform_reply(current_session, s, strlen(s));
+}
+
+// DSR and DA: the reports a host can ask for, sent back with
+// platform_reply(). The cursor position is within the session's pane.
+static void report_status(uint16_t param, bool dec) {
+    char reply[24];
+    if (param == 5 && !dec) {
+        session_reply("\x1B[0n"); // OK
+    } else if (param == 6) {
+        snprintf(reply, sizeof(reply), dec ? "\x1B[?%u;%u;1R" : "\x1B[%u;%uR",
+                 term.cursor_y + 1, term.cursor_x + 1);
+        session_reply(reply);
+    }
+}
+
+void process_ansi_sequence(const uint16_t *params, uint8_t count, char final) {
+    switch (final) {
+    case 'n':
+        if (count == 1) {
+            report_status(params[0], false);
+        }
+        break;
+        
+    case 'c': // DA: a VT220 with Sixel graphics and ANSI colour
+        if (count == 0 || params[0] == 0) {
+            session_reply("\x1B[?62;4;22c");
+        }
+        break;
+        
+    case 'J':
+        if (count == 1 && params[0] == 2) {
+            clear_screen();
+        }
+        break;
+        
+    case 'K':
+        if (term.cursor_x < char_cols && term.cursor_y < pane_rows) {
+            memset(&screen_back->charbuf[term.cursor_x + back_row(term.cursor_y) * char_cols], ' ',
+                   char_cols - term.cursor_x);
+            set_colour_span(term.cursor_x, term.cursor_y, char_cols - term.cursor_x,
+                            current_fg, current_bg);
+            set_attr_span(term.cursor_x, term.cursor_y, char_cols - term.cursor_x, 0);
+        }
+        buffer_dirty = true;
+        break;
+        
+    case '@': // ICH: insert blanks at the cursor, pushing the rest of the row right
+    case 'P': // DCH: delete characters at the cursor, pulling the rest left
+        shift_cells(term.cursor_x, term.cursor_y, (count >= 1 && params[0] > 0) ? params[0] : 1,
+                    final == '@');
+        break;
+        
+    case 'X': // ECH: erase characters from the cursor
+        erase_cells(term.cursor_x, term.cursor_y, (count >= 1 && params[0] > 0) ? params[0] : 1);
+        break;
+        
+    case 'b': // REP: the last character printed, again
+        if (vt.last_glyph_valid) {
+            repeat_glyph(vt.last_glyph, (count >= 1 && params[0] > 0) ? params[0] : 1);
+        }
+        break;
+        
+    case 'H': // CUP: stops at the edges, as on a VT100, so ESC[999;999H ESC[6n gives the size
+        if (count >= 1) {
+            term.cursor_y = MIN(params[0] > 0 ? params[0] - 1 : 0, pane_rows - 1);
+        }
+        if (count >= 2) {
+            term.cursor_x = MIN(params[1] > 0 ? params[1] - 1 : 0, line_cols(term.cursor_y) - 1);
+        }
+        break;
+        
+    case 'r': { // DECSTBM: set scrolling region
+        uint top = (count >= 1 && params[0] > 0) ? params[0] - 1 : 0;
+        uint bottom = (count >= 2 && params[1] > 0) ? params[1] - 1 : pane_rows - 1;
+        if (bottom >= pane_rows) bottom = pane_rows - 1;
+        if (top < bottom) {
+            scroll_top = top;
+            scroll_bottom = bottom;
+            term.cursor_x = 0;
+            term.cursor_y = 0;
+        }
+        break;
+    }
+        
+    case 'L': // Insert lines at the cursor, within the scrolling region
+    case 'M': { // Delete lines at the cursor, within the scrolling region
+        uint n = (count >= 1 && params[0] > 0) ? params[0] : 1;
+        if (term.cursor_y >= scroll_top && term.cursor_y <= scroll_bottom) {
+            if (final == 'L') {
+                rotate_rows_down(term.cursor_y, scroll_bottom, n);
+            } else {
+                rotate_rows_up(term.cursor_y, scroll_bottom, n);
+            }
+            term.cursor_x = 0;
+        }
+        break;
+    }
+        
+    case 'm':
+        if (count == 0) {
+            process_ansi_code(0); // ESC[m is the same as ESC[0m
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            if (params[i] == 38 || params[i] == 48) {
+                i += process_extended_colour(&params[i], count - i);
+            } else {
+                process_ansi_code(params[i]);
+            }
+        }
+        break;
+        
+    case 's':
+        saved_cursor_x = term.cursor_x;
+        saved_cursor_y = term.cursor_y;
+        break;
+        
+    case 'u':
+        if (saved_cursor_x != -1 && saved_cursor_y != -1) {
+            term.cursor_x = saved_cursor_x;
+            term.cursor_y = saved_cursor_y;
+        }
+        break;
+        
+        case 'A': { // Cursor Up
+            uint n = (count >= 1 && params[0] > 0) ? params[0] : 1;
+            if (term.cursor_y >= n)
+                term.cursor_y -= n;
+            else
+                term.cursor_y = 0;
+            term.cursor_x = MIN(term.cursor_x, line_cols(term.cursor_y) - 1); // Onto a double width line
+            break;
+        }
+        case 'B': { // Cursor Down
+            uint n = (count >= 1 && params[0] > 0) ? params[0] : 1;
+            if (term.cursor_y + n < pane_rows)
+                term.cursor_y += n;
+            else
+                term.cursor_y = pane_rows - 1;
+            term.cursor_x = MIN(term.cursor_x, line_cols(term.cursor_y) - 1);
+            break;
+        }
+        case 'C': { // Cursor Forward
+            uint n = (count >= 1 && params[0] > 0) ? params[0] : 1;
+            if (term.cursor_x + n < line_cols(term.cursor_y))
+                term.cursor_x += n;
+            else
+                term.cursor_x = line_cols(term.cursor_y) - 1;
+            break;
+        }
+        case 'D': { // Cursor Back
+            uint n = (count >= 1 && params[0] > 0) ? params[0] : 1;
+            if (term.cursor_x >= n)
+                term.cursor_x -= n;
+            else
+                term.cursor_x = 0;
+            break;
+        }
+    }
+}
+
+// === Menu Window ===
+// Open an empty box of cols x rows cells in the window, below the cursor where
+// it fits and otherwise at the bottom of the screen, returning the first row
+// inside it. Cells are then written at window coordinates.
+static uint open_menu(uint cols, uint rows) {
+    menu_window_t *m = &screen_back->menu;
+    rows = MIN(rows, MIN(MENU_ROWS, char_rows));
+    cols = MIN(cols, MENU_COLS);
+    m->left = 1;
+    uint cursor_y = pane_top + term.cursor_y;
+    m->top = cursor_y + rows < char_rows ? cursor_y : char_rows - rows;
+    m->cols = cols;
+    m->rows = rows;
+    m->ext = (current_fg | current_bg) & COLOUR_EXT_BITS;
+    memset(m->chars, ' ', sizeof(m->chars));
+    memset(m->fg, current_fg, sizeof(m->fg));
+    memset(m->bg, current_bg, sizeof(m->bg));
+    
+    m->chars[0][0] = m->chars[0][cols - 1] = '+';
+    m->chars[rows - 1][0] = m->chars[rows - 1][cols - 1] = '+';
+    memset(&m->chars[0][1], '-', cols - 2);
+    memset(&m->chars[rows - 1][1], '-', cols - 2);
+    for (uint y = 1; y < rows - 1; y++) {
+        m->chars[y][0] = m->chars[y][cols - 1] = '|';
+    }
+    return 1;
+}
+
+static void menu_text(uint x, uint y, const char *text) {
+    menu_window_t *m = &screen_back->menu;
+    size_t len = strlen(text);
+    if (y < m->rows && x < m->cols) {
+        memcpy(&m->chars[y][x], text, MIN(len, m->cols - x));
+    }
+}
+
+static void show_menu(void) {
+    screen_back->menu.visible = true;
+    buffer_dirty = true;
+    safe_request_swap();
+}
+
+// === Color Menu ===
+void draw_color_menu(const char *title, const char *prompt) {
+    uint y = open_menu(33, 11);
+    menu_text(1, y, title);
+    
+    // Color grid with two-digit numbers and a sample of each
+    for (uint8_t row = 0; row < 8; row++) {
+        for (uint8_t col = 0; col < 8; col++) {
+            uint8_t color_idx = row * 8 + col;
+            uint x = 1 + col * 4;
+            char num[4];
+            snprintf(num, sizeof(num), "%02d\xDB", color_idx);
+            menu_text(x, y + row + 1, num);
+            for (uint i = 0; i < 3; i++) {
+                screen_back->menu.fg[y + row + 1][x + i] = 63;
+                screen_back->menu.bg[y + row + 1][x + i] = color_idx;
+            }
+        }
+    }
+    
+    menu_text(1, y + 9, prompt);
+    show_menu();
+}
+
+// === Menu System ===
+// Closing a menu just hides the window; the text under it was never touched
+void restore_menu_region(void) {
+    screen_back->menu.visible = false;
+    buffer_dirty = true;
+    safe_request_swap();
+}
+
+// Boxed list of up to MENU_ROWS - 2 lines below the cursor
+void draw_text_menu(const char *const lines[], size_t num_lines) {
+    uint y = open_menu(33, num_lines + 2);
+    for (size_t i = 0; i < num_lines && y + i < screen_back->menu.rows - 1u; i++) {
+        menu_text(1, y + i, lines[i]);
+    }
+    show_menu();
+}
+
+void draw_cursor_menu(void) {
+    static const char *const lines[] = {
+        "Cursor Style Menu:", 
+        "[1] Block        \xDB",
+        "[2] Underline    _",
+        "[3] Bar          |",          
+        "[4] Apple I      @",
+        "[5] Shaded Block \xB2",  
+        "[6] Arrow        >",
+        "Select style: "
+    };
+    draw_text_menu(lines, sizeof(lines) / sizeof(lines[0]));
+}
+
+// === Scrollback Search ===
+// Ctrl+R asks for some text and brings the next line back up the history that
+// holds it, case aside, to the top of the view; Enter (or Ctrl+R) again goes
+// on to the one before. The scan is done a slice at a time by search_step(),
+// between batches of input, so even the whole history holds nothing up.
+static void draw_search_menu(const char *status) {
+    uint y = open_menu(SEARCH_MAX_QUERY + 5, 5);
+    char line[SEARCH_MAX_QUERY + 3];
+    snprintf(line, sizeof(line), ">%s_", search.query);
+    menu_text(1, y, "Search history (Esc closes)");
+    menu_text(1, y + 1, line);
+    menu_text(1, y + 2, status);
+    show_menu();
+}
+
+// The query is somewhere in the n characters at s
+static bool line_contains(const uint8_t *s, uint n) {
+    uint8_t first = fold_case(search.query[0]);
+    for (uint i = 0; i + search.len <= n; i++) {
+        if (fold_case(s[i]) != first) {
+            continue;
+        }
+        uint j = 1;
+        while (j < search.len && fold_case(s[i + j]) == fold_case(search.query[j])) {
+            j++;
+        }
+        if (j == search.len) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// From the line after the last match while the view is still on it, and
+// otherwise from the newest line
+static void start_search(void) {
+    search.bigrams = line_bigrams((const uint8_t *)search.query, search.len);
+    bool again = search.match && search.match == view_offset && search.match <= history_count;
+    search.next = again ? search.match + 1 : 1;
+    search.match = 0;
+    draw_search_menu("Searching...");
+}
+
+bool search_pending(void) {
+    return search.next != 0;
+}
+
+void search_step(void) {
+    if (!search.next) {
+        return;
+    }
+    uint work = 0;
+    while (search.next <= history_count) {
+        if (work >= SEARCH_STEP_BYTES) {
+            return; // The rest next time round
+        }
+        uint line = (history_head + history_capacity - search.next) % history_capacity;
+        work += sizeof(history_index[0]);
+        if ((history_index[line] & search.bigrams) == search.bigrams) {
+            work += char_cols;
+            if (line_contains(&history_chars[line * char_cols], char_cols)) {
+                char status[32];
+                search.match = search.next;
+                search.next = 0;
+                scroll_view((int)search.match - (int)view_offset);
+                snprintf(status, sizeof(status), "Line -%u, Enter for the next", search.match);
+                draw_search_menu(status);
+                return;
+            }
+        }
+        search.next++;
+    }
+    search.next = 0;
+    draw_search_menu("Not found");
+}
+
+// A key while the search menu is up. Only Esc is taken while the scan runs.
+static void search_key(char c) {
+    if (c == '\x1B') {
+        search.next = 0;
+        search_menu_mode = false;
+        restore_menu_region();
+        return;
+    }
+    if (search.next) {
+        return;
+    }
+    if (c == '\r' || c == '\n' || c == '\x12') {
+        // A CR LF is one Enter
+        if (c == '\r') term.skip_next_lf = true;
+        if (c == '\n') term.skip_next_cr = true;
+        if (search.len) {
+            start_search();
+        }
+        return;
+    }
+    if ((c == '\b' || c == '\x7F') && search.len > 0) {
+        search.query[--search.len] = '\0';
+    } else if (c >= ' ' && c < '\x7F' && search.len < SEARCH_MAX_QUERY) {
+        search.query[search.len++] = c;
+        search.query[search.len] = '\0';
+    } else {
+        return;
+    }
+    search.match = 0; // A new query starts again from the newest line
+    draw_search_menu("");
+}
+
+// === Character Handling ===
+// Input is applied in batches: every character in the batch goes through
+// put_char(), then the cursor is published and a single swap is requested.
+// All of these must be called with the back buffer held (see
+// lock_back_buffer()).
+void begin_char_batch(void) {
+    input_active = true;
+    last_input_time = get_absolute_time();
+}
+
+// Carriage return, line feed and backspace, which also act in the middle of
+// an escape sequence
+static void execute_control(char c) {
+    switch (c) {
+    case '\r':
+        new_line();
+        term.skip_next_lf = true;
+        term.suppress_next_cr = true;
+        break;
+    
+    case '\n':
+        new_line();
+        term.skip_next_cr = true;
+        break;
+    
+    case '\b':
+        if (term.cursor_x > 0) {
+            term.cursor_x--;
+            set_char(term.cursor_x, term.cursor_y, ' ');
+            set_colour(term.cursor_x, term.cursor_y, current_fg, current_bg);
+            set_attr(term.cursor_x, term.cursor_y, 0);
+            buffer_dirty = true;
+        }
+        break;
+    }
+}
+
+// === Sixel Graphics ===
+// Images are drawn in 4 grey levels (what tmds_encode_2bpp() encodes), each
+// colour register taking the one nearest its lightness. The image's top left
+// is the cursor cell, and every text row it reaches shows only graphics
+// until the row is cleared or scrolled away. It scrolls the screen when it
+// runs off the bottom, and the cursor ends up at the start of the row below it.
+
+// Grey level of an RGB or HLS lightness in percent
+static uint8_t sixel_level(uint percent) {
+    return (MIN(percent, 100) * 3 + 50) / 100;
+}
+
+static uint8_t colour_grey_level(uint8_t c) {
+    uint r = (c >> 4) & 0x3, g = (c >> 2) & 0x3, b = c & 0x3;
+    return (r * 30 + g * 59 + b * 11 + 50) / 100; // Already 0-3
+}
+
+static uint32_t session_strips(void);
+
+// Take a strip no row of either buffer uses, cleared to level. Returns 1 +
+// the strip, or 0 if they are all in use.
+static uint gfx_alloc_strip(uint8_t level) {
+    uint32_t used = 0;
+    for (int b = 0; b < N_SCREENS; b++) {
+        for (uint r = 0; r < char_rows; r++) {
+            if (screens[b].row_info[r].gfx) used |= 1u << (screens[b].row_info[r].gfx - 1);
+        }
+    }
+    for (uint i = 0; i < GFX_MAX_STRIPS; i++) {
+        if (sixel.strip[i]) used |= 1u << (sixel.strip[i] - 1);
+    }
+    used |= session_strips();
+    for (uint n = 0; n < gfx_n_strips; n++) {
+        if (!(used & (1u << n))) {
+            uint32_t *strip = &gfx_pool[n * gfx_strip_words];
+            uint32_t fill = level * 0x55555555u;
+            for (uint w = 0; w < gfx_strip_words; w++) {
+                strip[w] = fill;
+            }
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+// Whatever the background parameter (P2) asks for, pixels never set are the
+// background colour, as the text under them isn't drawn
+static void sixel_begin(void) {
+    memset(&sixel, 0, sizeof(sixel));
+    memset(sixel.levels, 3, sizeof(sixel.levels));
+    sixel.levels[0] = 0;
+    sixel.active = true;
+    sixel.level = sixel.levels[0];
+    sixel.bg_level = colour_grey_level(current_bg);
+    sixel.top = term.cursor_y;
+    sixel.left = term.cursor_x * FONT_CHAR_WIDTH;
+}
+
+// The line of the strip that image line y falls on, taking the strip (and
+// scrolling the screen up to fit it) the first time its row is reached.
+// NULL if the line is lost: off the top, past the strips, or below the end
+// of a scrolling region.
+static uint32_t *sixel_line(uint y) {
+    uint row = y / FONT_CHAR_HEIGHT;
+    if (row >= GFX_MAX_STRIPS) {
+        return NULL;
+    }
+    if (!sixel.strip[row]) {
+        while (sixel.top + (int)row >= (int)pane_rows) {
+            if (scroll_top != 0 || scroll_bottom != pane_rows - 1) {
+                return NULL;
+            }
+            scroll_up();
+            sixel.top--;
+        }
+        if (sixel.top + (int)row < 0) {
+            return NULL;
+        }
+        sixel.strip[row] = gfx_alloc_strip(sixel.bg_level);
+        if (!sixel.strip[row]) {
+            return NULL;
+        }
+        uint r = back_row(sixel.top + row);
+        screen_back->row_info[r].gfx = sixel.strip[row];
+        mark_row_dirty(r);
+        buffer_dirty = true;
+    } else if (sixel.top + (int)row < 0) {
+        return NULL; // Scrolled off since
+    }
+    return &gfx_pool[(sixel.strip[row] - 1) * gfx_strip_words +
+                     (y % FONT_CHAR_HEIGHT) * (gfx_strip_words / FONT_CHAR_HEIGHT)];
+}
+
+// Draw one sixel (six pixels down, bit 0 at the top) repeat times
+static void sixel_draw(uint bits) {
+    uint repeat = MAX(sixel.repeat, 1);
+    sixel.repeat = 0;
+    uint x = sixel.left + sixel.x;
+    sixel.x += repeat;
+    uint width = char_cols * FONT_CHAR_WIDTH;
+    if (x >= width) {
+        return;
+    }
+    uint end = MIN(x + repeat, width);
+    for (uint i = 0; i < 6; i++) {
+        if (!(bits & (1u << i))) continue;
+        uint32_t *line = sixel_line(sixel.y + i);
+        if (!line) continue;
+        for (uint px = x; px < end; px++) {
+            uint shift = (px % 16) * 2;
+            line[px / 16] = (line[px / 16] & ~(0x3u << shift)) | (uint32_t)sixel.level << shift;
+        }
+    }
+}
+
+// The parameters of # (colour) and " (raster attributes) are gathered like
+// CSI ones and acted on at the first byte that isn't one
+static void sixel_end_params(void) {
+    if (sixel.state == SIXEL_COLOUR && sixel.n_params >= 1) {
+        uint reg = sixel.params[0] % SIXEL_REGISTERS;
+        if (sixel.n_params >= 5) {
+            uint level;
+            if (sixel.params[1] == 1) { // HLS: lightness
+                level = sixel_level(sixel.params[3]);
+            } else { // RGB
+                level = sixel_level((sixel.params[2] * 30 + sixel.params[3] * 59 +
+                                     sixel.params[4] * 11) / 100);
+            }
+            sixel.levels[reg] = level;
+        }
+        sixel.level = sixel.levels[reg];
+    }
+    sixel.state = SIXEL_DATA;
+}
+
+static void sixel_put(char c) {
+    if (sixel.state == SIXEL_REPEAT && c >= '0' && c <= '9') {
+        sixel.repeat = MIN(sixel.repeat * 10 + (c - '0'), 0xFFFFu);
+        return;
+    }
+    if (sixel.state == SIXEL_COLOUR || sixel.state == SIXEL_RASTER) {
+        if (c >= '0' && c <= '9') {
+            if (sixel.n_params <= SIXEL_PARAM_MAX) {
+                uint16_t *p = &sixel.params[sixel.n_params - 1];
+                *p = *p < 6553 ? *p * 10 + (c - '0') : UINT16_MAX;
+            }
+            return;
+        }
+        if (c == ';') {
+            if (sixel.n_params < SIXEL_PARAM_MAX) {
+                sixel.params[sixel.n_params] = 0;
+            }
+            if (sixel.n_params <= SIXEL_PARAM_MAX) {
+                sixel.n_params++;
+            }
+            return;
+        }
+        sixel_end_params();
+    }
+    sixel.state = SIXEL_DATA;
+    
+    if (c >= '?' && c <= '~') {
+        sixel_draw(c - '?');
+        return;
+    }
+    switch (c) {
+    case '!':
+        sixel.state = SIXEL_REPEAT;
+        sixel.repeat = 0;
+        break;
+    case '#':
+    case '"':
+        sixel.state = c == '#' ? SIXEL_COLOUR : SIXEL_RASTER;
+        sixel.n_params = 1;
+        sixel.params[0] = 0;
+        break;
+    case '$': // Back to the start of the band
+        sixel.x = 0;
+        break;
+    case '-': // Next band
+        sixel.x = 0;
+        sixel.y += 6;
+        break;
+    }
+}
+
+static void sixel_end(void) {
+    if (sixel.state == SIXEL_COLOUR || sixel.state == SIXEL_RASTER) {
+        sixel_end_params();
+    }
+    sixel.active = false;
+    
+    // The cursor goes below the last text row drawn on
+    int last = -1;
+    for (int i = GFX_MAX_STRIPS - 1; i >= 0 && last < 0; i--) {
+        if (sixel.strip[i]) last = i;
+    }
+    memset(sixel.strip, 0, sizeof(sixel.strip));
+    if (last < 0) {
+        return;
+    }
+    int row = sixel.top + last;
+    term.cursor_y = row < 0 ? 0 : row;
+    new_line();
+}
+
+// === Bulk Screen Updates ===
+// ESC P ?9002;row;col;count;flags b starts a block of count cells from row,
+// col (1-based, as CUP), continuing row after row. The payload follows as raw
+// bytes, which the parser never sees:
+//   count characters
+//   for the blue, green and red planes, then the attribute plane if flags has
+//   BULK_ATTRS and the extension plane if it has BULK_EXT: a nibble per cell,
+//   the first in the low half of each byte, as in colourbuf (bits 1:0
+//   foreground, 3:2 background)
+//   with BULK_CRC, the CRC-16/XMODEM of all of that, high byte first
+// and then ST. Everything goes straight into the back buffer as it arrives,
+// a run at a time, so a full screen costs a few memcpys rather than a pass
+// through the parser per byte. The console's flips are held from the start
+// of the block to its end, so it goes on screen in one, and if the CRC
+// doesn't match, the rows written are put back as they are on screen.
+//
+// A block of more cells than there are from row, col to the end of the pane
+// is refused: its payload, whose length the count and flags give, is taken
+// and dropped up to the ST, so none of it reaches the parser. One whose host sends nothing more of it for BULK_TIMEOUT_US is given up
+// (see bulk_live()): its rows are put back as for a bad CRC and what follows
+// is parsed as usual, so a host that dies part way can't freeze the screen or
+// eat the shell output after it. Both count in bulk_rejected.
+//
+// With BULK_DELTA each of the characters and the planes is sent instead as
+// the XOR of the new bytes with those in the buffer, run-length coded: a
+// byte 0x00-0x7F is followed by that many plus one bytes to XOR in place,
+// and a byte 0x80-0xFF skips that many less 0x7F bytes, which stay as they
+// are. Runs stop at the end of each part. A dashboard changing a few dozen
+// cells costs a few hundred bytes a frame rather than the whole screen, and
+// the CRC is of the coded bytes, as sent.
+#define BULK_CRC   0x1
+#define BULK_ATTRS 0x2
+#define BULK_EXT   0x4
+#define BULK_DELTA 0x8
+#define BULK_TIMEOUT_US (1000 * 1000)
+
+typedef struct {
+    bool active;
+    bool discard;    // Refused: the payload is taken as usual and dropped
+    uint8_t flags;
+    uint8_t phase;   // 0 for the characters, 1 to n_planes for the planes, then the CRC
+    uint8_t n_planes;
+    uint8_t planes[COLOUR_N_PLANES];
+    uint start;      // First cell, row-major
+    uint count;      // Cells
+    uint done;       // Bytes of this phase taken so far
+    uint run;        // BULK_DELTA: bytes left to XOR in the current run
+    uint16_t crc;
+    uint16_t crc_sent;
+    uint32_t last_us; // When the last of the payload came
+    uint32_t rows[DIRTY_MAP_WORDS]; // Physical rows written
+} bulk_update_t;
+
+static bulk_update_t bulk;
+
+static uint16_t crc16_update(uint16_t crc, const uint8_t *buf, size_t n) {
+    static const uint16_t nibble_crc[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    };
+    for (size_t i = 0; i < n; i++) {
+        crc = (crc << 4) ^ nibble_crc[(crc >> 12) ^ (buf[i] >> 4)];
+        crc = (crc << 4) ^ nibble_crc[(crc >> 12) ^ (buf[i] & 0xF)];
+    }
+    return crc;
+}
+
+static void bulk_begin(uint row, uint col, uint count, uint flags) {
+    memset(&bulk, 0, sizeof(bulk));
+    uint cells = pane_rows * char_cols;
+    uint start = (MAX(row, 1) - 1) * char_cols + MIN(MAX(col, 1) - 1, char_cols - 1);
+    if (start >= cells || count > cells - start) {
+        stats.bulk_rejected++;
+        bulk.discard = true;
+        start = 0;
+    }
+    bulk.flags = flags;
+    bulk.start = start;
+    bulk.count = count;
+    bulk.last_us = time_us_32();
+    for (uint p = 0; p < 3; p++) {
+        bulk.planes[bulk.n_planes++] = p;
+    }
+    if (flags & BULK_ATTRS) bulk.planes[bulk.n_planes++] = ATTR_PLANE;
+    if (flags & BULK_EXT) bulk.planes[bulk.n_planes++] = EXT_PLANE;
+    bulk.active = count != 0;
+    console->bulk_blocks += bulk.active && !bulk.discard;
+}
+
+// The physical row of the back buffer holding cell, or -1 past the screen
+static int bulk_row(uint cell) {
+    uint y = cell / char_cols;
+    if (y >= pane_rows) {
+        return -1;
+    }
+    uint r = back_row(y);
+    bulk.rows[r / 32] |= 1u << (r % 32);
+    screen_back->row_info[r].gfx = 0; // Text replaces any Sixel image on the row
+    mark_row_dirty(r);
+    return r;
+}
+
+static void xor_bytes(uint8_t *dst, const uint8_t *src, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] ^= src[i];
+    }
+}
+
+static void bulk_put_chars(const uint8_t *src, size_t n, bool delta) {
+    uint cell = bulk.start + bulk.done;
+    while (n) {
+        int r = bulk_row(cell);
+        if (r < 0) return;
+        uint x = cell % char_cols;
+        size_t run = MIN(n, char_cols - x);
+        uint8_t *dst = (uint8_t *)&screen_back->charbuf[r * char_cols + x];
+        if (delta) {
+            xor_bytes(dst, src, run);
+        } else {
+            memcpy(dst, src, run);
+        }
+        src += run;
+        cell += run;
+        n -= run;
+    }
+}
+
+static void bulk_set_nibble(uint plane, uint cell, uint nibble, bool delta) {
+    if (cell >= bulk.start + bulk.count) return; // The spare half of an odd count's last byte
+    int r = bulk_row(cell);
+    if (r < 0) return;
+    uint x = cell % char_cols;
+    uint32_t *word = &screen_back->colourbuf[plane * colour_plane_words + r * colour_row_words + x / 8];
+    uint shift = (x % 8) * 4;
+    uint32_t keep = delta ? 0xFFFFFFFFu : ~(0xFu << shift);
+    *word = (*word & keep) ^ (uint32_t)nibble << shift;
+}
+
+// Whole bytes go straight into the plane when their two cells are the two
+// halves of a byte there (the buffers are little-endian on both targets)
+static void bulk_put_nibbles(uint plane, const uint8_t *src, size_t n, bool delta) {
+    uint cell = bulk.start + 2 * bulk.done;
+    while (n) {
+        uint x = cell % char_cols;
+        size_t run = MIN(n, (char_cols - x) / 2);
+        if (x % 2 == 0 && run && cell + 2 * run <= bulk.start + bulk.count) {
+            int r = bulk_row(cell);
+            if (r < 0) return;
+            uint8_t *row = (uint8_t *)&screen_back->colourbuf[plane * colour_plane_words + r * colour_row_words];
+            if (delta) {
+                xor_bytes(&row[x / 2], src, run);
+            } else {
+                memcpy(&row[x / 2], src, run);
+            }
+        } else {
+            run = 1;
+            bulk_set_nibble(plane, cell, src[0] & 0xF, delta);
+            bulk_set_nibble(plane, cell + 1, src[0] >> 4, delta);
+        }
+        src += run;
+        cell += 2 * run;
+        n -= run;
+    }
+}
+
+// Copy the rows written back from the front buffer, as lock_back_buffer()
+// resyncs them. perform_swap() won't flip while a block comes in, so the
+// front buffer has the rows as they were on screen before it, and neither a
+// flip nor the resync after one can have put any of the block there. Anything
+// else written to them since the last flip goes too. A console not on screen
+// has no front buffer of its own, so the block stays there.
+static void bulk_restore_rows(void) {
+    if (console != &consoles[shown_console]) {
+        return;
+    }
+    for (uint w = 0; w < DIRTY_MAP_WORDS; w++) {
+        uint32_t bits = bulk.rows[w];
+        while (bits) {
+            uint r = w * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            memcpy(&screen_back->charbuf[r * char_cols], &screen_front->charbuf[r * char_cols], char_cols);
+            for (int p = 0; p < COLOUR_N_PLANES; p++) {
+                uint word = p * colour_plane_words + r * colour_row_words;
+                memcpy(&screen_back->colourbuf[word], &screen_front->colourbuf[word],
+                       colour_row_words * sizeof(uint32_t));
+            }
+            screen_back->row_info[r].gfx = screen_front->row_info[r].gfx;
+        }
+    }
+}
+
+static void bulk_finish(void) {
+    bulk.active = false;
+    if (bulk.discard) {
+        return;
+    }
+    console->bulk_blocks--;
+    if ((bulk.flags & BULK_CRC) && bulk.crc != bulk.crc_sent) {
+        bulk_restore_rows();
+        stats.bulk_crc_errors++;
+    }
+    buffer_dirty = true;
+}
+
+// Take up to n bytes of the payload, returning how many were taken
+static size_t bulk_put(const uint8_t *buf, size_t n) {
+    size_t used = 0;
+    uint crc_phase = 1 + bulk.n_planes;
+    bulk.last_us = time_us_32();
+    while (used < n && bulk.active) {
+        size_t size = bulk.phase == 0 ? bulk.count :
+                      bulk.phase < crc_phase ? (bulk.count + 1) / 2 : 2;
+        const uint8_t *src = &buf[used];
+        bool delta = (bulk.flags & BULK_DELTA) && bulk.phase < crc_phase;
+        if (delta && bulk.run == 0) {
+            // A run's header: XOR the next bytes, or skip over unchanged ones
+            uint8_t op = *src;
+            if (bulk.flags & BULK_CRC) {
+                bulk.crc = crc16_update(bulk.crc, src, 1);
+            }
+            used++;
+            if (op < 0x80) {
+                bulk.run = op + 1;
+                continue;
+            }
+            bulk.done = MIN(bulk.done + op - 0x7F, size);
+        } else {
+            size_t take = MIN(n - used, size - bulk.done);
+            if (delta) {
+                take = MIN(take, bulk.run);
+                bulk.run -= take;
+            }
+            if (bulk.discard) {
+                // Refused (see bulk_begin())
+            } else if (bulk.phase == 0) {
+                bulk_put_chars(src, take, delta);
+            } else if (bulk.phase < crc_phase) {
+                bulk_put_nibbles(bulk.planes[bulk.phase - 1], src, take, delta);
+            } else {
+                for (size_t i = 0; i < take; i++) {
+                    bulk.crc_sent = (bulk.crc_sent << 8) | src[i];
+                }
+            }
+            if (bulk.phase < crc_phase && (bulk.flags & BULK_CRC)) {
+                bulk.crc = crc16_update(bulk.crc, src, take);
+            }
+            used += take;
+            bulk.done += take;
+        }
+        if (bulk.done == size) {
+            bulk.done = 0;
+            bulk.run = 0;
+            bulk.phase++;
+            if (bulk.phase == crc_phase + ((bulk.flags & BULK_CRC) ? 1 : 0)) {
+                bulk_finish();
+            }
+        }
+    }
+    return used;
+}
+
+// === Escape Sequence Parser ===
+// The state machine of Paul Williams' parser for DEC/VT500 compatible
+// terminals (vt100.net/emu/dec_ansi_parser). Each byte is one lookup in
+// vt_table for an action and the next state, so every byte costs the same,
+// and a sequence we don't implement is still consumed to its end instead of
+// being printed. GROUND is put_char()'s own switch (and put_printable_run()),
+// which hands only ESC over, so that is all its row has. 0x80-0x9F are CP437 glyphs
+// here rather than C1 controls, and other bytes above 0x7F inside a sequence
+// are dropped (or kept, in an OSC string).
+enum vt_state {
+    VT_GROUND,
+    VT_ESCAPE,
+    VT_ESCAPE_INTERMEDIATE,
+    VT_CSI_ENTRY,
+    VT_CSI_PARAM,
+    VT_CSI_INTERMEDIATE,
+    VT_CSI_IGNORE,
+    VT_OSC_STRING,
+    VT_DCS_ENTRY,
+    VT_DCS_PARAM,
+    VT_DCS_INTERMEDIATE,
+    VT_DCS_PASSTHROUGH, // Data of the DCS hooked by vt_dcs_hook(), if any
+    VT_DCS_IGNORE,
+    VT_SOS_PM_APC_STRING,
+    VT_N_STATES,
+    VT_SAME = 0xF, // Stay in the current state, without its exit and entry actions
+};
+
+enum vt_action {
+    VT_NONE,
+    VT_EXECUTE,
+    VT_COLLECT,
+    VT_PARAM,
+    VT_ESC_DISPATCH,
+    VT_CSI_DISPATCH,
+    VT_OSC_PUT,
+    VT_DCS_HOOK,
+    VT_DCS_PUT,
+};
+
+// Table entries: the action in the high nibble, the next state in the low one
+#define VT(action, state) ((action) << 4 | (state))
+#define VT_IGNORE VT(VT_NONE, VT_SAME)
+
+// The C0 controls other than CAN, SUB and ESC, which do the same from every state
+#define VT_C0(entry) [0x00 ... 0x17] = (entry), [0x19] = (entry), [0x1C ... 0x1F] = (entry)
+#define VT_ANYWHERE \
+    [0x18] = VT(VT_NONE, VT_GROUND), [0x1A] = VT(VT_NONE, VT_GROUND), [0x1B] = VT(VT_NONE, VT_ESCAPE)
+
+static const uint8_t vt_table[VT_N_STATES][0x80] = {
+    [VT_GROUND] = { VT_ANYWHERE },
+    [VT_ESCAPE] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_ESCAPE_INTERMEDIATE),
+        [0x30 ... 0x4F] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        ['P'] = VT(VT_NONE, VT_DCS_ENTRY),
+        [0x51 ... 0x57] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        ['X'] = VT(VT_NONE, VT_SOS_PM_APC_STRING),
+        [0x59 ... 0x5A] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        ['['] = VT(VT_NONE, VT_CSI_ENTRY),
+        ['\\'] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        [']'] = VT(VT_NONE, VT_OSC_STRING),
+        ['^' ... '_'] = VT(VT_NONE, VT_SOS_PM_APC_STRING),
+        [0x60 ... 0x7E] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_ESCAPE_INTERMEDIATE] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_SAME),
+        [0x30 ... 0x7E] = VT(VT_ESC_DISPATCH, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_CSI_ENTRY] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_CSI_INTERMEDIATE),
+        [0x30 ... 0x39] = VT(VT_PARAM, VT_CSI_PARAM),
+        [':'] = VT(VT_NONE, VT_CSI_IGNORE),
+        [';'] = VT(VT_PARAM, VT_CSI_PARAM),
+        [0x3C ... 0x3F] = VT(VT_COLLECT, VT_CSI_PARAM),
+        [0x40 ... 0x7E] = VT(VT_CSI_DISPATCH, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_CSI_PARAM] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_CSI_INTERMEDIATE),
+        [0x30 ... 0x39] = VT(VT_PARAM, VT_SAME),
+        [':'] = VT(VT_NONE, VT_CSI_IGNORE),
+        [';'] = VT(VT_PARAM, VT_SAME),
+        [0x3C ... 0x3F] = VT(VT_NONE, VT_CSI_IGNORE),
+        [0x40 ... 0x7E] = VT(VT_CSI_DISPATCH, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_CSI_INTERMEDIATE] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_SAME),
+        [0x30 ... 0x3F] = VT(VT_NONE, VT_CSI_IGNORE),
+        [0x40 ... 0x7E] = VT(VT_CSI_DISPATCH, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_CSI_IGNORE] = {
+        VT_C0(VT(VT_EXECUTE, VT_SAME)), VT_ANYWHERE,
+        [0x20 ... 0x3F] = VT_IGNORE,
+        [0x40 ... 0x7E] = VT(VT_NONE, VT_GROUND),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_OSC_STRING] = {
+        [0x00 ... 0x06] = VT_IGNORE, [0x08 ... 0x17] = VT_IGNORE, [0x19] = VT_IGNORE,
+        [0x1C ... 0x1F] = VT_IGNORE, VT_ANYWHERE,
+        ['\a'] = VT(VT_NONE, VT_GROUND), // xterm's terminator, as well as ST
+        [0x20 ... 0x7F] = VT(VT_OSC_PUT, VT_SAME),
+    },
+    [VT_DCS_ENTRY] = {
+        VT_C0(VT_IGNORE), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_DCS_INTERMEDIATE),
+        [0x30 ... 0x39] = VT(VT_PARAM, VT_DCS_PARAM),
+        [':'] = VT(VT_NONE, VT_DCS_IGNORE),
+        [';'] = VT(VT_PARAM, VT_DCS_PARAM),
+        [0x3C ... 0x3F] = VT(VT_COLLECT, VT_DCS_PARAM),
+        [0x40 ... 0x7E] = VT(VT_DCS_HOOK, VT_DCS_PASSTHROUGH),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_DCS_PARAM] = {
+        VT_C0(VT_IGNORE), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_DCS_INTERMEDIATE),
+        [0x30 ... 0x39] = VT(VT_PARAM, VT_SAME),
+        [':'] = VT(VT_NONE, VT_DCS_IGNORE),
+        [';'] = VT(VT_PARAM, VT_SAME),
+        [0x3C ... 0x3F] = VT(VT_NONE, VT_DCS_IGNORE),
+        [0x40 ... 0x7E] = VT(VT_DCS_HOOK, VT_DCS_PASSTHROUGH),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_DCS_INTERMEDIATE] = {
+        VT_C0(VT_IGNORE), VT_ANYWHERE,
+        [0x20 ... 0x2F] = VT(VT_COLLECT, VT_SAME),
+        [0x30 ... 0x3F] = VT(VT_NONE, VT_DCS_IGNORE),
+        [0x40 ... 0x7E] = VT(VT_DCS_HOOK, VT_DCS_PASSTHROUGH),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_DCS_PASSTHROUGH] = {
+        VT_C0(VT_IGNORE), VT_ANYWHERE,
+        [0x20 ... 0x7E] = VT(VT_DCS_PUT, VT_SAME),
+        [0x7F] = VT_IGNORE,
+    },
+    [VT_DCS_IGNORE] = { VT_C0(VT_IGNORE), VT_ANYWHERE, [0x20 ... 0x7F] = VT_IGNORE },
+    [VT_SOS_PM_APC_STRING] = { VT_C0(VT_IGNORE), VT_ANYWHERE, [0x20 ... 0x7F] = VT_IGNORE },
+};
+
+static void vt_clear(void) {
+    vt.n_params = 0;
+    vt.params[0] = 0;
+    vt.n_intermediates = 0;
+    vt.private_marker = 0;
+    vt.overflow = false;
+}
+
+// A parameter digit or separator. Values are accumulated as they arrive,
+// saturating at 65535, and parameters past ANSI_PARAM_MAX are counted but
+// not kept.
+static void vt_param(char c) {
+    if (vt.n_params == 0) {
+        vt.n_params = 1;
+    }
+    if (c == ';') {
+        if (vt.n_params < ANSI_PARAM_MAX) {
+            vt.params[vt.n_params] = 0;
+        }
+        if (vt.n_params < 255) {
+            vt.n_params++;
+        }
+    } else if (vt.n_params <= ANSI_PARAM_MAX) {
+        uint16_t *p = &vt.params[vt.n_params - 1];
+        *p = *p < 6553 ? *p * 10 + (c - '0') : UINT16_MAX;
+    }
+}
+
+static void vt_collect(char c) {
+    if (c >= 0x3C) {
+        vt.private_marker = c; // Only collected straight after CSI or DCS
+    } else if (vt.n_intermediates < ANSI_INTERMEDIATE_MAX) {
+        vt.intermediates[vt.n_intermediates++] = c;
+    } else {
+        vt.overflow = true;
+    }
+}
+
+// ESC#3 to ESC#6: the size of the cursor's line, which the renderer draws
+// from the same cells. DECALN (ESC#8) isn't implemented.
+static void set_line_size(char final) {
+    uint8_t size;
+    switch (final) {
+    case '3': size = LINE_DOUBLE_TOP; break;
+    case '4': size = LINE_DOUBLE_BOTTOM; break;
+    case '5': size = LINE_SINGLE; break;
+    case '6': size = LINE_DOUBLE_WIDTH; break;
+    default: return;
+    }
+    if (term.cursor_y >= pane_rows) {
+        return;
+    }
+    uint r = back_row(term.cursor_y);
+    if (screen_back->row_info[r].size != size) {
+        screen_back->row_info[r].size = size;
+        mark_row_dirty(r);
+        buffer_dirty = true;
+    }
+    if (term.cursor_x >= line_cols(term.cursor_y)) {
+        term.cursor_x = line_cols(term.cursor_y) - 1;
+    }
+}
+
+static void vt_esc_dispatch(char final) {
+    if (!vt.overflow && vt.n_intermediates == 1 && vt.intermediates[0] == '#') {
+        set_line_size(final);
+        return;
+    }
+    if (!vt.overflow && vt.n_intermediates == 1 && vt.intermediates[0] == '%') {
+        if (final == 'G' || final == '@') { // UTF-8 and back to single bytes
+            vt.utf8 = final == 'G';
+            vt.utf8_pending = 0;
+        }
+        return;
+    }
+    if (vt.overflow || vt.n_intermediates != 0) {
+        return; // Character set designations and the like
+    }
+    switch (final) {
+    case 'M':
+        // Reverse index: up a line, scrolling the region down at its top
+        if (term.cursor_y == scroll_top) {
+            rotate_rows_down(scroll_top, scroll_bottom, 1);
+        } else if (term.cursor_y > 0) {
+            term.cursor_y--;
+        }
+        break;
+    case '7': // DECSC, as ESC[s
+        saved_cursor_x = term.cursor_x;
+        saved_cursor_y = term.cursor_y;
+        break;
+    case '8': // DECRC, as ESC[u
+        if (saved_cursor_x != -1 && saved_cursor_y != -1) {
+            term.cursor_x = saved_cursor_x;
+            term.cursor_y = saved_cursor_y;
+        }
+        break;
+    }
+}
+
+// DEC private modes (ESC[?...h and l): reverse video (DECSCNM) and the
+// cursor's visibility (DECTCEM)
+static void process_dec_private_mode(const uint16_t *params, uint8_t count, char final) {
+    if (final != 'h' && final != 'l') {
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (params[i] == 5) {
+            set_palette(display_palette.fg, display_palette.bg, final == 'h');
+        } else if (params[i] == 25) {
+            term.cursor_visible = final == 'h';
+        }
+    }
+}
+
+// ESC[?9001;slot;image;x;y n: show image in an overlay slot with its top
+// left at pixel x, y (image 0 hides the slot). Goes out with the next flip.
+static void set_overlay_sprite(uint slot, uint image, uint x, uint y) {
+    if (slot >= OVERLAY_SPRITES || image > 0xFF) {
+        return;
+    }
+    overlay_sprite_t *sp = &screen_back->overlay.sprite[slot];
+    if (sp->image != image || sp->x != x || sp->y != y) {
+        *sp = (overlay_sprite_t){.x = x, .y = y, .image = image};
+        buffer_dirty = true;
+    }
+}
+
+static void vt_csi_dispatch(char final) {
+    uint8_t count = MIN(vt.n_params, ANSI_PARAM_MAX);
+    if (vt.overflow || vt.n_intermediates != 0) {
+        return;
+    }
+    if (vt.private_marker == 0) {
+        process_ansi_sequence(vt.params, count, final);
+    } else if (vt.private_marker == '?' && final == 'n') {
+        if (count == 1 && vt.params[0] == STATS_QUERY) {
+            platform_report_stats(current_session);
+        } else if (count == 2 && vt.params[0] == CAPTURE_LOG_QUERY) {
+            platform_capture_log(vt.params[1]);
+        } else if (count == 1) {
+            report_status(vt.params[0], true);
+        } else if (count == 5 && vt.params[0] == OVERLAY_SET) {
+            set_overlay_sprite(vt.params[1], vt.params[2], vt.params[3], vt.params[4]);
+        }
+    } else if (vt.private_marker == '?') {
+        process_dec_private_mode(vt.params, count, final);
+    } else if (vt.private_marker == '>' && final == 'c' && (count == 0 || vt.params[0] == 0)) {
+        session_reply("\x1B[>1;10;0c"); // Secondary DA: a VT220, firmware 1.0
+    }
+}
+
+// DCS q is Sixel and DCS ?9002 b a bulk update; any other DCS is consumed
+// and dropped
+static void vt_dcs_hook(char final) {
+    if (vt.n_intermediates != 0 || vt.overflow) {
+        return;
+    }
+    if (final == 'q' && vt.private_marker == 0) {
+        sixel_begin();
+    } else if (final == 'b' && vt.private_marker == '?' && vt.n_params == 5 &&
+               vt.params[0] == BULK_UPDATE) {
+        bulk_begin(vt.params[1], vt.params[2], vt.params[3], vt.params[4]);
+    }
+}
+
+static void vt_dcs_unhook(void) {
+    if (sixel.active) {
+        sixel_end();
+    }
+}
+
+static void bulk_abort(void) {
+    bulk.active = false;
+    vt.state = VT_GROUND;
+    if (bulk.discard) {
+        return; // Counted when it was refused
+    }
+    console->bulk_blocks--;
+    bulk_restore_rows();
+    stats.bulk_rejected++;
+    buffer_dirty = true;
+}
+
+// Whether a bulk update is coming in, after giving up on one the host has
+// sent nothing more of for BULK_TIMEOUT_US
+static bool bulk_live(void) {
+    if (bulk.active && time_us_32() - bulk.last_us > BULK_TIMEOUT_US) {
+        bulk_abort();
+    }
+    return bulk.active;
+}
+
+static void vt_osc_end(void) {
+    osc_buffer[osc_len] = '\0';
+    if (strncmp(osc_buffer, "50;", 3) == 0) {
+        select_font_by_name(osc_buffer + 3);
+    }
+}
+
+// Feed one byte to the parser: the exit action of the state being left, then
+// the transition's action, then the entry action of the new state
+static void vt_advance(uint8_t c) {
+    uint8_t entry;
+    if (c < 0x80) {
+        entry = vt_table[vt.state][c];
+    } else {
+        entry = vt.state == VT_OSC_STRING ? VT(VT_OSC_PUT, VT_SAME) : VT_IGNORE;
+    }
+    uint next = entry & 0xF;
+    
+    if (next != VT_SAME && vt.state == VT_OSC_STRING) {
+        vt_osc_end();
+    } else if (next != VT_SAME && vt.state == VT_DCS_PASSTHROUGH) {
+        vt_dcs_unhook();
+    }
+    
+    switch (entry >> 4) {
+    case VT_EXECUTE: execute_control(c); break;
+    case VT_COLLECT: vt_collect(c); break;
+    case VT_PARAM: vt_param(c); break;
+    case VT_ESC_DISPATCH: vt_esc_dispatch(c); break;
+    case VT_CSI_DISPATCH: vt_csi_dispatch(c); break;
+    case VT_OSC_PUT:
+        if (osc_len < sizeof(osc_buffer) - 1) {
+            osc_buffer[osc_len++] = c;
+        }
+        break;
+    case VT_DCS_HOOK: vt_dcs_hook(c); break;
+    case VT_DCS_PUT:
+        if (sixel.active) {
+            sixel_put(c);
+        }
+        break;
+    }
+    
+    if (next != VT_SAME) {
+        vt.state = next;
+        switch (next) {
+        case VT_ESCAPE:
+        case VT_CSI_ENTRY:
+        case VT_DCS_ENTRY:
+            vt_clear();
+            break;
+        case VT_OSC_STRING:
+            osc_len = 0;
+            break;
+        }
+    }
+}
+
+static void put_char(char c) {
+    if (bulk_live()) {
+        bulk_put((const uint8_t *)&c, 1);
+        return;
+    }
+
+    // 1. First handle BASIC echo suppression
+    if (term.suppress_next_cr && c == '\r') {
+        term.suppress_next_cr = false;
+        #ifdef DEBUG
+        printf("Suppressed BASIC echo CR\n");
+        #endif
+        return;
+    }
+    term.suppress_next_cr = false;  // Reset if not matched
+    
+
+    if (term.skip_next_lf && c == '\n') {
+        term.skip_next_lf = false;
+        return;
+    }
+    if (term.skip_next_cr && c == '\r') {
+        term.skip_next_cr = false;
+        return;
+    }
+
+    // Reset skip flags if we get any non-matching character
+    if (term.skip_next_lf && c != '\n') {
+        term.skip_next_lf = false;  // Reset if next char isn't LF
+    }
+    if (term.skip_next_cr && c != '\r') {
+        term.skip_next_cr = false;  // Reset if next char isn't CR
+    }
+    
+    if (vt.state != VT_GROUND) {
+        vt_advance(c);
+        return;
+    }
+    
+    if (fg_color_menu_mode) {
+        if (c >= '0' && c <= '9' && color_menu_buf_len < 2) {
+            color_menu_buf[color_menu_buf_len++] = c;
+            if (color_menu_buf_len == 2) {
+                // Convert to number and set foreground color
+                uint8_t color_num = (color_menu_buf[0] - '0') * 10 + (color_menu_buf[1] - '0');
+                if (color_num < 64) {
+                    current_fg = color_num;
+                }
+                restore_menu_region();
+                fg_color_menu_mode = false;
+                color_menu_buf_len = 0;
+            }
+        } else if (c == '\b' && color_menu_buf_len > 0) {
+            // Handle backspace
+            color_menu_buf_len--;
+        } else if (c == '\x1B') {
+            // ESC pressed - cancel menu
+            restore_menu_region();
+            fg_color_menu_mode = false;
+            color_menu_buf_len = 0;
+        }
+        return;
+    }
+    if (bg_color_menu_mode) {
+        if (c >= '0' && c <= '9' && color_menu_buf_len < 2) {
+            color_menu_buf[color_menu_buf_len++] = c;
+            if (color_menu_buf_len == 2) {
+                // Convert to number and set background color
+                uint8_t color_num = (color_menu_buf[0] - '0') * 10 + (color_menu_buf[1] - '0');
+                if (color_num < 64) {
+                    current_bg = color_num;
+                }
+                restore_menu_region();
+                bg_color_menu_mode = false;
+                color_menu_buf_len = 0;
+            }
+        } else if (c == '\b' && color_menu_buf_len > 0) {
+            // Handle backspace
+            color_menu_buf_len--;
+        } else if (c == '\x1B') {
+            // ESC pressed - cancel menu
+            restore_menu_region();
+            bg_color_menu_mode = false;
+            color_menu_buf_len = 0;
+        }
+        return;
+    }
+    if (search_menu_mode) {
+        search_key(c);
+        return;
+    }
+    
+    if (cursor_menu_mode) {
+        switch (c) {
+        case '1': current_cursor = CURSOR__SOLID_BLOCK; break;
+        case '2': current_cursor = CURSOR_UNDERLINE; break;
+        case '3': current_cursor = CURSOR_BAR; break;
+        case '4': current_cursor = CURSOR_APPLE_I; break;
+        case '5': current_cursor = CURSOR_SHADED_BLOCK; break;
+        case '6': current_cursor = CURSOR__SOLID_ARROW; break; // Default to solid block
+        default: return;
+        }
+        cursor_menu_mode = false;
+        restore_menu_region();
+        term.cursor_visible = true;
+        return;
+    }
+    
+    if (mode_menu_mode) {
+        if (c >= '1' && c <= '9') {
+            if (!platform_select_display_mode(c - '1')) {
+                return;
+            }
+        } else if (c != '\x1B') {
+            return;
+        }
+        mode_menu_mode = false;
+        restore_menu_region();
+        return;
+    }
+    
+    if (theme_select_mode) {
+        // The theme recolours everything in the default colours, already on
+        // the screen or not, and new text goes back to them
+        uint8_t fg, bg;
+        switch (c) {
+        case '0': fg = 12; bg = 0;  break;  // Green on Black (VT100/Apple IIe)
+        case '1': fg = 60; bg = 0;  break;  // Amber on Black (Wyse/VT220)
+        case '2': fg = 63; bg = 3;  break;  // White on Blue (DOS/PC BIOS)
+        case '3': fg = 0;  bg = 63; break;  // Black on White (Mac Classic/Light mode)
+        case '4': fg = 11; bg = 3;  break;  // Light Blue on Blue (Commodore 64)
+        case '5': fg = 60; bg = 3;  break;  // Yellow on Blue (Turbo Pascal / DOS IDEs)
+        case '6': fg = 51; bg = 0;  break;  // Magenta on Black (ZX Spectrum/CPM)
+        case '7': fg = 42; bg = 0;  break;  // Light Gray on Black (DOS/Windows text mode)
+        case '8': fg = 15; bg = 0;  break;  // Cyan on Black (Retro secondary text)
+        case '9': fg = 48; bg = 21; break;  // Red on Dark Gray (Mainframe/Alert)
+        default: return;
+        }
+        set_palette(fg, bg, display_palette.reverse);
+        current_fg = COLOUR_WHITE;
+        current_bg = COLOUR_BLACK;
+        theme_select_mode = false;
+        return;
+    }
+    
+    if (vt.utf8_pending && ((uint8_t)c & 0xC0) != 0x80) {
+        vt.utf8_pending = 0; // Cut short, by a control or the next character
+        put_glyph(UTF8_REPLACEMENT);
+    }
+    if (vt.utf8 && (uint8_t)c >= 0x80) {
+        int g = utf8_decode(c);
+        if (g >= 0) {
+            put_glyph(g);
+        }
+        return;
+    }
+    
+    switch (c) {
+    case '\x06': // Ctrl+F
+        fg_color_menu_mode = true;
+        color_menu_buf_len = 0;
+        memset(color_menu_buf, 0, sizeof(color_menu_buf));
+        draw_color_menu("Foreground Color Menu", "Enter color code (00-63):");
+        break;
+    case '\x02': // Ctrl+B
+        bg_color_menu_mode = true;
+        color_menu_buf_len = 0;
+        memset(color_menu_buf, 0, sizeof(color_menu_buf));
+        draw_color_menu("Background Color Menu", "Enter color code (00-63):");
+        break;
+    case '\x14': theme_select_mode = true; break;
+    case '\x0E': cursor_menu_mode = true; draw_cursor_menu(); break;
+    case '\x16': mode_menu_mode = true; platform_draw_mode_menu(); break; // Ctrl+V
+    case '\x10': scroll_view(char_rows - 1); break;    // Ctrl+P: page back through history
+    case '\x0F': scroll_view(-(int)(char_rows - 1)); break; // Ctrl+O: page forward
+    case '\x19': select_font((current_font + 1) % N_FONTS); break; // Ctrl+Y: next font
+    case '\x17': terminal_show_console((shown_console + 1) % n_consoles); break; // Ctrl+W: next console
+    case '\x12': // Ctrl+R: search the history, which is the first console's
+        if (shown_console == 0) {
+            search_menu_mode = true;
+            draw_search_menu("");
+        }
+        break;
+    //case '\x07': current_fg = 12; current_bg = 0; break;
+    //case '\x03': current_fg = 15; break;
+    //case '\x04': current_fg = 4; break;
+    //case '\x13': current_fg = 51; break;
+    //case '\x0C': current_fg = 21; break;
+    case '\x1B': vt_advance(c); break;
+    case '\r':
+    case '\n':
+    case '\b':
+        execute_control(c);
+        break;
+        
+    default:
+        put_glyph(c);
+        break;
+    }
+    
+    #ifdef DEBUG
+    printf("Char processed: %c (0x%02X), cursor_x=%d, cursor_y=%d\n", 
+           (c >= 32 && c < 127) ? c : '.', c, term.cursor_x, term.cursor_y);
+    #endif
+}
+
+// The display's colours go up with the next flip, in whichever buffer
+// publish_cursor() or terminal_show_console() puts them next
+void set_palette(uint8_t fg, uint8_t bg, bool reverse) {
+    display_palette = (palette_info_t){.fg = fg & 0x3F, .bg = bg & 0x3F, .reverse = reverse};
+}
+
+// Tell core1, through the back buffer, where the cursor is and how to draw
+// it, and the colours of the display. Core1 draws the cursor over the cells
+// once they are in the display's colours, so its own are put in them here.
+static void publish_cursor(void) {
+    uint8_t glyph = ' ';
+    switch (current_cursor) {
+        case CURSOR__SOLID_BLOCK: glyph = (uint8_t)0xDB; break;
+        case CURSOR_APPLE_I: glyph = '@'; break;
+        case CURSOR_UNDERLINE: glyph = '_'; break;
+        case CURSOR_BAR: glyph = '|'; break;
+        case CURSOR_SHADED_BLOCK: glyph = (uint8_t)0xB2; break;
+        case CURSOR__SOLID_ARROW: glyph = '>'; break; // Solid arrow
+    }
+    
+    cursor_info_t cur = {
+        .x = term.cursor_x,
+        .y = pane_top + term.cursor_y,
+        .glyph = glyph,
+        .fg = palette_colour(&display_palette, display_palette.reverse ? current_bg : current_fg),
+        .bg = palette_colour(&display_palette, display_palette.reverse ? current_fg : current_bg),
+        .visible = term.cursor_visible && !screen_back->menu.visible &&
+                   term.cursor_y < pane_rows && term.cursor_x < line_cols(term.cursor_y),
+    };
+    if (memcmp(&cur, &screen_back->cursor, sizeof(cur)) != 0) {
+        screen_back->cursor = cur;
+        buffer_dirty = true;
+    }
+    if (memcmp(&display_palette, &screen_back->palette, sizeof(display_palette)) != 0) {
+        screen_back->palette = display_palette;
+        buffer_dirty = true;
+    }
+}
+
+void end_char_batch(void) {
+    publish_cursor();
+    safe_request_swap(); // Held while a bulk update comes in (see perform_swap())
+}
+
+// Fast path for plain text, which is most of what we receive: copy a run of
+// printable bytes straight into the current row and fill its colours a word
+// at a time, skipping the escape and menu state machine entirely. Returns the
+// number of bytes consumed (0 if the terminal isn't in a plain text state, or
+// is part way into a UTF-8 sequence, which put_char() shows as cut short).
+static size_t put_printable_run(const uint8_t *buf, size_t n) {
+    if (vt.state != VT_GROUND || vt.utf8_pending || fg_color_menu_mode || bg_color_menu_mode ||
+        cursor_menu_mode || mode_menu_mode || theme_select_mode || search_menu_mode) {
+        return 0;
+    }
+    
+    size_t i = 0;
+    while (i < n && buf[i] >= 0x20 && buf[i] <= 0x7E) {
+        uint x = term.cursor_x;
+        uint y = term.cursor_y;
+        if (y >= pane_rows || x >= line_cols(y)) {
+            // Cursor parked off screen by an escape sequence; let the slow
+            // path deal with it exactly as before
+            put_char(buf[i++]);
+            continue;
+        }
+        
+        size_t run = 0;
+        size_t room = line_cols(y) - x;
+        while (run < room && i + run < n && buf[i + run] >= 0x20 && buf[i + run] <= 0x7E) {
+            run++;
+        }
+        
+        memcpy(&screen_back->charbuf[x + back_row(y) * char_cols], &buf[i], run);
+        set_colour_span(x, y, run, current_fg, current_bg);
+        set_attr_span(x, y, run, current_attr);
+        term.cursor_x += run;
+        i += run;
+        
+        if (term.cursor_x >= line_cols(y)) {
+            new_line();
+        }
+    }
+    
+    if (i) {
+        // Same effect a printable character has on the CR/LF state in put_char()
+        term.suppress_next_cr = false;
+        term.skip_next_lf = false;
+        term.skip_next_cr = false;
+        buffer_dirty = true;
+        vt.last_glyph = buf[i - 1];
+        vt.last_glyph_valid = true;
+    }
+    return i;
+}
+
+void put_chars(const uint8_t *buf, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+        if (bulk_live()) {
+            i += bulk_put(&buf[i], n - i);
+            continue;
+        }
+        size_t run = put_printable_run(&buf[i], n - i);
+        if (run) {
+            i += run;
+        } else {
+            put_char((char)buf[i++]);
+        }
+    }
+}
+
+void handle_chars(const uint8_t *buf, size_t n) {
+    begin_char_batch();
+    put_chars(buf, n);
+    end_char_batch();
+}
+
+void handle_char(char c) {
+    handle_chars((const uint8_t *)&c, 1);
+}
+
+// === Sessions ===
+// Each session is a terminal of its own in a pane, a band of screen rows:
+// the parser, cursor, colours and scrolling region of the ones not being
+// parsed wait here, and terminal_select_session() swaps them in. The panes
+// share the screen buffers and dirty map, so a session costs no screen
+// memory, and the cursor shown is that of the session parsed last. Only a
+// session with the whole screen keeps history.
+//
+// Sessions can instead be virtual consoles (see terminal_set_consoles()),
+// each parsed into a whole screen of its own whether it is shown or not.
+// Selecting one is then a pointer change too.
+typedef struct {
+    uint8_t console;
+    uint top, rows;
+    terminal_state_t term;
+    vt_parser_t vt;
+    char osc_buffer[sizeof(osc_buffer)];
+    uint8_t osc_len;
+    uint8_t fg, bg, attr;
+    uint8_t scroll_top, scroll_bottom;
+    int saved_cursor_x, saved_cursor_y;
+    sixel_t sixel;
+    bulk_update_t bulk;
+} session_t;
+
+static session_t sessions[MAX_SESSIONS];
+static uint n_sessions = 1;
+
+static void session_save(session_t *s) {
+    s->console = console - consoles;
+    s->top = pane_top;
+    s->rows = pane_rows;
+    s->term = term;
+    s->vt = vt;
+    memcpy(s->osc_buffer, osc_buffer, sizeof(osc_buffer));
+    s->osc_len = osc_len;
+    s->fg = current_fg;
+    s->bg = current_bg;
+    s->attr = current_attr;
+    s->scroll_top = scroll_top;
+    s->scroll_bottom = scroll_bottom;
+    s->saved_cursor_x = saved_cursor_x;
+    s->saved_cursor_y = saved_cursor_y;
+    s->sixel = sixel;
+    s->bulk = bulk;
+}
+
+static void session_load(const session_t *s) {
+    console = &consoles[s->console];
+    screen_back = console->screen;
+    pane_top = s->top;
+    pane_rows = s->rows;
+    term = s->term;
+    vt = s->vt;
+    memcpy(osc_buffer, s->osc_buffer, sizeof(osc_buffer));
+    osc_len = s->osc_len;
+    current_fg = s->fg;
+    current_bg = s->bg;
+    current_attr = s->attr;
+    scroll_top = s->scroll_top;
+    scroll_bottom = s->scroll_bottom;
+    saved_cursor_x = s->saved_cursor_x;
+    saved_cursor_y = s->saved_cursor_y;
+    sixel = s->sixel;
+    bulk = s->bulk;
+}
+
+// The strips being drawn into by waiting sessions, which the scan of the
+// buffers in gfx_alloc_strip() doesn't see yet
+static uint32_t session_strips(void) {
+    uint32_t used = 0;
+    for (uint s = 0; s < n_sessions; s++) {
+        for (uint i = 0; s != current_session && i < GFX_MAX_STRIPS; i++) {
+            if (sessions[s].sixel.strip[i]) used |= 1u << (sessions[s].sixel.strip[i] - 1);
+        }
+    }
+    return used;
+}
+
+// Parse as session s from here on. Caller holds the back buffer.
+void terminal_select_session(uint s) {
+    if (s == current_session || s >= n_sessions) {
+        return;
+    }
+    if (sessions[s].console != sessions[current_session].console) {
+        refresh_row_info(); // Of the screen being left
+    }
+    session_save(&sessions[current_session]);
+    session_load(&sessions[s]);
+    current_session = s;
+}
+
+bool bulk_pending(void) {
+    for (uint c = 0; c < n_consoles; c++) {
+        if (consoles[c].bulk_blocks) return true;
+    }
+    return false;
+}
+
+void bulk_expire(void) {
+    uint was = current_session;
+    for (uint s = 0; s < n_sessions; s++) {
+        if (s == current_session ? bulk.active : sessions[s].bulk.active) {
+            terminal_select_session(s);
+            bulk_live();
+        }
+    }
+    terminal_select_session(was);
+}
+
+// The sessions are about to be laid out again from session 0: any bulk
+// update part way through goes, and with it the flips it holds
+static void drop_bulk_updates(void) {
+    bulk.active = false;
+    sessions[0].bulk.active = false;
+    for (uint c = 0; c < CONSOLES; c++) {
+        consoles[c].bulk_blocks = 0;
+    }
+}
+
+// Split the screen into n panes one above the other, with a rule between
+// each, each session starting out blank as after terminal_init()
+void terminal_set_sessions(uint n) {
+    n = MAX(1, MIN(n, MIN(MAX_SESSIONS, (char_rows + 1) / 2)));
+    uint rows = (char_rows - (n - 1)) / n;
+    lock_back_buffer();
+    terminal_select_session(0);
+    session_save(&sessions[0]);
+    drop_bulk_updates();
+    n_sessions = n;
+    for (uint i = 0; i < n; i++) {
+        session_t *s = &sessions[i];
+        *s = sessions[0];
+        s->top = i * (rows + 1);
+        s->rows = i == n - 1 ? char_rows - s->top : rows;
+        s->scroll_top = 0;
+        s->scroll_bottom = s->rows - 1;
+        s->term.cursor_x = s->term.cursor_y = 0;
+        if (i > 0) { // The rule above, a row no pane has
+            uint r = screen_back->row_map[s->top - 1];
+            memset(&screen_back->charbuf[r * char_cols], 0xC4, char_cols);
+            mark_row_dirty(r);
+        }
+    }
+    session_load(&sessions[0]);
+    for (uint i = n; i-- > 0; ) {
+        terminal_select_session(i);
+        clear_screen();
+    }
+    publish_cursor();
+    unlock_back_buffer();
+}
+
+// Give each of n sessions a console, the first keeping the screen it has
+// and the others starting out blank on one of their own
+void terminal_set_consoles(uint n) {
+    n = MAX(1, MIN(n, MIN(CONSOLES, MAX_SESSIONS)));
+    lock_back_buffer();
+    terminal_select_session(0);
+    session_save(&sessions[0]);
+    drop_bulk_updates();
+    n_sessions = n;
+    n_consoles = n;
+    for (uint i = 1; i < n; i++) {
+        consoles[i].screen = &screens[i + 1];
+        sessions[i] = sessions[0];
+        sessions[i].console = i;
+        sessions[i].term.cursor_x = sessions[i].term.cursor_y = 0;
+    }
+    for (uint i = n; i-- > 1; ) {
+        terminal_select_session(i);
+        clear_screen();
+        publish_cursor();
+    }
+    terminal_select_session(0);
+    unlock_back_buffer();
+}
+
+// Show console c from the next flip, which points core1 at its screen. The
+// screen coming off becomes c's back buffer, brought up to date by the
+// resync after the flip, and the console that was shown carries on in its
+// back buffer. Caller holds the back buffer.
+void terminal_show_console(uint c) {
+    if (c >= n_consoles || c == shown_console) {
+        return;
+    }
+    shown_console = c;
+    consoles[c].screen->palette = display_palette;
+    for (uint w = 0; w < DIRTY_MAP_WORDS; w++) {
+        consoles[c].dirty_rows[w] = ~0u;
+    }
+    view_offset = 0;
+    publish_history_view();
+    request_swap();
+}
+
+// === Setup ===
+void terminal_set_geometry(uint cols, uint rows) {
+    char_cols = MIN(cols, MAX_CHAR_COLS);
+    char_rows = MIN(rows, MAX_CHAR_ROWS);
+    colour_row_words = (char_cols + 7) / 8;
+    
+    pane_top = 0;
+    pane_rows = char_rows;
+    scroll_top = 0;
+    scroll_bottom = char_rows - 1;
+    colour_plane_words = (char_rows + 1) * colour_row_words;
+
+    // The screens take what this geometry needs out of the cell store, and the
+    // history the rest. Nothing has been written yet, so this is only ever
+    // done before terminal_init().
+    uint8_t *store = (uint8_t *)cell_store;
+    for (int b = 0; b < N_SCREENS; b++) {
+        screens[b].charbuf = (char *)store;
+        store += ((char_rows + 1) * char_cols + CHARBUF_PAD + 3) & ~3u;
+        screens[b].colourbuf = (uint32_t *)store;
+        store += (COLOUR_N_PLANES * colour_plane_words + COLOUR_PAD_WORDS) * sizeof(uint32_t);
+    }
+    store += (uintptr_t)store & 4; // For the index
+    size_t left = (uint8_t *)cell_store + sizeof(cell_store) - store - CHARBUF_PAD;
+    history_capacity = MIN(left / (sizeof(history_index[0]) + sizeof(history_line_t) + char_cols), 0xFFFF);
+    history_index = (uint64_t *)store;
+    store += history_capacity * sizeof(history_index[0]);
+    history = (history_line_t *)store;
+    store += history_capacity * sizeof(history_line_t);
+    history_chars = store;
+    gfx_strip_words = char_cols * FONT_CHAR_WIDTH * FONT_CHAR_HEIGHT / 16;
+    gfx_n_strips = MIN(GFX_POOL_WORDS / gfx_strip_words, GFX_MAX_STRIPS);
+    for (int b = 0; b < N_SCREENS; b++) {
+        screens[b].row_info[BORDER_ROW].blank_lines = 0xFFFF;
+        screens[b].row_info[BORDER_ROW].bg = 0;
+    }
+}
+
+void terminal_init(void) {
+    memcpy(font_ram[0], fonts[0].scanline, sizeof(font_ram[0]));
+    glyph_blank_lines = fonts[0].blank_lines;
+    init_xterm_colours();
+    
+    memset(&term, 0, sizeof(term));
+    term.suppress_next_cr = false;
+    term.cursor_visible = true;
+    term.cursor_x = 0;
+    term.cursor_y = 0;
+    saved_cursor_x = 0;
+    saved_cursor_y = 0;
+    vt.utf8 = UTF8_INPUT;
+    
+    lock_back_buffer();
+    clear_screen();
+    publish_cursor();
+    unlock_back_buffer();
+    perform_swap();
+}
@@ -0,0 +1,374 @@
+#ifndef _TERMINAL_H
+#define _TERMINAL_H
+
+#include "pico/types.h"
+
+// The terminal engine: the screen buffers and the swap between them, the
+// escape sequence parser, scrolling, scrollback, fonts and the menus. It
+// touches no hardware, so the same terminal.c also builds on a PC (see
+// host/), and everything it needs from the board is one of the platform_*()
+// hooks below. main.c owns the display modes, input, rendering and stats
+// reporting, and reads the front buffers declared here.
+
+// === Configuration ===
+// With FONT_8X8=1 (MY_TERMINAL_FONT_8X8) the fonts are 8x8 rather than 8x16,
+// for twice the rows: 80x60 at 640x480 up to 160x90 at 1280x720. Everything
+// kept per row is sized from MAX_CHAR_ROWS, so the screens double too.
+#ifndef FONT_8X8
+#define FONT_8X8 0
+#endif
+#define FONT_CHAR_WIDTH 8
+#define FONT_CHAR_HEIGHT (FONT_8X8 ? 8 : 16)
+#define FONT_N_CHARS 256
+
+// Whether the terminal starts out taking UTF-8 (MY_TERMINAL_UTF8), drawn in
+// the CP437 glyphs, or bytes that are the glyphs themselves. ESC%G and ESC%@
+// switch between them.
+#ifndef UTF8_INPUT
+#define UTF8_INPUT 1
+#endif
+
+// Buffers are sized for the largest display mode; everything else uses the
+// geometry in use (terminal_set_geometry()).
+#define MAX_FRAME_WIDTH 1280
+#define MAX_FRAME_HEIGHT 720
+#define MAX_CHAR_COLS (MAX_FRAME_WIDTH / FONT_CHAR_WIDTH)
+#define MAX_CHAR_ROWS (MAX_FRAME_HEIGHT / FONT_CHAR_HEIGHT)
+#define MAX_COLOUR_ROW_WORDS ((MAX_CHAR_COLS + 7) / 8)
+
+// Physical row that is never written, shown by core1 below the last whole text
+// row when the frame height isn't a multiple of the font height
+#define BORDER_ROW char_rows
+
+// Colour rows are a whole number of words (8 cells), so with 100 columns the
+// last word of each row is half used. A plane is colour_plane_words long, the
+// rows of the geometry in use and the border row. The encoder also works 8
+// characters at a time, so it reads and writes up to 7 characters past the
+// end of a row; the pads and DVI_TMDS_BUF_SLACK_WORDS (in CMakeLists.txt)
+// cover that.
+#define COLOUR_PAD_WORDS 8
+
+// After the R, G and B planes each colour buffer has a fourth plane, laid out
+// the same way, holding a nibble of SGR attributes per cell, and a fifth
+// that extends the colours (see COLOUR_EXT_R)
+#define COLOUR_N_PLANES 5
+#define ATTR_PLANE 3
+#define EXT_PLANE 4
+#define ATTR_BOLD      0x1
+#define ATTR_UNDERLINE 0x2
+#define ATTR_BLINK     0x4
+#define ATTR_REVERSE   0x8
+
+// A colour is 6-bit RGB222 (RRGGBB) in bits 5:0, which the palette encoder
+// draws, and 2 extension bits that pick a different level for red and
+// green, between the RGB222 ones (see colour_level()). Only the SIO and
+// HSTX paths draw them, so 256-colour and truecolour SGR get the nearest of
+// 256 colours there, and an RGB222 neighbour of it on RP2040. The extension
+// bits of a cell are a nibble of EXT_PLANE, laid out as in the other planes.
+#define COLOUR_EXT_R 0x40
+#define COLOUR_EXT_G 0x80
+#define COLOUR_EXT_BITS (COLOUR_EXT_R | COLOUR_EXT_G)
+#define UNDERLINE_FONT_LINE (FONT_CHAR_HEIGHT - 2)
+#define CHARBUF_PAD 8
+#define DIRTY_MAP_WORDS ((MAX_CHAR_ROWS + 31) / 32)
+
+// Scrollback: rows that scroll off the top of the screen are kept in a ring of
+// history lines in SRAM. Characters are stored as they were; the four colour
+// and attribute planes of a line are shared through a pool of distinct colour
+// rows, since most lines repeat one of a handful. Core1 renders a scrolled
+// back view straight out of the store, with no copy into the screen buffers.
+//
+// The screens' cells and the history share one store, laid out for the
+// geometry in use by terminal_set_geometry(): every screen gets just the rows
+// and columns it has, and the history every byte left, so narrower modes get
+// more lines. HISTORY_STORE_BYTES is what the store has beyond the screens at
+// the largest geometry.
+#define HISTORY_STORE_BYTES (192 * 1024)
+#define COLOUR_POOL_SIZE 64
+#define COLOUR_POOL_ENTRY_WORDS (COLOUR_N_PLANES * MAX_COLOUR_ROW_WORDS)
+
+// Sixel images (DCS q) are decoded as they arrive into strips of 2bpp grey
+// pixels, each one text row high and as wide as the screen, taken from a
+// fixed pool. A row showing a strip has it in row_info_t.gfx, and core1
+// encodes the strip's line instead of the text (still there underneath), so
+// an image scrolls, flips and is cleared along with its rows.
+#define GFX_POOL_WORDS (8 * 1024)
+#define GFX_MAX_STRIPS 16
+
+// Sessions: independent terminals sharing the screen, each in a pane of
+// rows of its own (see terminal_set_sessions()), or each with a screen of
+// its own, a virtual console (see terminal_set_consoles()). Every console
+// but the one shown costs a screen_t more, so the build says how many there
+// can be.
+#define MAX_SESSIONS 3
+#ifndef CONSOLES
+#define CONSOLES 1
+#endif
+
+// === Types ===
+// Fonts come ready for the encoder from font_work/pack_scanline.py: all 256
+// glyphs of one font line together, leftmost pixel in bit 0
+typedef struct {
+    const char *name;
+    const uint8_t *scanline;
+    const uint16_t *blank_lines;
+} font_t;
+
+#define N_FONTS 4
+
+// The cursor is never written into the buffers. Each buffer carries where it
+// goes and what it looks like (set by publish_cursor()), and core1 draws it
+// over that cell as it encodes, in the blink phase where it is shown.
+typedef struct {
+    uint8_t x, y; // Screen cell
+    uint8_t glyph;
+    uint8_t fg, bg;
+    bool visible;
+} cursor_info_t;
+
+// The display's colours, which core1 applies to the cells as it draws them
+// rather than core0 writing them into the planes, so a theme or reverse
+// video change recolours the whole screen at the next flip. The theme shows
+// the default colours, white (63) and black (0), as its own pair, and
+// reverse swaps every cell's foreground and background. Set by
+// set_palette() and published in each buffer with the cursor.
+#define COLOUR_WHITE 63
+#define COLOUR_BLACK 0
+typedef struct {
+    uint8_t fg, bg; // What white and black are shown as
+    bool reverse;   // DECSCNM
+} palette_info_t;
+
+// What colour c is shown as, before any reverse
+static inline uint8_t palette_colour(const palette_info_t *p, uint8_t c) {
+    return c == COLOUR_WHITE ? p->fg : c == COLOUR_BLACK ? p->bg : c;
+}
+
+static inline bool palette_is_identity(const palette_info_t *p) {
+    return p->fg == COLOUR_WHITE && p->bg == COLOUR_BLACK && !p->reverse;
+}
+
+// Apply p to 8 cells of a row: w[0] to w[2] are a word of each of its blue,
+// green and red planes and w[3] its EXT_PLANE word, or 0. Only a cell with
+// no extension bits is white or black.
+static inline void palette_map_word(const palette_info_t *p, uint32_t w[4]) {
+    const uint32_t lsb = 0x11111111u;
+    if (p->fg != COLOUR_WHITE || p->bg != COLOUR_BLACK) {
+        uint32_t all = w[0] & w[1] & w[2] & ~w[3];
+        uint32_t any = w[0] | w[1] | w[2] | w[3];
+        uint32_t fg_white = all & all >> 1 & lsb;
+        uint32_t fg_black = ~(any | any >> 1) & lsb;
+        uint32_t bg_white = all >> 2 & all >> 3 & lsb;
+        uint32_t bg_black = ~(any >> 2 | any >> 3) & lsb;
+        uint32_t keep = ~((fg_white | fg_black) * 0x3 | (bg_white | bg_black) * 0xC);
+        for (uint i = 0; i < 3; i++) {
+            uint32_t f = (p->fg >> (2 * i)) & 0x3, b = (p->bg >> (2 * i)) & 0x3;
+            w[i] = (w[i] & keep) | fg_white * f | fg_black * b | bg_white * (f << 2) | bg_black * (b << 2);
+        }
+    }
+    if (p->reverse) {
+        for (uint i = 0; i < 4; i++) {
+            w[i] = (w[i] & 0x33333333u) << 2 | (w[i] >> 2 & 0x33333333u);
+        }
+    }
+}
+
+// What core1 needs to know to skip encoding a scanline: the font lines that
+// are empty in every glyph of a physical row, and the background colour if
+// the whole row shares one. Kept per buffer and flipped with it; core0
+// refreshes a row's entry whenever it writes the row (see unlock_back_buffer()).
+#define ROW_BG_MIXED 0xFF
+typedef struct {
+    uint16_t blank_lines; // Bit n set: font line n is background only
+    uint8_t bg;           // 6-bit background of every cell, or ROW_BG_MIXED
+    uint8_t fg;           // 6-bit foreground of every cell, or ROW_BG_MIXED
+    bool attrs;           // Some cell has SGR attributes, so needs the slow path
+    bool ext;             // Some cell has extended colours (COLOUR_EXT_BITS)
+    uint8_t gfx;          // 1 + the gfx strip drawn instead of the text, or 0
+    uint8_t size;         // LINE_*, set by DECDWL/DECDHL and kept until the row is cleared
+} row_info_t;
+
+// Line sizes (ESC#5, #6, #3 and #4). Every size but single shows only the
+// first half of the row's cells, each twice as wide; the two halves of a
+// double height line are two rows holding the same text.
+#define LINE_SINGLE        0
+#define LINE_DOUBLE_WIDTH  1
+#define LINE_DOUBLE_TOP    2
+#define LINE_DOUBLE_BOTTOM 3
+
+typedef struct {
+    row_info_t info;
+    uint8_t colours; // colour_pool entry
+} history_line_t;
+
+// Small images drawn over the text by the renderer, in screen pixels. Each
+// buffer carries its own table, set by ESC[?9001;slot;image;x;y n, and the
+// flip moves them with the text. Image 0 is none; what the others are is up
+// to the renderer.
+#define OVERLAY_SPRITES 4
+typedef struct {
+    uint16_t x, y; // Top left pixel
+    uint8_t image;
+} overlay_sprite_t;
+
+typedef struct {
+    overlay_sprite_t sprite[OVERLAY_SPRITES];
+} overlay_info_t;
+
+// Menus are drawn into a window of their own, which the renderer shows over
+// the text, rather than into the buffers: opening one copies nothing and
+// closing it leaves the screen as it was. Each buffer carries its own, like
+// cursor_info_t.
+#define MENU_COLS 34
+#define MENU_ROWS 12
+typedef struct {
+    bool visible;
+    bool ext;            // Some cell has extended colours (COLOUR_EXT_BITS)
+    uint16_t left, top;  // Screen cell of the top left corner
+    uint8_t cols, rows;
+    uint8_t chars[MENU_ROWS][MENU_COLS];
+    uint8_t fg[MENU_ROWS][MENU_COLS];
+    uint8_t bg[MENU_ROWS][MENU_COLS];
+} menu_window_t;
+
+// A screen: the characters, their colour and attribute planes and the row
+// map, with what the renderer draws over them. Core1 renders screen_front,
+// and perform_swap() points it at another screen at VSYNC, which is all
+// that changes, whether that is the back buffer of the same console or the
+// screen of another one.
+typedef struct {
+    char *charbuf;       // char_rows + 1 rows of char_cols, word aligned, then CHARBUF_PAD
+    uint32_t *colourbuf; // COLOUR_N_PLANES planes of colour_plane_words, then COLOUR_PAD_WORDS
+    uint8_t row_map[MAX_CHAR_ROWS];
+    row_info_t row_info[MAX_CHAR_ROWS + 1];
+    cursor_info_t cursor;
+    palette_info_t palette;
+    overlay_info_t overlay;
+    menu_window_t menu;
+} screen_t;
+
+typedef struct {
+    uint16_t cursor_x;
+    uint16_t cursor_y;
+    bool cursor_visible;
+    bool skip_next_lf;
+    bool skip_next_cr;
+    bool suppress_next_cr;
+} terminal_state_t;
+
+// Render and ingest statistics, always kept, and reported in answer to
+// ESC[?9000n (see platform_report_stats()). The engine counts the swaps;
+// the encode figures are for core1's encode_line() calls during the last
+// frame, and the rest come from the input front-end.
+typedef struct {
+    uint32_t encode_cycles_min;
+    uint32_t encode_cycles_avg;
+    uint32_t encode_cycles_max;
+    uint32_t swaps;                 // Flips done by perform_swap()
+    uint32_t swap_latency_us_last;  // From request_swap() to the flip
+    uint32_t swap_latency_us_worst;
+    uint32_t ingest_bytes_per_s;    // From all inputs, over the last second
+    uint32_t uart_overflows;        // Times the UART DMA ring came close to lapping
+    uint32_t bulk_crc_errors;       // Bulk screen updates dropped for a bad CRC
+    uint32_t bulk_rejected;         // Bulk screen updates refused as too big, or given up part way
+    uint32_t flips_deferred;        // Flips at VSYNC put off a frame as core0 was writing
+    uint32_t tx_bytes;              // Replies sent to the host over the UARTs
+    uint32_t tx_dropped;            // Reply bytes with no room in a UART's TX ring
+} render_stats_t;
+
+// === Shared State ===
+// The front buffer, which core1 renders from
+extern screen_t *screen_front;
+
+extern uint8_t *history_chars;
+extern history_line_t *history;
+extern uint history_capacity;
+extern uint32_t colour_pool[COLOUR_POOL_SIZE][COLOUR_POOL_ENTRY_WORDS + COLOUR_PAD_WORDS];
+extern volatile uint32_t history_view; // history_head << 16 | lines scrolled back
+
+// Strip n is gfx_strip_words words from gfx_pool[n * gfx_strip_words]: its
+// lines one after another, 16 pixels per word, leftmost in bits 1:0
+extern uint32_t gfx_pool[GFX_POOL_WORDS];
+extern uint gfx_strip_words;
+
+extern const font_t fonts[N_FONTS];
+extern uint8_t font_ram[2][FONT_N_CHARS * FONT_CHAR_HEIGHT];
+extern const uint8_t *font_scanline; // The table core1 encodes with
+extern uint current_font;
+
+extern uint char_cols;
+extern uint char_rows;
+extern uint colour_row_words;
+extern uint colour_plane_words;
+
+extern terminal_state_t term;
+extern uint8_t current_fg;
+extern uint8_t current_bg;
+extern palette_info_t display_palette; // The one the next flip goes up with
+extern volatile bool input_active;
+extern volatile uint32_t swap_requests; // Written by core0 only
+extern volatile uint32_t swaps_done;    // Written by core1 only
+extern volatile render_stats_t stats;
+extern uint32_t swap_rows[DIRTY_MAP_WORDS]; // Physical rows the last flip brought changes to
+
+// === Engine ===
+// Size the screen (at most MAX_CHAR_COLS by MAX_CHAR_ROWS), before
+// terminal_init()
+void terminal_set_geometry(uint cols, uint rows);
+// Load the first font and the colour tables, and start with a clear screen
+// in both buffers
+void terminal_init(void);
+// Split the screen into n sessions (at most MAX_SESSIONS), after
+// terminal_init(), and choose the one the input that follows is for
+// (with the back buffer held)
+void terminal_set_sessions(uint n);
+void terminal_select_session(uint s);
+// Or give each of n sessions (at most CONSOLES) a screen of its own, and
+// choose the one shown
+void terminal_set_consoles(uint n);
+void terminal_show_console(uint c);
+
+// Core0 must hold the back buffer while it writes to it (see
+// lock_back_buffer()); everything below that writes the screen needs it.
+void lock_back_buffer(void);
+void unlock_back_buffer(void);
+// Core1's flips: perform_swap() flips only if core0 isn't writing, and
+// perform_swap_within() waits up to wait_us for it to finish first
+bool perform_swap(void);
+bool perform_swap_within(uint32_t wait_us);
+
+// A flip has been asked for since the last one
+static inline bool swap_pending(void) {
+    return swap_requests != swaps_done;
+}
+
+void begin_char_batch(void);
+void put_chars(const uint8_t *buf, size_t n);
+void end_char_batch(void);
+void handle_chars(const uint8_t *buf, size_t n);
+void handle_char(char c);
+void clear_screen(void);
+
+// Change the display's colours (see palette_info_t) from the next flip
+void set_palette(uint8_t fg, uint8_t bg, bool reverse);
+void draw_text_menu(const char *const lines[], size_t num_lines);
+// A history search (Ctrl+R) is under way: search_step() takes it on a slice
+bool search_pending(void);
+void search_step(void);
+
+// A bulk update (DCS ?9002) is part way in on some session: bulk_expire()
+// gives up on any whose host has stopped sending, as the next byte would
+bool bulk_pending(void);
+void bulk_expire(void);
+uint colour_level(uint v, bool ext);
+
+// === Platform Hooks ===
+// Implemented by whatever the engine is built into
+void platform_draw_mode_menu(void);         // Ctrl+V
+bool platform_select_display_mode(uint m);  // From that menu; false if there is no mode m
+void platform_report_stats(uint session);   // ESC[?9000n, from session's host
+void platform_reply(uint session, const char *s, size_t n); // Bytes for session's host
+void platform_capture_log(uint action);     // ESC[?9003;action n: 1 replays the log, 2 dumps it
+void platform_font_changed(void);           // Called as a font switch is queued
+
+#endif
@@ -1,6 +1,10 @@
 #include "tmds_encode_font_2bpp_c.h"
 #include "tmds_palette.h"
 
+// Bits of attrbuf, one byte per character
+#define ATTR_UNDERLINE 0x01
+#define ATTR_BLINK     0x02
+
 void tmds_encode_font_2bpp_c(const uint8_t *charbuf, const uint32_t *colourbuf, const uint8_t *attrbuf, uint32_t *tmdsbuf, uint n_pix, const uint8_t *font_line, uint font_y) {
     uint32_t *tmds_out = tmdsbuf;
     extern bool blink_phase; // Provided by main rendering loop
@@ -0,0 +1,32 @@
+#ifndef _TUSB_CONFIG_H_
+#define _TUSB_CONFIG_H_
+
+// TinyUSB as a host on the native port, for keyboards (USB_KEYBOARD in
+// main.c). Only used when MY_TERMINAL_USB_KEYBOARD puts this directory on the
+// include path; otherwise pico_stdio_usb brings its own, for the CDC device.
+
+#ifndef CFG_TUSB_MCU
+#error CFG_TUSB_MCU must be defined
+#endif
+
+#ifndef CFG_TUSB_OS
+#define CFG_TUSB_OS OPT_OS_PICO
+#endif
+
+#define CFG_TUH_ENABLED 1
+#define BOARD_TUH_RHPORT 0
+#define CFG_TUSB_RHPORT0_MODE OPT_MODE_HOST
+
+#define CFG_TUH_ENUMERATION_BUFSIZE 256
+
+// A keyboard on its own or behind a hub, which some have built in
+#define CFG_TUH_HUB 1
+#define CFG_TUH_DEVICE_MAX (CFG_TUH_HUB ? 4 : 1)
+#define CFG_TUH_HID 4
+#define CFG_TUH_HID_EPIN_BUFSIZE 64
+#define CFG_TUH_HID_EPOUT_BUFSIZE 64
+#define CFG_TUH_CDC 0
+#define CFG_TUH_MSC 0
+#define CFG_TUH_VENDOR 0
+
+#endif
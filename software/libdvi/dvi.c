@@ -1,3 +1,8 @@
+#include "dvi_config_defs.h"
+
+// PIO backend. See dvi_hstx.c for the RP2350 HSTX one.
+#if !DVI_HSTX
+
 #include <stdlib.h>
 #include "hardware/dma.h"
 #include "hardware/irq.h"
@@ -18,7 +23,19 @@ static struct dvi_inst *dma_irq_privdata[2];
 static void dvi_dma0_irq();
 static void dvi_dma1_irq();
 
-void dvi_init(struct dvi_inst *inst, uint spinlock_tmds_queue, uint spinlock_colour_queue) {
+#if DVI_TMDS_BUF_STATIC_PIXELS
+#if DVI_MONOCHROME_TMDS
+#define TMDS_BUF_WORDS(px) ((px) / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS)
+#else
+#define TMDS_BUF_WORDS(px) (3 * (px) / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS)
+#endif
+static uint32_t tmds_buf_pool[DVI_N_TMDS_BUFFERS][TMDS_BUF_WORDS(DVI_TMDS_BUF_STATIC_PIXELS)];
+static uint tmds_buf_pool_used;
+#endif
+
+// The serialiser, DMA channels and control block lists, which a mirror has
+// of its own too
+static void dvi_init_output(struct dvi_inst *inst) {
 	dvi_timing_state_init(&inst->timing_state);
 	dvi_serialiser_init(&inst->ser_cfg);
 	for (int i = 0; i < N_TMDS_LANES; ++i) {
@@ -28,29 +45,62 @@ void dvi_init(struct dvi_inst *inst, uint spinlock_tmds_queue, uint spinlock_col
 		inst->dma_cfg[i].dreq = pio_get_dreq(inst->ser_cfg.pio, inst->ser_cfg.sm_tmds[i], true);
 	}
 	inst->late_scanline_ctr = 0;
+	inst->late_scanline_total = 0;
+	inst->late_scanlines_frame = 0;
+	inst->late_scanlines_last_frame = 0;
+	inst->late_scanlines_worst_frame = 0;
+	inst->late_frames = 0;
+	inst->tmds_buf_last = NULL;
 	inst->tmds_buf_release_next = NULL;
 	inst->tmds_buf_release = NULL;
-	queue_init_with_spinlock(&inst->q_tmds_valid,   sizeof(void*),  8, spinlock_tmds_queue);
-	queue_init_with_spinlock(&inst->q_tmds_free,    sizeof(void*),  8, spinlock_tmds_queue);
-	queue_init_with_spinlock(&inst->q_colour_valid, sizeof(void*),  8, spinlock_colour_queue);
-	queue_init_with_spinlock(&inst->q_colour_free,  sizeof(void*),  8, spinlock_colour_queue);
+	inst->tmds_buf_release_mirror = NULL;
+	inst->tmds_buf_shown = NULL;
 
 	dvi_setup_scanline_for_vblank(inst->timing, inst->dma_cfg, true, &inst->dma_list_vblank_sync);
 	dvi_setup_scanline_for_vblank(inst->timing, inst->dma_cfg, false, &inst->dma_list_vblank_nosync);
 	dvi_setup_scanline_for_active(inst->timing, inst->dma_cfg, (void*)SRAM_BASE, &inst->dma_list_active);
 	dvi_setup_scanline_for_active(inst->timing, inst->dma_cfg, NULL, &inst->dma_list_error);
+}
+
+void dvi_init(struct dvi_inst *inst, uint spinlock_tmds_queue, uint spinlock_colour_queue) {
+	dvi_init_output(inst);
+	inst->primary = NULL;
+	inst->mirrored = false;
+	queue_init_with_spinlock(&inst->q_tmds_valid,   sizeof(void*),  DVI_TMDS_QUEUE_DEPTH, spinlock_tmds_queue);
+	queue_init_with_spinlock(&inst->q_tmds_free,    sizeof(void*),  DVI_TMDS_QUEUE_DEPTH, spinlock_tmds_queue);
+	queue_init_with_spinlock(&inst->q_colour_valid, sizeof(void*),  8, spinlock_colour_queue);
+	queue_init_with_spinlock(&inst->q_colour_free,  sizeof(void*),  8, spinlock_colour_queue);
 
+#if DVI_TMDS_BUF_STATIC_PIXELS
+	if (inst->timing->h_active_pixels > DVI_TMDS_BUF_STATIC_PIXELS)
+		panic("TMDS buffer pool too narrow for timing");
+	if (tmds_buf_pool_used)
+		panic("TMDS buffer pool already in use");
+	for (int i = 0; i < DVI_N_TMDS_BUFFERS; ++i) {
+		void *tmdsbuf = tmds_buf_pool[tmds_buf_pool_used++];
+		queue_add_blocking_u32(&inst->q_tmds_free, &tmdsbuf);
+	}
+#else
 	for (int i = 0; i < DVI_N_TMDS_BUFFERS; ++i) {
 		void *tmdsbuf;
 #if DVI_MONOCHROME_TMDS
-		tmdsbuf = malloc(inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD * sizeof(uint32_t));
+		tmdsbuf = malloc((inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS) * sizeof(uint32_t));
 #else
-		tmdsbuf = malloc(3 * inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD * sizeof(uint32_t));
+		tmdsbuf = malloc((3 * inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD + DVI_TMDS_BUF_SLACK_WORDS) * sizeof(uint32_t));
 #endif
 		if (!tmdsbuf)
 			panic("TMDS buffer allocation failed");
 		queue_add_blocking_u32(&inst->q_tmds_free, &tmdsbuf);
 	}
+#endif
+}
+
+void dvi_init_mirror(struct dvi_inst *inst, struct dvi_inst *primary) {
+	inst->timing = primary->timing;
+	dvi_init_output(inst);
+	inst->primary = primary;
+	inst->mirrored = false;
+	primary->mirrored = true;
 }
 
 // The IRQs will run on whichever core calls this function (this is why it's
@@ -171,22 +221,71 @@ void __dvi_func(dvi_scanbuf_main_16bpp)(struct dvi_inst *inst) {
 	__builtin_unreachable();
 }
 
+// Make sure all three channels have definitely loaded their last block
+// (should be within a few cycles of one another)
+static inline void __attribute__((always_inline)) _dvi_wait_lanes_loaded(struct dvi_inst *inst) {
+	for (int i = 0; i < N_TMDS_LANES; ++i) {
+		while (dma_debug_hw->ch[inst->dma_cfg[i].chan_data].dbg_tcr != inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD)
+			tight_loop_contents();
+	}
+}
+
+// Control blocks for the next scanline: tmdsbuf's data on an active line
+// (solid colour if it is NULL), else blanking with or without sync
+static inline void __attribute__((always_inline)) _dvi_load_scanline(struct dvi_inst *inst, uint32_t *tmdsbuf) {
+	switch (inst->timing_state.v_state) {
+		case DVI_STATE_ACTIVE:
+			if (tmdsbuf) {
+				dvi_update_scanline_data_dma(inst->timing, tmdsbuf, &inst->dma_list_active);
+				_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_active);
+			}
+			else {
+				_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_error);
+			}
+			break;
+		case DVI_STATE_SYNC:
+			_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_vblank_sync);
+			break;
+		default:
+			_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_vblank_nosync);
+			break;
+	}
+}
+
+// A mirror's timing is the same as its primary's and a few microseconds
+// behind, so the primary has always just set up the same scanline
+static void __dvi_func(dvi_mirror_irq_handler)(struct dvi_inst *inst) {
+	dvi_timing_state_advance(inst->timing, &inst->timing_state);
+	if (inst->timing_state.v_state == DVI_STATE_FRONT_PORCH && inst->timing_state.v_ctr == 0)
+		_dvi_end_frame(inst);
+	_dvi_wait_lanes_loaded(inst);
+	_dvi_load_scanline(inst, inst->primary->tmds_buf_shown);
+}
+
 static void __dvi_func(dvi_dma_irq_handler)(struct dvi_inst *inst) {
+	if (inst->primary) {
+		dvi_mirror_irq_handler(inst);
+		return;
+	}
+
 	// Every fourth interrupt marks the start of the horizontal active region. We
 	// now have until the end of this region to generate DMA blocklist for next
 	// scanline.
 	dvi_timing_state_advance(inst->timing, &inst->timing_state);
-	if (inst->tmds_buf_release && !queue_try_add_u32(&inst->q_tmds_free, &inst->tmds_buf_release))
+	if (inst->timing_state.v_state == DVI_STATE_FRONT_PORCH && inst->timing_state.v_ctr == 0)
+		_dvi_end_frame(inst);
+	uint32_t *release = inst->tmds_buf_release;
+	if (inst->mirrored) {
+		uint32_t *held = inst->tmds_buf_release_mirror;
+		inst->tmds_buf_release_mirror = release;
+		release = held;
+	}
+	if (release && !queue_try_add_u32(&inst->q_tmds_free, &release))
 		panic("TMDS free queue full in IRQ!");
 	inst->tmds_buf_release = inst->tmds_buf_release_next;
 	inst->tmds_buf_release_next = NULL;
 
-	// Make sure all three channels have definitely loaded their last block
-	// (should be within a few cycles of one another)
-	for (int i = 0; i < N_TMDS_LANES; ++i) {
-		while (dma_debug_hw->ch[inst->dma_cfg[i].chan_data].dbg_tcr != inst->timing->h_active_pixels / DVI_SYMBOLS_PER_WORD)
-			tight_loop_contents();
-	}
+	_dvi_wait_lanes_loaded(inst);
 
 	uint32_t *tmdsbuf;
 	while (inst->late_scanline_ctr > 0 && queue_try_remove_u32(&inst->q_tmds_valid, &tmdsbuf)) {
@@ -203,35 +302,33 @@ static void __dvi_func(dvi_dma_irq_handler)(struct dvi_inst *inst) {
 	else if (queue_try_peek_u32(&inst->q_tmds_valid, &tmdsbuf)) {
 		if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1) {
 			queue_remove_blocking_u32(&inst->q_tmds_valid, &tmdsbuf);
+#if DVI_REPEAT_LAST_SCANLINE
+			// Hold on to it in case the next one is late
+			inst->tmds_buf_release_next = inst->tmds_buf_last;
+			inst->tmds_buf_last = tmdsbuf;
+#else
 			inst->tmds_buf_release_next = tmdsbuf;
+#endif
 		}
 	}
 	else {
-		// No valid scanline was ready (generates solid red scanline)
+		// No valid scanline was ready (generates solid red scanline, or sends
+		// the last one again)
+#if DVI_REPEAT_LAST_SCANLINE
+		tmdsbuf = inst->tmds_buf_last;
+#else
 		tmdsbuf = NULL;
+#endif
 		if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1)
 			++inst->late_scanline_ctr;
+		_dvi_count_late_scanline(inst);
 	}
 
-	switch (inst->timing_state.v_state) {
-		case DVI_STATE_ACTIVE:
-			if (tmdsbuf) {
-				dvi_update_scanline_data_dma(inst->timing, tmdsbuf, &inst->dma_list_active);
-				_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_active);
-			}
-			else {
-				_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_error);
-			}
-			if (inst->scanline_callback && inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1) {
-				inst->scanline_callback();
-			}
-			break;
-		case DVI_STATE_SYNC:
-			_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_vblank_sync);
-			break;
-		default:
-			_dvi_load_dma_op(inst->dma_cfg, &inst->dma_list_vblank_nosync);
-			break;
+	inst->tmds_buf_shown = tmdsbuf;
+	_dvi_load_scanline(inst, tmdsbuf);
+	if (inst->timing_state.v_state == DVI_STATE_ACTIVE && inst->scanline_callback &&
+	    inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1) {
+		inst->scanline_callback();
 	}
 }
 
@@ -246,3 +343,5 @@ static void __dvi_func(dvi_dma1_irq)() {
 	dma_hw->ints1 = 1u << inst->dma_cfg[TMDS_SYNC_LANE].chan_data;
 	dvi_dma_irq_handler(inst);
 }
+
+#endif
@@ -41,6 +41,27 @@ struct dvi_inst {
 	// Remember how far behind the source is on TMDS scanlines, so we can output
 	// solid colour until they catch up (rather than dying spectacularly)
 	uint late_scanline_ctr;
+	// Every scanline output as solid colour because it was late (or repeated,
+	// see DVI_REPEAT_LAST_SCANLINE), for statistics
+	uint32_t late_scanline_total;
+	// The same for the frame being sent and for the last whole one, the most
+	// in any one frame, and the frames that had any
+	uint32_t late_scanlines_frame;
+	uint32_t late_scanlines_last_frame;
+	uint32_t late_scanlines_worst_frame;
+	uint32_t late_frames;
+	// The buffer of the last scanline sent, with DVI_REPEAT_LAST_SCANLINE
+	uint32_t *tmds_buf_last;
+
+	// Mirroring (see dvi_init_mirror()). A mirror has primary set, and sends
+	// tmds_buf_shown, the buffer the primary last set up for a scanline (NULL
+	// for none). A primary with a mirror holds each buffer one IRQ longer
+	// before freeing it, in tmds_buf_release_mirror, as the mirror runs a
+	// little behind.
+	struct dvi_inst *primary;
+	bool mirrored;
+	uint32_t *tmds_buf_shown;
+	uint32_t *tmds_buf_release_mirror;
 
 	// Encoded scanlines:
 	queue_t q_tmds_valid;
@@ -50,11 +71,38 @@ struct dvi_inst {
 	queue_t q_colour_valid;
 	queue_t q_colour_free;
 
+#if DVI_HSTX
+	// Two channels take turns feeding the HSTX FIFO, each chained to the
+	// other. hstx_dma_next is the one expected to finish first.
+	uint hstx_dma_chan[2];
+	uint hstx_dma_next;
+	uint hstx_irq_num;
+	// Set when the last list queued was an active line's commands, so the
+	// next transfer is its pixels (hstx_line_pending)
+	bool hstx_pixels_next;
+	uint32_t *hstx_line_pending;
+	// Pixel buffer each channel is reading, freed when it finishes
+	uint32_t *hstx_release[2];
+	// HSTX command lists
+	uint32_t hstx_line_vsync_on[6];
+	uint32_t hstx_line_vsync_off[6];
+	uint32_t hstx_line_active[9];
+	uint32_t hstx_line_error[8];
+#endif
 };
 
 // Set up data structures and hardware for DVI.
 void dvi_init(struct dvi_inst *inst, uint spinlock_tmds_queue, uint spinlock_colour_queue);
 
+// Set up a second output that sends the same scanlines as primary, on its own
+// serialiser and DMA channels, with the primary's timing. It has no TMDS
+// buffers or queues of its own: it sends the primary's buffers as the primary
+// does, so it costs DMA bandwidth but no encoding. Call after dvi_init() on
+// the primary. Register its IRQs on the same core as the primary's, on the
+// other DMA IRQ, and start it straight after the primary, so that it always
+// runs a few microseconds behind. PIO backend only.
+void dvi_init_mirror(struct dvi_inst *inst, struct dvi_inst *primary);
+
 // Call this after calling dvi_init(). DVI DMA interrupts will be routed to
 // whichever core called this function. Registers an exclusive IRQ handler.
 void dvi_register_irqs_this_core(struct dvi_inst *inst, uint irq_num);
@@ -73,6 +121,23 @@ void dvi_scanbuf_main_16bpp(struct dvi_inst *inst);
 void dvi_framebuf_main_8bpp(struct dvi_inst *inst);
 void dvi_framebuf_main_16bpp(struct dvi_inst *inst);
 
+// Used by both backends' DMA IRQs
+static inline void _dvi_count_late_scanline(struct dvi_inst *inst) {
+	++inst->late_scanline_total;
+	++inst->late_scanlines_frame;
+}
+
+// Called at the first line after the active lines
+static inline void _dvi_end_frame(struct dvi_inst *inst) {
+	uint32_t late = inst->late_scanlines_frame;
+	inst->late_scanlines_last_frame = late;
+	if (late > inst->late_scanlines_worst_frame)
+		inst->late_scanlines_worst_frame = late;
+	if (late)
+		++inst->late_frames;
+	inst->late_scanlines_frame = 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,54 @@
 #define DVI_N_TMDS_BUFFERS 3
 #endif
 
+// If nonzero, DVI init takes its DVI_N_TMDS_BUFFERS from a static pool sized
+// for scanlines of up to this many pixels, instead of malloc(), so the
+// memory shows at link time and timings of any width up to it can be used.
+// The pool serves a single DVI instance.
+#ifndef DVI_TMDS_BUF_STATIC_PIXELS
+#define DVI_TMDS_BUF_STATIC_PIXELS 0
+#endif
+
+// If 1, a scanline that isn't ready in time is sent as a repeat of the last
+// one rather than solid red, so an occasional late line is hard to spot. The
+// last buffer sent is kept back from the free queue until another replaces
+// it, so this costs a TMDS buffer.
+#ifndef DVI_REPEAT_LAST_SCANLINE
+#define DVI_REPEAT_LAST_SCANLINE 0
+#endif
+
+// Extra words allocated after each TMDS buffer, for encoders that work in
+// fixed-size groups of pixels and so can write a little past the end of a
+// scanline whose width isn't a multiple of the group.
+#ifndef DVI_TMDS_BUF_SLACK_WORDS
+#define DVI_TMDS_BUF_SLACK_WORDS 0
+#endif
+
+// Depth of the TMDS valid and free queues. They must be able to hold every
+// TMDS buffer at once, so this grows with DVI_N_TMDS_BUFFERS.
+#ifndef DVI_TMDS_QUEUE_DEPTH
+#define DVI_TMDS_QUEUE_DEPTH (DVI_N_TMDS_BUFFERS > 8 ? DVI_N_TMDS_BUFFERS : 8)
+#endif
+
+// If 1, drive DVI from the RP2350's HSTX peripheral (dvi_hstx.c) instead of
+// PIO (dvi.c). HSTX does the TMDS encode in hardware, so the buffers on
+// q_tmds_valid/q_tmds_free hold pixels (see DVI_HSTX_BPP) rather than
+// TMDS symbols. The HSTX pins are GPIO 12-19.
+#ifndef DVI_HSTX
+#define DVI_HSTX 0
+#endif
+
+// Bits per pixel of the HSTX scanline buffers, 8 (DVI_8BPP_* layout) or 16
+// (DVI_16BPP_*). The HSTX encoder fills the low bits of a lane with zeroes,
+// so lanes of only 2 or 3 bits top out well short of full brightness.
+#ifndef DVI_HSTX_BPP
+#define DVI_HSTX_BPP 8
+#endif
+
+#if DVI_HSTX && !PICO_RP2350
+#error "DVI_HSTX needs an RP2350"
+#endif
+
 // If 1, replace the DVI serialiser with a 10n1 UART (1 start bit, 10 data
 // bits, 1 stop bit) so the stream can be dumped and analysed easily.
 #ifndef DVI_SERIAL_DEBUG
@@ -0,0 +1,317 @@
+#include "dvi_config_defs.h"
+
+#if DVI_HSTX
+
+#include <stdlib.h>
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/structs/hstx_ctrl.h"
+#include "hardware/structs/hstx_fifo.h"
+
+#include "dvi.h"
+#include "dvi_timing.h"
+
+// HSTX backend for RP2350. The HSTX command expander has its own TMDS
+// encoder, so the scanline buffers passed through q_tmds_valid/q_tmds_free
+// hold pixels (DVI_HSTX_BPP bits each, lanes laid out as DVI_8BPP_* or
+// DVI_16BPP_*) instead of TMDS symbols, and no encode is done in software at
+// all. The API, queues and
+// vertical timing are the same as the PIO backend in dvi.c.
+//
+// Two DMA channels take turns feeding the HSTX FIFO, each chained to the
+// other: blanking lines are one command list, active lines a command list
+// followed by the pixels. Whenever a channel finishes, the IRQ gives it the
+// transfer after the one the other channel has just started.
+
+#define __dvi_func(f) __not_in_flash_func(f)
+
+#define HSTX_CMD_RAW         (0x0u << 12)
+#define HSTX_CMD_RAW_REPEAT  (0x1u << 12)
+#define HSTX_CMD_TMDS        (0x2u << 12)
+#define HSTX_CMD_TMDS_REPEAT (0x3u << 12)
+#define HSTX_CMD_NOP         (0xfu << 12)
+
+// Control symbols for {vsync, hsync}, on lane 0 only
+static const uint32_t tmds_ctrl_syms[4] = {0x354u, 0x0abu, 0x154u, 0x2abu};
+#define TMDS_CTRL_00 0x354u
+
+// The outputs are GPIO 12-19 and nothing else
+#define HSTX_FIRST_PIN 12
+
+// Bring bit msb of a pixel to bit 7, where the lane's encoder takes its data from
+#define HSTX_LANE_ROT(msb) (((msb) + 25) % 32)
+
+#if DVI_HSTX_BPP == 16
+#define HSTX_RED_MSB   DVI_16BPP_RED_MSB
+#define HSTX_RED_LSB   DVI_16BPP_RED_LSB
+#define HSTX_GREEN_MSB DVI_16BPP_GREEN_MSB
+#define HSTX_GREEN_LSB DVI_16BPP_GREEN_LSB
+#define HSTX_BLUE_MSB  DVI_16BPP_BLUE_MSB
+#define HSTX_BLUE_LSB  DVI_16BPP_BLUE_LSB
+#else
+#define HSTX_RED_MSB   DVI_8BPP_RED_MSB
+#define HSTX_RED_LSB   DVI_8BPP_RED_LSB
+#define HSTX_GREEN_MSB DVI_8BPP_GREEN_MSB
+#define HSTX_GREEN_LSB DVI_8BPP_GREEN_LSB
+#define HSTX_BLUE_MSB  DVI_8BPP_BLUE_MSB
+#define HSTX_BLUE_LSB  DVI_8BPP_BLUE_LSB
+#endif
+#define HSTX_LINE_BYTES(t) ((t)->h_active_pixels * DVI_HSTX_BPP / 8)
+
+static struct dvi_inst *hstx_irq_privdata;
+static void dvi_hstx_dma_irq();
+
+#if DVI_TMDS_BUF_STATIC_PIXELS
+static uint32_t hstx_buf_pool[DVI_N_TMDS_BUFFERS][DVI_TMDS_BUF_STATIC_PIXELS * DVI_HSTX_BPP / 32 + DVI_TMDS_BUF_SLACK_WORDS];
+static uint hstx_buf_pool_used;
+#endif
+
+static uint32_t sync_word(const struct dvi_timing *t, bool vsync_on, bool hsync_on) {
+	bool v = vsync_on == t->v_sync_polarity;
+	bool h = hsync_on == t->h_sync_polarity;
+	return tmds_ctrl_syms[v << 1 | h] | TMDS_CTRL_00 << 10 | TMDS_CTRL_00 << 20;
+}
+
+static void build_blank_line(const struct dvi_timing *t, bool vsync_on, uint32_t *l) {
+	l[0] = HSTX_CMD_RAW_REPEAT | t->h_front_porch;
+	l[1] = sync_word(t, vsync_on, false);
+	l[2] = HSTX_CMD_RAW_REPEAT | t->h_sync_width;
+	l[3] = sync_word(t, vsync_on, true);
+	l[4] = HSTX_CMD_RAW_REPEAT | (t->h_back_porch + t->h_active_pixels);
+	l[5] = sync_word(t, vsync_on, false);
+}
+
+static void build_active_line(const struct dvi_timing *t, uint32_t *l) {
+	l[0] = HSTX_CMD_RAW_REPEAT | t->h_front_porch;
+	l[1] = sync_word(t, false, false);
+	l[2] = HSTX_CMD_NOP;
+	l[3] = HSTX_CMD_RAW_REPEAT | t->h_sync_width;
+	l[4] = sync_word(t, false, true);
+	l[5] = HSTX_CMD_NOP;
+	l[6] = HSTX_CMD_RAW_REPEAT | t->h_back_porch;
+	l[7] = sync_word(t, false, false);
+	l[8] = HSTX_CMD_TMDS | t->h_active_pixels;
+}
+
+static void hstx_set_pair(uint pin, uint32_t sel, bool invert) {
+	uint bit = pin - HSTX_FIRST_PIN;
+	hstx_ctrl_hw->bit[bit]     = sel | (invert ? HSTX_CTRL_BIT0_INV_BITS : 0);
+	hstx_ctrl_hw->bit[bit + 1] = sel | (invert ? 0 : HSTX_CTRL_BIT0_INV_BITS);
+}
+
+void dvi_init(struct dvi_inst *inst, uint spinlock_tmds_queue, uint spinlock_colour_queue) {
+	const struct dvi_timing *t = inst->timing;
+	dvi_timing_state_init(&inst->timing_state);
+	inst->late_scanline_ctr = 0;
+	inst->late_scanline_total = 0;
+	inst->late_scanlines_frame = 0;
+	inst->late_scanlines_last_frame = 0;
+	inst->late_scanlines_worst_frame = 0;
+	inst->late_frames = 0;
+	inst->tmds_buf_last = NULL;
+	queue_init_with_spinlock(&inst->q_tmds_valid,   sizeof(void*),  DVI_TMDS_QUEUE_DEPTH, spinlock_tmds_queue);
+	queue_init_with_spinlock(&inst->q_tmds_free,    sizeof(void*),  DVI_TMDS_QUEUE_DEPTH, spinlock_tmds_queue);
+	queue_init_with_spinlock(&inst->q_colour_valid, sizeof(void*),  8, spinlock_colour_queue);
+	queue_init_with_spinlock(&inst->q_colour_free,  sizeof(void*),  8, spinlock_colour_queue);
+
+	build_blank_line(t, true, inst->hstx_line_vsync_on);
+	build_blank_line(t, false, inst->hstx_line_vsync_off);
+	build_active_line(t, inst->hstx_line_active);
+
+	// Lines we have nothing for are sent black (one pixel repeated)
+	inst->hstx_line_error[0] = HSTX_CMD_RAW_REPEAT | t->h_front_porch;
+	inst->hstx_line_error[1] = sync_word(t, false, false);
+	inst->hstx_line_error[2] = HSTX_CMD_RAW_REPEAT | t->h_sync_width;
+	inst->hstx_line_error[3] = sync_word(t, false, true);
+	inst->hstx_line_error[4] = HSTX_CMD_RAW_REPEAT | t->h_back_porch;
+	inst->hstx_line_error[5] = sync_word(t, false, false);
+	inst->hstx_line_error[6] = HSTX_CMD_TMDS_REPEAT | t->h_active_pixels;
+	inst->hstx_line_error[7] = 0;
+
+	// The shift register puts out 2 bits per HSTX clock, so the HSTX clock is
+	// half the bit clock (clk_sys). 5 shifts make a 10-bit symbol.
+	clock_configure(clk_hstx, 0, CLOCKS_CLK_HSTX_CTRL_AUXSRC_VALUE_CLK_SYS,
+		clock_get_hz(clk_sys), clock_get_hz(clk_sys) / 2);
+	hstx_ctrl_hw->csr = 0;
+	hstx_ctrl_hw->expand_tmds =
+		(HSTX_RED_MSB - HSTX_RED_LSB)     << HSTX_CTRL_EXPAND_TMDS_L2_NBITS_LSB |
+		HSTX_LANE_ROT(HSTX_RED_MSB)       << HSTX_CTRL_EXPAND_TMDS_L2_ROT_LSB   |
+		(HSTX_GREEN_MSB - HSTX_GREEN_LSB) << HSTX_CTRL_EXPAND_TMDS_L1_NBITS_LSB |
+		HSTX_LANE_ROT(HSTX_GREEN_MSB)     << HSTX_CTRL_EXPAND_TMDS_L1_ROT_LSB   |
+		(HSTX_BLUE_MSB - HSTX_BLUE_LSB)   << HSTX_CTRL_EXPAND_TMDS_L0_NBITS_LSB |
+		HSTX_LANE_ROT(HSTX_BLUE_MSB)      << HSTX_CTRL_EXPAND_TMDS_L0_ROT_LSB;
+	// Several pixels to a word; control symbols a whole word each
+	hstx_ctrl_hw->expand_shift =
+		(32 / DVI_HSTX_BPP) << HSTX_CTRL_EXPAND_SHIFT_ENC_N_SHIFTS_LSB |
+		DVI_HSTX_BPP << HSTX_CTRL_EXPAND_SHIFT_ENC_SHIFT_LSB |
+		1 << HSTX_CTRL_EXPAND_SHIFT_RAW_N_SHIFTS_LSB |
+		0 << HSTX_CTRL_EXPAND_SHIFT_RAW_SHIFT_LSB;
+	hstx_ctrl_hw->csr =
+		HSTX_CTRL_CSR_EXPAND_EN_BITS |
+		5u << HSTX_CTRL_CSR_CLKDIV_LSB |
+		5u << HSTX_CTRL_CSR_N_SHIFTS_LSB |
+		2u << HSTX_CTRL_CSR_SHIFT_LSB;
+
+	// Each lane puts out the even bits of its symbol in the first half of an
+	// HSTX clock and the odd bits in the second
+	const struct dvi_serialiser_cfg *cfg = &inst->ser_cfg;
+	hstx_set_pair(cfg->pins_clk, HSTX_CTRL_BIT0_CLK_BITS, cfg->invert_diffpairs);
+	for (uint lane = 0; lane < N_TMDS_LANES; ++lane) {
+		uint32_t sel = (lane * 10) << HSTX_CTRL_BIT0_SEL_P_LSB | (lane * 10 + 1) << HSTX_CTRL_BIT0_SEL_N_LSB;
+		hstx_set_pair(cfg->pins_tmds[lane], sel, cfg->invert_diffpairs);
+	}
+	for (uint pin = HSTX_FIRST_PIN; pin < HSTX_FIRST_PIN + 8; ++pin)
+		gpio_set_function(pin, GPIO_FUNC_HSTX);
+
+	for (int i = 0; i < 2; ++i) {
+		inst->hstx_dma_chan[i] = dma_claim_unused_channel(true);
+		inst->hstx_release[i] = NULL;
+	}
+	for (int i = 0; i < 2; ++i) {
+		dma_channel_config c = dma_channel_get_default_config(inst->hstx_dma_chan[i]);
+		channel_config_set_chain_to(&c, inst->hstx_dma_chan[!i]);
+		channel_config_set_dreq(&c, DREQ_HSTX);
+		channel_config_set_high_priority(&c, true);
+		dma_channel_configure(inst->hstx_dma_chan[i], &c, &hstx_fifo_hw->fifo,
+			inst->hstx_line_vsync_off, count_of(inst->hstx_line_vsync_off), false);
+	}
+	inst->hstx_dma_next = 0;
+	inst->hstx_pixels_next = false;
+
+#if DVI_TMDS_BUF_STATIC_PIXELS
+	if (t->h_active_pixels > DVI_TMDS_BUF_STATIC_PIXELS)
+		panic("Scanline buffer pool too narrow for timing");
+	if (hstx_buf_pool_used)
+		panic("Scanline buffer pool already in use");
+	for (int i = 0; i < DVI_N_TMDS_BUFFERS; ++i) {
+		void *linebuf = hstx_buf_pool[hstx_buf_pool_used++];
+		queue_add_blocking_u32(&inst->q_tmds_free, &linebuf);
+	}
+#else
+	for (int i = 0; i < DVI_N_TMDS_BUFFERS; ++i) {
+		void *linebuf = malloc(HSTX_LINE_BYTES(t) + DVI_TMDS_BUF_SLACK_WORDS * sizeof(uint32_t));
+		if (!linebuf)
+			panic("Scanline buffer allocation failed");
+		queue_add_blocking_u32(&inst->q_tmds_free, &linebuf);
+	}
+#endif
+}
+
+void dvi_register_irqs_this_core(struct dvi_inst *inst, uint irq_num) {
+	uint32_t mask = 1u << inst->hstx_dma_chan[0] | 1u << inst->hstx_dma_chan[1];
+	hstx_irq_privdata = inst;
+	if (irq_num == DMA_IRQ_0) {
+		dma_hw->ints0 = mask;
+		hw_set_bits(&dma_hw->inte0, mask);
+	}
+	else {
+		dma_hw->ints1 = mask;
+		hw_set_bits(&dma_hw->inte1, mask);
+	}
+	inst->hstx_irq_num = irq_num;
+	irq_set_exclusive_handler(irq_num, dvi_hstx_dma_irq);
+	irq_set_enabled(irq_num, true);
+}
+
+void dvi_start(struct dvi_inst *inst) {
+	dma_channel_start(inst->hstx_dma_chan[0]);
+	hw_set_bits(&hstx_ctrl_hw->csr, HSTX_CTRL_CSR_EN_BITS);
+}
+
+// Channel ch has finished: give it the next transfer
+static void __dvi_func(dvi_hstx_dma_irq_handler)(struct dvi_inst *inst, uint ch) {
+	// The line this channel was reading has gone out
+	if (inst->hstx_release[ch] && !queue_try_add_u32(&inst->q_tmds_free, &inst->hstx_release[ch]))
+		panic("TMDS free queue full in IRQ!");
+	inst->hstx_release[ch] = NULL;
+
+	dma_channel_hw_t *c = &dma_hw->ch[inst->hstx_dma_chan[ch]];
+	if (inst->hstx_pixels_next) {
+		// Second half of an active line, whose command list has just started
+		inst->hstx_pixels_next = false;
+		uint32_t *linebuf = inst->hstx_line_pending;
+#if DVI_REPEAT_LAST_SCANLINE
+		if (!linebuf) {
+			// Late: send the last line again
+			linebuf = inst->tmds_buf_last;
+		}
+		else if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1) {
+			// Hold on to it in case the next one is late
+			inst->hstx_release[ch] = inst->tmds_buf_last;
+			inst->tmds_buf_last = linebuf;
+		}
+#endif
+		c->read_addr = (uintptr_t)linebuf;
+		c->transfer_count = HSTX_LINE_BYTES(inst->timing) / sizeof(uint32_t);
+#if !DVI_REPEAT_LAST_SCANLINE
+		if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1)
+			inst->hstx_release[ch] = linebuf;
+#endif
+		return;
+	}
+
+	dvi_timing_state_advance(inst->timing, &inst->timing_state);
+	if (inst->timing_state.v_state == DVI_STATE_FRONT_PORCH && inst->timing_state.v_ctr == 0)
+		_dvi_end_frame(inst);
+
+	uint32_t *linebuf;
+	while (inst->late_scanline_ctr > 0 && queue_try_remove_u32(&inst->q_tmds_valid, &linebuf)) {
+		queue_add_blocking_u32(&inst->q_tmds_free, &linebuf);
+		--inst->late_scanline_ctr;
+	}
+
+	switch (inst->timing_state.v_state) {
+		case DVI_STATE_ACTIVE:
+			if (queue_try_peek_u32(&inst->q_tmds_valid, &linebuf)) {
+				if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1)
+					queue_remove_blocking_u32(&inst->q_tmds_valid, &linebuf);
+				inst->hstx_line_pending = linebuf;
+				inst->hstx_pixels_next = true;
+				c->read_addr = (uintptr_t)inst->hstx_line_active;
+				c->transfer_count = count_of(inst->hstx_line_active);
+			}
+			else {
+				if (inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1)
+					++inst->late_scanline_ctr;
+				_dvi_count_late_scanline(inst);
+#if DVI_REPEAT_LAST_SCANLINE
+				if (inst->tmds_buf_last) {
+					inst->hstx_line_pending = NULL;
+					inst->hstx_pixels_next = true;
+					c->read_addr = (uintptr_t)inst->hstx_line_active;
+					c->transfer_count = count_of(inst->hstx_line_active);
+					break;
+				}
+#endif
+				c->read_addr = (uintptr_t)inst->hstx_line_error;
+				c->transfer_count = count_of(inst->hstx_line_error);
+			}
+			if (inst->scanline_callback && inst->timing_state.v_ctr % DVI_VERTICAL_REPEAT == DVI_VERTICAL_REPEAT - 1)
+				inst->scanline_callback();
+			break;
+		case DVI_STATE_SYNC:
+			c->read_addr = (uintptr_t)inst->hstx_line_vsync_on;
+			c->transfer_count = count_of(inst->hstx_line_vsync_on);
+			break;
+		default:
+			c->read_addr = (uintptr_t)inst->hstx_line_vsync_off;
+			c->transfer_count = count_of(inst->hstx_line_vsync_off);
+			break;
+	}
+}
+
+static void __dvi_func(dvi_hstx_dma_irq)() {
+	struct dvi_inst *inst = hstx_irq_privdata;
+	io_rw_32 *ints = inst->hstx_irq_num == DMA_IRQ_0 ? &dma_hw->ints0 : &dma_hw->ints1;
+	// Channels finish in turn, so handle them in that order
+	while (*ints & (1u << inst->hstx_dma_chan[inst->hstx_dma_next])) {
+		uint ch = inst->hstx_dma_next;
+		*ints = 1u << inst->hstx_dma_chan[ch];
+		inst->hstx_dma_next = !ch;
+		dvi_hstx_dma_irq_handler(inst, ch);
+	}
+}
+
+#endif